@@ -15,13 +15,18 @@
 
 // Input handlers
 #include "gt_input_file.h"
+#include "gt_input_file_set.h"
+#include "gt_input_file_index.h"
 #include "gt_buffered_input_file.h"
 // Input parsers/utils
 #include "gt_input_parser.h"
 #include "gt_input_map_parser.h"
 #include "gt_input_map_utils.h"
 #include "gt_input_sam_parser.h"
+#include "gt_input_bam_parser.h"
+#include "gt_input_gtb_parser.h"
 #include "gt_input_fasta_parser.h"
+#include "gt_input_fasta_paired_reader.h"
 #include "gt_input_generic_parser.h"
 
 // Output handlers
@@ -31,11 +36,15 @@
 #include "gt_output_fasta.h"
 #include "gt_output_map.h"
 #include "gt_output_sam.h"
+#include "gt_output_gtb.h"
 #include "gt_output_generic_printer.h"
 
 // GEM-Tools basic data structures: Template/Alignment/Maps/...
 #include "gt_misms.h"
 #include "gt_map.h"
+#include "gt_map_arena.h"
+#include "gt_map_table.h"
+#include "gt_seq_name_table.h"
 #include "gt_dna_read.h"
 #include "gt_attributes.h"
 #include "gt_alignment.h"
@@ -67,6 +76,8 @@
   gt_buffered_input_file_attach_buffered_output(__buffered_input,buffered_output); \
   /* Prepare Attributes for generic I/O */ \
   gt_generic_parser_attributes* __gparser_attr = gt_input_generic_parser_attributes_new(paired_end); \
+  gt_map_arena* __map_arena = gt_map_arena_new(); \
+  gt_input_map_parser_attributes_set_map_arena(__gparser_attr->map_parser_attributes,__map_arena); \
   /* I/O Loop */ \
   gt_template* template = gt_template_new(); \
   while ((__error_code=gt_input_generic_parser_get_template(__buffered_input,template,__gparser_attr))) { \
@@ -81,7 +92,8 @@
   gt_buffered_input_file_close(__buffered_input); \
   gt_buffered_output_file_close(buffered_output); \
   gt_input_generic_parser_attributes_delete(__gparser_attr); \
-  gt_template_delete(template)
+  gt_template_delete(template); \
+  gt_map_arena_delete(__map_arena)
 
 /*
  * Options (Tools Menu)
@@ -120,6 +132,9 @@ extern char* gt_gtfcount_groups[];
 extern gt_option gt_region_options[];
 extern char* gt_region_groups[];
 
+extern gt_option gt_index_options[];
+extern char* gt_index_groups[];
+
 GT_INLINE uint64_t gt_options_get_num_options(const gt_option* const options);
 GT_INLINE struct option* gt_options_adaptor_getopt(const gt_option* const options);
 GT_INLINE gt_string* gt_options_adaptor_getopt_short(const gt_option* const options);
@@ -13,9 +13,33 @@
 #include "gt_attributes.h"
 
 #include "gt_map.h"
+#include "gt_map_arena.h"
 
 #include "gt_input_parser.h"
 
+/*
+ * Lazy maps
+ *   Map list recorded by the parser (raw text) and decoded on demand, as maps are accessed.
+ *   Maps are always decoded in order (the maps vector holds the first @num_decoded maps)
+ *   A malformed map is reported when it's decoded, and the list is cut before it
+ */
+typedef struct {
+  gt_string* text;       // Map list (own copy of the MAP field)
+  uint64_t next_offset;  // Offset (in @text) of the first map not decoded yet
+  uint64_t num_maps;     // Maps listed in @text (up to the max. number of maps to parse)
+  uint64_t num_decoded;  // Maps already decoded
+  void* owner;           // Alignment/Template the maps are decoded into
+  bool paired;           // @owner is a paired template (maps of both ends are decoded at once)
+  /* Parsing */
+  gt_map_arena* map_arena;
+  bool skip_based_model;
+  /* Source (decoding errors are reported against it) */
+  char* file_name;       // NULL if unknown
+  uint64_t line_num;
+  uint64_t column_pos;   // Column of the map list in the line
+  gt_status error_code;  // GT_IMP_PE_* error found decoding (0 if none). Maps past it are dropped
+} gt_lazy_maps;
+
 // Alignment itself
 typedef struct _gt_alignment_dictionary gt_alignment_dictionary; // Forward declaration of gt_alignment_dictionary
 typedef struct {
@@ -29,6 +53,8 @@ typedef struct {
   gt_vector* counters;
   /* Maps structures */
   gt_vector* maps; /* (gt_map*) */
+  gt_lazy_maps* pending_maps; /* Maps not decoded yet (NULL if none) */
+  gt_lazy_maps* lazy_maps;    /* Own lazy maps (storage) */
   /* Attibutes */
   gt_attributes* attributes;
   /* Hashed Dictionary */
@@ -73,12 +99,17 @@ struct _gt_alignment_dictionary {
   GT_HASH_CHECK(alignment_dictionary->refs_dictionary)
 
 /*
- *  TODO: Scheduled for v2.0 (all lazy parsing)
- *  TODO: Check
- *  #define GT_ALIGNMENT_EDITABLE_CHECK(alignment) \
- *    GT_ALIGNMENT_CHECK(alignment); \
- *    gt_fatal_check(alignment->maps_txt!=NULL,ALIGN_MAPS_NOT_PARSED)
+ * Lazy maps
+ *   Accessors below decode the maps they need on their own. Accessing/modifying the maps
+ *   vector directly requires decoding them first (GT_ALIGNMENT_DECODE_MAPS decodes all of them)
  */
+#define GT_ALIGNMENT_DECODE_MAPS(alignment) \
+  if (gt_expect_false((alignment)->pending_maps!=NULL)) gt_lazy_maps_decode((alignment)->pending_maps,GT_ALL)
+GT_INLINE void gt_alignment_decode_maps(gt_alignment* const alignment,const uint64_t num_maps); // Decodes the first @num_maps
+GT_INLINE gt_lazy_maps* gt_lazy_maps_new(void);
+GT_INLINE void gt_lazy_maps_delete(gt_lazy_maps* const lazy_maps);
+GT_INLINE void gt_lazy_maps_decode(gt_lazy_maps* const lazy_maps,const uint64_t num_maps); // (gt_input_map_parser.c)
+GT_INLINE void gt_lazy_maps_discard(gt_lazy_maps* const lazy_maps); // (gt_input_map_parser.c)
 
 /*
  * Setup
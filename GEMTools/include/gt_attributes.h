@@ -12,27 +12,52 @@
 
 /*
  * Attributes IDs
+ *   Well-known attributes live in fixed slots of the attributes block. Their ID is just
+ *   the (encoded) slot number, so looking them up involves no hashing nor string compare.
+ *   Any other ID (a regular string) goes to the overflow table of the block
  */
-#define GT_ATTR_ID_MAX_COMPLETE_STRATA "MCS"
-#define GT_ATTR_ID_NOT_UNIQUE "NOT-UNIQUE"
-
-#define GT_ATTR_ID_TAG_PAIR   "pair"   // (int64_t)
-#define GT_ATTR_ID_TAG_CASAVA "casava" // (gt_string)
-#define GT_ATTR_ID_TAG_EXTRA  "extra"  // (gt_string)
-
-#define GT_ATTR_ID_LEFT_TRIM  "LTrim"  // (gt_read_trim)
-#define GT_ATTR_ID_RIGHT_TRIM "RTrim"  // (gt_read_trim)
-
-#define GT_ATTR_ID_SEGMENTED_READ_INFO "SegmentedReadInfo" // (gt_segmented_read_info)
-
-#define GT_ATTR_ID_SAM_FLAGS "SAM_FLAGS"
-#define GT_ATTR_ID_SAM_PRIMARY_ALIGNMENT "SAM_PRIMARY_MAP"
-#define GT_ATTR_ID_SAM_PASSING_QC "SAM_PASSING_QC"
-#define GT_ATTR_ID_SAM_PCR_DUPLICATE "SAM_PCR_DUPLICATE"
-#define GT_ATTR_ID_SAM_ATTRIBUTES "SAM_ATTR"
-
-#define GT_ATTR_ID_SAM_TAG_NH "SAM_NH"
-#define GT_ATTR_ID_SAM_TAG_XT "SAM_XT"
+typedef enum {
+  GT_ATTR_SLOT_MAX_COMPLETE_STRATA,
+  GT_ATTR_SLOT_NOT_UNIQUE,
+  GT_ATTR_SLOT_TAG_PAIR,
+  GT_ATTR_SLOT_TAG_CASAVA,
+  GT_ATTR_SLOT_TAG_EXTRA,
+  GT_ATTR_SLOT_LEFT_TRIM,
+  GT_ATTR_SLOT_RIGHT_TRIM,
+  GT_ATTR_SLOT_SEGMENTED_READ_INFO,
+  GT_ATTR_SLOT_SAM_FLAGS,
+  GT_ATTR_SLOT_SAM_PRIMARY_ALIGNMENT,
+  GT_ATTR_SLOT_SAM_PASSING_QC,
+  GT_ATTR_SLOT_SAM_PCR_DUPLICATE,
+  GT_ATTR_SLOT_SAM_ATTRIBUTES,
+  GT_ATTR_SLOT_SAM_TAG_NH,
+  GT_ATTR_SLOT_SAM_TAG_XT,
+  GT_ATTR_NUM_SLOTS
+} gt_attribute_slot;
+#define GT_ATTR_SLOT_ID(slot) ((char*)(uintptr_t)((slot)+1))
+#define GT_ATTR_ID_IS_SLOT(attribute_id) ((uintptr_t)(attribute_id)<=GT_ATTR_NUM_SLOTS)
+#define GT_ATTR_ID_GET_SLOT(attribute_id) ((uintptr_t)(attribute_id)-1)
+
+#define GT_ATTR_ID_MAX_COMPLETE_STRATA GT_ATTR_SLOT_ID(GT_ATTR_SLOT_MAX_COMPLETE_STRATA)
+#define GT_ATTR_ID_NOT_UNIQUE GT_ATTR_SLOT_ID(GT_ATTR_SLOT_NOT_UNIQUE)
+
+#define GT_ATTR_ID_TAG_PAIR   GT_ATTR_SLOT_ID(GT_ATTR_SLOT_TAG_PAIR)   // (int64_t)
+#define GT_ATTR_ID_TAG_CASAVA GT_ATTR_SLOT_ID(GT_ATTR_SLOT_TAG_CASAVA) // (gt_string)
+#define GT_ATTR_ID_TAG_EXTRA  GT_ATTR_SLOT_ID(GT_ATTR_SLOT_TAG_EXTRA)  // (gt_string)
+
+#define GT_ATTR_ID_LEFT_TRIM  GT_ATTR_SLOT_ID(GT_ATTR_SLOT_LEFT_TRIM)  // (gt_read_trim)
+#define GT_ATTR_ID_RIGHT_TRIM GT_ATTR_SLOT_ID(GT_ATTR_SLOT_RIGHT_TRIM) // (gt_read_trim)
+
+#define GT_ATTR_ID_SEGMENTED_READ_INFO GT_ATTR_SLOT_ID(GT_ATTR_SLOT_SEGMENTED_READ_INFO) // (gt_segmented_read_info)
+
+#define GT_ATTR_ID_SAM_FLAGS GT_ATTR_SLOT_ID(GT_ATTR_SLOT_SAM_FLAGS)
+#define GT_ATTR_ID_SAM_PRIMARY_ALIGNMENT GT_ATTR_SLOT_ID(GT_ATTR_SLOT_SAM_PRIMARY_ALIGNMENT)
+#define GT_ATTR_ID_SAM_PASSING_QC GT_ATTR_SLOT_ID(GT_ATTR_SLOT_SAM_PASSING_QC)
+#define GT_ATTR_ID_SAM_PCR_DUPLICATE GT_ATTR_SLOT_ID(GT_ATTR_SLOT_SAM_PCR_DUPLICATE)
+#define GT_ATTR_ID_SAM_ATTRIBUTES GT_ATTR_SLOT_ID(GT_ATTR_SLOT_SAM_ATTRIBUTES)
+
+#define GT_ATTR_ID_SAM_TAG_NH GT_ATTR_SLOT_ID(GT_ATTR_SLOT_SAM_TAG_NH)
+#define GT_ATTR_ID_SAM_TAG_XT GT_ATTR_SLOT_ID(GT_ATTR_SLOT_SAM_TAG_XT)
 
 /*
  * Attribute Constants
@@ -44,13 +69,37 @@
 
 /*
  * Attributes Type
+ *   Primitives up to GT_ATTR_INLINE_SIZE bytes are stored within the attribute itself.
+ *   Strings (gt_string objects) are kept after clearing and reused by the next value
  */
-typedef gt_shash gt_attributes;
+#define GT_ATTR_INLINE_SIZE 16
+typedef struct {
+  void* element;        // Points to @value (inline primitives) or to the element itself
+  gt_hash_element_type element_type;
+  uint32_t element_size;
+  gt_hash_element_setup element_setup;
+  uint64_t value[GT_ATTR_INLINE_SIZE/8];
+} gt_attribute;
+typedef struct {
+  char* key;            // NULL if empty
+  uint64_t hash;
+  gt_attribute attribute;
+} gt_attribute_custom;
+typedef struct {
+  /* Well-known attributes */
+  uint32_t slots_set;   // Bitmap of slots holding a value
+  uint32_t slots_kept;  // Bitmap of slots holding a cleared string (to be reused)
+  gt_attribute slots[GT_ATTR_NUM_SLOTS];
+  /* Custom attributes (Open addressing, linear probing) */
+  gt_attribute_custom* custom;
+  uint64_t num_custom;
+  uint64_t custom_size;
+} gt_attributes;
 
 /*
  * Checkers
  */
-#define GT_ATTRIBUTES_CHECK(attributes) GT_HASH_CHECK((gt_shash*)attributes)
+#define GT_ATTRIBUTES_CHECK(attributes) GT_NULL_CHECK(attributes)
 
 /*
  * General Attributes
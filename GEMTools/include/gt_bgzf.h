@@ -0,0 +1,77 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_bgzf.h
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Block-parallel reader for BGZF files (gzip members carrying their compressed
+ *   size in the 'BC' extra subfield). The BGZF layout is the one described in resources/include/bgzf.h
+ */
+
+#ifndef GT_BGZF_H_
+#define GT_BGZF_H_
+
+#include "gt_essentials.h"
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#include "bgzf.h"
+
+/*
+ * BGZF block layout
+ */
+#define GT_BGZF_HEADER_SIZE 18
+#define GT_BGZF_FOOTER_SIZE 8
+#define GT_BGZF_MAX_BLOCK_SIZE BGZF_MAX_BLOCK_SIZE
+
+/*
+ * Checkers
+ */
+#define GT_BGZF_READER_CHECK(bgzf_reader) \
+  GT_NULL_CHECK(bgzf_reader); \
+  GT_NULL_CHECK(bgzf_reader->file); \
+  GT_VECTOR_CHECK(bgzf_reader->compressed_buffer); \
+  GT_VECTOR_CHECK(bgzf_reader->blocks)
+
+/*
+ * BGZF Reader
+ *   Reads as many complete blocks as fit in the destination buffer and inflates them in parallel
+ *   (each block is an independent deflate stream and its inflated size is known beforehand)
+ */
+typedef struct {
+  uint64_t file_offset;         // Offset of the block in the file
+  uint64_t compressed_offset;   // Offset of the block in @compressed_buffer
+  uint64_t compressed_size;     // Total size of the block (header+data+footer)
+  uint64_t uncompressed_offset; // Offset of the inflated block in the destination buffer
+  uint64_t uncompressed_size;   // Inflated size (ISIZE)
+} gt_bgzf_block;
+typedef struct {
+  FILE* file;
+  bool eof;
+  uint64_t file_offset;         // Offset of the next block to read
+  /* Batch of compressed blocks */
+  gt_vector* compressed_buffer; // (uint8_t)
+  gt_vector* blocks;            // (gt_bgzf_block)
+  bool pending_block;           // Last block read didn't fit in the previous chunk
+} gt_bgzf_reader;
+
+GT_INLINE bool gt_bgzf_is_bgzf_header(const uint8_t* const header,const uint64_t header_length);
+
+GT_INLINE gt_bgzf_reader* gt_bgzf_reader_new(FILE* const file);
+GT_INLINE void gt_bgzf_reader_delete(gt_bgzf_reader* const bgzf_reader);
+
+GT_INLINE uint64_t gt_bgzf_reader_read_chunk(
+    gt_bgzf_reader* const bgzf_reader,uint8_t* const buffer,const uint64_t buffer_size);
+
+/*
+ * Random access
+ *   Virtual offsets (as in BAM/tabix) are the file offset of the block shifted 16 bits
+ *   left, plus the offset of the data within the inflated block
+ */
+#define GT_BGZF_VIRTUAL_OFFSET(block_offset,offset_in_block) (((block_offset)<<16)|(offset_in_block))
+#define GT_BGZF_VIRTUAL_OFFSET_BLOCK(virtual_offset) ((virtual_offset)>>16)
+#define GT_BGZF_VIRTUAL_OFFSET_IN_BLOCK(virtual_offset) ((virtual_offset)&0xFFFF)
+GT_INLINE bool gt_bgzf_reader_seek(gt_bgzf_reader* const bgzf_reader,const uint64_t block_offset);
+GT_INLINE uint64_t gt_bgzf_reader_get_virtual_offset(gt_bgzf_reader* const bgzf_reader,const uint64_t chunk_offset);
+
+#endif /* HAVE_ZLIB */
+#endif /* GT_BGZF_H_ */
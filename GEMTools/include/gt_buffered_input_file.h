@@ -11,6 +11,7 @@
 
 #include "gt_essentials.h"
 #include "gt_input_file.h"
+#include "gt_input_file_set.h"
 #include "gt_template.h"
 #include "gt_buffered_output_file.h"
 
@@ -21,15 +22,38 @@
 // PE (Parsing Errors)
 // TODO
 
+/*
+ * Block sizing
+ *   FIXED: Blocks of the number of lines requested by the parser
+ *   THROUGHPUT/LATENCY: Number of lines adapted to target a block size (bytes) and a
+ *     processing time per block, from the recent line length and processing throughput
+ */
+typedef enum { GT_BMI_BLOCK_FIXED, GT_BMI_BLOCK_THROUGHPUT, GT_BMI_BLOCK_LATENCY } gt_bmi_block_sizing_mode;
+typedef struct {
+  gt_bmi_block_sizing_mode mode;
+  uint64_t target_block_size;  // Bytes
+  double target_block_time;    // Seconds
+  /* Recent behavior (moving averages) */
+  double bytes_per_line;
+  double bytes_per_second;
+  uint64_t last_block_size;
+  struct timeval last_block_timestamp; // Time the last block was handed out
+} gt_bmi_block_sizing;
+
 typedef struct {
   /* Input file */
   gt_input_file* input_file;
+  gt_input_file_set* input_file_set; // Set the input file belongs to (NULL if none)
   /* Block buffer and cursors */
   uint32_t block_id;
   gt_vector* block_buffer;
+  uint64_t block_buffer_accounted; // Bytes accounted (GT_MM_ACC_INPUT_BUFFERS)
   char* cursor;
   uint64_t lines_in_buffer;
   uint64_t current_line_num;
+  gt_bmi_block_sizing block_sizing;
+  /* Block dictionary */
+  gt_vector* block_seq_name_ids; /* (uint32_t) Contigs defined by the current GTB block (NULL until needed) */
   /* Attached output buffer */
   gt_vector* attached_buffered_output_file; /* (gt_buffered_output_file*) */
 } gt_buffered_input_file;
@@ -45,6 +69,7 @@ typedef struct {
  * Buffered Input File Handlers
  */
 gt_buffered_input_file* gt_buffered_input_file_new(gt_input_file* const input_file);
+gt_buffered_input_file* gt_buffered_input_file_new_from_set(gt_input_file_set* const input_file_set);
 gt_status gt_buffered_input_file_close(gt_buffered_input_file* const buffered_input_file);
 GT_INLINE uint64_t gt_buffered_input_file_get_cursor_pos(gt_buffered_input_file* const buffered_input_file);
 GT_INLINE bool gt_buffered_input_file_eob(gt_buffered_input_file* const buffered_input_file);
@@ -53,6 +78,33 @@ GT_INLINE gt_status gt_buffered_input_file_get_block(
 GT_INLINE gt_status gt_buffered_input_file_add_lines_to_block(
     gt_buffered_input_file* const buffered_input_file,const uint64_t num_lines);
 
+/*
+ * Block sizing
+ *   gt_buffered_input_file_block_lines() gives the number of lines to read for the next block
+ *   (@num_lines if FIXED) and gt_buffered_input_file_block_read() accounts for the block just read.
+ *   Over the memory budget (gt_mm_acc_set_budget), blocks are shrunk in any mode
+ */
+GT_INLINE void gt_buffered_input_file_set_block_sizing(
+    gt_buffered_input_file* const buffered_input_file,const gt_bmi_block_sizing_mode mode);
+GT_INLINE void gt_buffered_input_file_set_block_targets(
+    gt_buffered_input_file* const buffered_input_file,const uint64_t target_block_size,const double target_block_time);
+GT_INLINE uint64_t gt_buffered_input_file_block_lines(
+    gt_buffered_input_file* const buffered_input_file,const uint64_t num_lines);
+GT_INLINE void gt_buffered_input_file_block_read(gt_buffered_input_file* const buffered_input_file);
+
+/*
+ * Byte ranges (gt_input_file_enable_ranges)
+ *   Reads the next range of the input file resynced to record boundaries.
+ *   Ranges take the block IDs in order, so the output keeps the input order
+ */
+GT_INLINE gt_status gt_buffered_input_file_get_range_block(gt_buffered_input_file* const buffered_input_file);
+
+/*
+ * Input file sets (gt_buffered_input_file_new_from_set)
+ *   Moves to the next file of the set once the current one is exhausted (false if there is none left)
+ */
+GT_INLINE bool gt_buffered_input_file_next_input(gt_buffered_input_file* const buffered_input_file);
+
 /*
  * Block Synchronization with Output
  */
@@ -68,7 +120,9 @@ GT_INLINE void gt_buffered_input_file_set_id_attached_buffers(gt_vector* const a
   while (buffered_map_input->cursor[0]!=EOL) { \
     ++buffered_map_input->cursor; \
   } \
-  buffered_map_input->cursor[0]=EOS; \
+  if (!gt_vector_is_view(buffered_map_input->block_buffer)) { \
+    buffered_map_input->cursor[0]=EOS; /* Views are read-only (mmap) and left unterminated */ \
+  } \
   ++buffered_map_input->cursor; \
   ++buffered_map_input->current_line_num; \
 }
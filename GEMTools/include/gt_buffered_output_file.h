@@ -24,6 +24,9 @@ typedef struct {
 #define GT_BUFFERED_OUTPUT_FILE_OK 0
 #define GT_BUFFERED_OUTPUT_FILE_FAIL -1
 
+// Buffers are dumped (partial block) before printing past this size
+#define GT_BUFFERED_OUTPUT_FILE_FORCE_DUMP_SIZE GT_BUFFER_SIZE_64M
+
 /*
  * Checkers
  */
@@ -60,5 +63,6 @@ GT_INLINE void gt_buffered_output_file_safety_dump(gt_buffered_output_file* cons
  */
 GT_INLINE gt_status gt_vbofprintf(gt_buffered_output_file* const buffered_output_file,const char *template,va_list v_args);
 GT_INLINE gt_status gt_bofprintf(gt_buffered_output_file* const buffered_output_file,const char *template,...);
+GT_INLINE gt_status gt_bofwrite(gt_buffered_output_file* const buffered_output_file,const void* const data,const uint64_t length); // Binary
 
 #endif /* GT_BUFFERED_OUTPUT_FILE_H_ */
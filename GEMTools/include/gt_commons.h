@@ -224,5 +224,19 @@ GT_INLINE uint64_t gt_rand_IID(const uint64_t min,const uint64_t max);
 #else
   #define GT_PREFETCH(ADDR) __builtin_prefetch(ADDR,0,0)
 #endif
+// Byte scanning macros (bitmask of the bytes of a word equal to @character)
+#if defined(__AVX2__)
+  #include <immintrin.h>
+  #define GT_SCAN_WORD_LENGTH 32
+  #define GT_SCAN_WORD_MASK(word_ptr,character) \
+    ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8( \
+        _mm256_loadu_si256((const __m256i*)(word_ptr)),_mm256_set1_epi8(character))))
+#elif defined(__SSE2__)
+  #include <emmintrin.h>
+  #define GT_SCAN_WORD_LENGTH 16
+  #define GT_SCAN_WORD_MASK(word_ptr,character) \
+    ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8( \
+        _mm_loadu_si128((const __m128i*)(word_ptr)),_mm_set1_epi8(character))))
+#endif
 
 #endif /* GT_COMMONS_H_ */
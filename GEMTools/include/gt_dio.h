@@ -0,0 +1,56 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_dio.h
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Direct I/O reader. Reads the file bypassing the page cache (O_DIRECT)
+ *   splitting each chunk in several aligned reads issued in parallel (keeping many
+ *   requests in flight on devices like NVMe arrays)
+ */
+
+#ifndef GT_DIO_H_
+#define GT_DIO_H_
+
+#include "gt_essentials.h"
+
+/*
+ * Direct I/O constraints & parallelism
+ */
+#define GT_DIO_ALIGNMENT 4096  // Offsets, lengths and buffers (covers 512B and 4KB sectors)
+#define GT_DIO_NUM_REQUESTS 8  // Reads in flight per chunk
+
+/*
+ * Checkers
+ */
+#define GT_DIO_READER_CHECK(dio_reader) \
+  GT_NULL_CHECK(dio_reader); \
+  GT_NULL_CHECK(dio_reader->file_name)
+
+/*
+ * Direct I/O Reader
+ */
+typedef struct {
+  char* file_name;
+  int fildes;
+  int fildes_buffered; // Buffered descriptor to finish short reads not ending on an aligned boundary
+  bool direct_io;     // O_DIRECT enabled (not supported by some filesystems, e.g. tmpfs)
+  uint64_t file_size;
+  uint64_t offset;    // Next offset to read (always aligned)
+} gt_dio_reader;
+
+GT_INLINE gt_dio_reader* gt_dio_reader_open(char* const file_name);
+GT_INLINE gt_status gt_dio_reader_close(gt_dio_reader* const dio_reader);
+
+/*
+ * Buffers (aligned to GT_DIO_ALIGNMENT, released with gt_free)
+ */
+GT_INLINE void* gt_dio_buffer_new(const uint64_t buffer_size);
+
+/*
+ * Reads the next chunk of the file (as much as fits in @buffer_size rounded down to the alignment)
+ *   @buffer_size must be at least GT_DIO_ALIGNMENT
+ */
+GT_INLINE uint64_t gt_dio_reader_read_chunk(
+    gt_dio_reader* const dio_reader,uint8_t* const buffer,const uint64_t buffer_size);
+
+#endif /* GT_DIO_H_ */
@@ -274,6 +274,8 @@ gt_status gt_tprintf(const char* format,...);
 #define GT_ERROR_MEM_CURSOR_OUT_OF_SEGMENT "Current memory cursor is out of boundaries (Segmentation fault)"
 #define GT_ERROR_MEM_CURSOR_SEEK "Could not seek to address %"PRIu64". Out of boundaries (Segmentation fault)"
 #define GT_ERROR_MEM_ALG_FAILED "Failed aligning the memory address to the specified boundary"
+#define GT_ERROR_MEM_SLAB_ELEMENTS "Slab units cannot hold %"PRIu64" contiguous elements of %"PRIu64" Bytes"
+#define GT_ERROR_MEM_SLAB_CAST "Cannot cast a slab with elements still allocated"
 #define GT_ERROR_NULL_HANDLER "Null handler or fields not properly allocated"
 #define GT_ERROR_NULL_HANDLER_INFO "Null handler %s "
 
@@ -310,6 +312,29 @@ gt_status gt_tprintf(const char* format,...);
 #define GT_ERROR_FILE_BZIP2_OPEN "Could not open BZIPPED file '%s'"
 #define GT_ERROR_FILE_BZIP2_NO_BZLIB "Could not open BZIPPED file '%s': no bzlib support compiled in"
 #define GT_ERROR_FILE_FDOPEN "Could not fdopen file descriptor"
+#define GT_ERROR_FILE_DIRECT_COMPRESSED "Could not open file '%s' for direct I/O: compressed files are not supported"
+#define GT_ERROR_FILE_DIRECT_BUFFER_SIZE "Direct I/O buffer (%"PRIu64" Bytes) smaller than the I/O alignment (%"PRIu64" Bytes)"
+#define GT_ERROR_BGZF_BAD_HEADER "BGZF. Corrupted block header"
+#define GT_ERROR_BGZF_TRUNCATED "BGZF. Truncated block (premature end of file)"
+#define GT_ERROR_BGZF_INFLATE "BGZF. Error inflating block"
+#define GT_ERROR_FILE_READAHEAD_NUM_BUFFERS "Invalid number of read-ahead buffers (%"PRIu64"). Must be in [%"PRIu64",%"PRIu64"]"
+#define GT_ERROR_FILE_RANGES_SIZE "Invalid byte-range size (must be greater than zero)"
+#define GT_ERROR_FILE_RANGES_FORMAT "Input file '%s'. Byte ranges are only supported for MAP/SAM files"
+#define GT_ERROR_FILE_RANGES_NOT_SEEKABLE "Input file '%s'. Byte ranges require a seekable (uncompressed) file"
+#define GT_ERROR_FILE_INDEX_FORMAT "Input file '%s'. Only MAP/FASTA/FASTQ files can be indexed"
+#define GT_ERROR_FILE_INDEX_NOT_SEEKABLE "Input file '%s'. Random access requires a seekable file (plain or BGZF)"
+#define GT_ERROR_FILE_INDEX_NOT_LOADED "Input file '%s'. No index loaded"
+#define GT_ERROR_FILE_INDEX_CORRUPTED "Index file '%s'. Corrupted or truncated"
+#define GT_ERROR_FILE_INDEX_VERSION "Index file '%s'. Version not supported"
+#define GT_ERROR_FILE_INDEX_STALE "Index file '%s' is stale (the input file changed after indexing it)"
+#define GT_ERROR_FILE_INDEX_MISMATCH "Index file '%s' doesn't match the input file (compression/format)"
+#define GT_ERROR_FILE_INDEX_SAMPLING_RATE "Invalid index sampling rate (must be greater than zero)"
+#define GT_ERROR_OUTPUT_FILE_INDEX_COMPRESSED "Output file '%s'. Compressed outputs cannot be indexed"
+#define GT_ERROR_OUTPUT_FILE_INDEX_STREAM "Output streams cannot be indexed"
+#define GT_ERROR_FASTA_PAIRED_READER_FORMAT "Input file '%s'. Paired reader only supports FASTA/FASTQ files"
+#define GT_ERROR_FILE_SET_EMPTY "Input file set. No input files given"
+#define GT_ERROR_FILE_SET_GLOB "Input file set. Could not expand pattern '%s'"
+#define GT_ERROR_FILE_SET_FORMAT "Input file set. File '%s' format differs from the format of '%s'"
 
 // Output errors
 #define GT_ERROR_FPRINTF "Printing output. 'fprintf' call failed"
@@ -329,6 +354,8 @@ gt_status gt_tprintf(const char* format,...);
 #define GT_ERROR_MAP_MISMS_NOT_PARSED "Map's mismatches not parsed yet"
 #define GT_ERROR_MAP_NEG_LENGTH "Negative Map total length"
 #define GT_ERROR_MAP_NEG_MAPPED_BASES "Negative number of bases mapped"
+#define GT_ERROR_SEQ_NAME_TABLE_ID "Sequence-name ID (%"PRIu64") not in table"
+#define GT_ERROR_SEQ_NAME_TABLE_FULL "Sequence-name table full (too many distinct sequence names)"
 #define GT_ERROR_ALIGNMENT_READ_QUAL_LENGTH "Read and quality length differs"
 #define GT_ERROR_ALIGNMENT_MAPS_NOT_PARSED "Alignment's maps not parsed yet"
 #define GT_ERROR_ALIGNMENT_INCONSISTENT_COUNTERS "Alignment inconsistency. Maps inconsistent with counters values"
@@ -363,6 +390,8 @@ gt_status gt_tprintf(const char* format,...);
  */
 // IFP (Input FASTA Parser). General
 #define GT_ERROR_PARSE_FASTA "Parsing FASTA/FASTQ error(%s:%"PRIu64":%"PRIu64")"
+#define GT_ERROR_PARSE_FASTA_PAIRED_TAGS_MISMATCH "Parsing FASTA/FASTQ error(%s:%"PRIu64"). Tag doesn't match the tag of its mate"
+#define GT_ERROR_PARSE_FASTA_PAIRED_NUM_RECORDS "Parsing FASTA/FASTQ error(%s:%"PRIu64"). Paired files with different number of records"
 
 /*
  * Parsing MAP File format errors
@@ -412,6 +441,32 @@ gt_status gt_tprintf(const char* format,...);
 #define GT_ERROR_PARSE_SAM_WRONG_NUM_XA "Parsing SAM error(%s:%"PRIu64":%"PRIu64"). Wrong number of eXtra mAps (as to pair them)"
 #define GT_ERROR_PARSE_SAM_UNSOLVED_PENDING_MAPS "Parsing SAM error(%s:%"PRIu64":%"PRIu64"). Failed to pair maps"
 
+/*
+ * Parsing BAM File format errors
+ */
+// IBP (Input BAM Parser)
+#define GT_ERROR_PARSE_BAM "Parsing BAM error(%s:%"PRIu64")"
+#define GT_ERROR_PARSE_BAM_BAD_FILE_FORMAT "Parsing BAM error(%s:%"PRIu64"). Not a BAM file"
+#define GT_ERROR_PARSE_BAM_TRUNCATED_RECORD "Parsing BAM error(%s:%"PRIu64"). Truncated record"
+#define GT_ERROR_PARSE_BAM_CORRUPTED_RECORD "Parsing BAM error(%s:%"PRIu64"). Corrupted record (inconsistent field lengths)"
+#define GT_ERROR_PARSE_BAM_BAD_REFERENCE "Parsing BAM error(%s:%"PRIu64"). Reference ID out of the header's range"
+#define GT_ERROR_PARSE_BAM_BAD_CIGAR "Parsing BAM error(%s:%"PRIu64"). Invalid CIGAR operation"
+#define GT_ERROR_PARSE_BAM_UNMAPPED_XA "Parsing BAM error(%s:%"PRIu64"). Unmapped read contains XA field (inconsistency)"
+#define GT_ERROR_PARSE_BAM_UNSOLVED_PENDING_MAPS "Parsing BAM error(%s:%"PRIu64"). Failed to pair maps"
+
+/*
+ * Parsing GTB File format errors
+ */
+// IGTB (Input GTB Parser)
+#define GT_ERROR_PARSE_GTB "Parsing GTB error(%s:%"PRIu64")"
+#define GT_ERROR_PARSE_GTB_BAD_FILE_FORMAT "Parsing GTB error(%s:%"PRIu64"). Not a GTB file"
+#define GT_ERROR_PARSE_GTB_BAD_VERSION "Parsing GTB error(%s:%"PRIu64"). Unsupported GTB version"
+#define GT_ERROR_PARSE_GTB_TRUNCATED_BLOCK "Parsing GTB error(%s:%"PRIu64"). Truncated block"
+#define GT_ERROR_PARSE_GTB_CORRUPTED_BLOCK "Parsing GTB error(%s:%"PRIu64"). Corrupted block (inconsistent entry lengths)"
+#define GT_ERROR_PARSE_GTB_CORRUPTED_RECORD "Parsing GTB error(%s:%"PRIu64"). Corrupted record"
+#define GT_ERROR_PARSE_GTB_BAD_CONTIG "Parsing GTB error(%s:%"PRIu64"). Contig ID not defined in the block"
+#define GT_ERROR_PARSE_GTB_NOT_SE "Parsing GTB error(%s:%"PRIu64"). Paired record read as a single alignment"
+
 /*
  * Output File
  */
@@ -29,6 +29,40 @@ typedef struct {
 GT_INLINE void gt_hash_free_element(void* const element,const gt_hash_element_type element_type);
 GT_INLINE void* gt_hash_copy_element(void* const element,const gt_hash_element_type element_type,const int64_t element_size);
 
+/*
+ * Open-addressing Index (Shared by ihash/shash)
+ *   Maps hashes to positions in a dense array of elements (kept in insertion order).
+ *   Each slot packs {hash[63:32],position+1[31:0]} (0 if empty) and probing starts at hash[63:32],
+ *   so probing/removing only touches the elements whose hash tag matches. Linear probing,
+ *   load kept under 1/2 and backward-shift removal (no tombstones)
+ */
+#define GT_HASH_INDEX_INITIAL_SLOTS 16
+#define GT_HASH_INITIAL_ELEMENTS 8
+
+typedef struct {
+  uint64_t* slots;
+  uint64_t num_slots; // Power of 2 (0 if not allocated)
+} gt_hash_index;
+
+#define GT_HASH_INDEX_SLOT(hash,position) (((hash)&0xFFFFFFFF00000000ull) | ((uint64_t)(position)+1))
+#define GT_HASH_INDEX_SLOT_GET_POSITION(slot) (((slot)&0xFFFFFFFFull)-1)
+#define GT_HASH_INDEX_SLOT_MATCHES(slot,hash) (((slot)>>32)==((hash)>>32))
+#define GT_HASH_INDEX_HOME(hash,num_slots) (((hash)>>32)&((num_slots)-1))
+
+GT_INLINE void gt_hash_index_init(gt_hash_index* const hash_index);
+GT_INLINE void gt_hash_index_destroy(gt_hash_index* const hash_index);
+GT_INLINE void gt_hash_index_clear(gt_hash_index* const hash_index);
+GT_INLINE void gt_hash_index_reset(gt_hash_index* const hash_index,const uint64_t num_slots); // Empty index of @num_slots
+GT_INLINE void gt_hash_index_insert(gt_hash_index* const hash_index,const uint64_t hash,const uint64_t position);
+GT_INLINE void gt_hash_index_remove(gt_hash_index* const hash_index,const uint64_t slot_num);
+GT_INLINE bool gt_hash_index_is_full(gt_hash_index* const hash_index,const uint64_t num_elements);
+
+/*
+ * Hash functions
+ */
+GT_INLINE uint64_t gt_hash_int64(const int64_t key);
+GT_INLINE uint64_t gt_hash_string(const char* const key,uint64_t* const key_length); // Also computes the length
+
 /*
  * Key-specific Hash
  */
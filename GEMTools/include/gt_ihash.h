@@ -10,27 +10,34 @@
 #define GT_IHASH_H_
 
 #include "gt_commons.h"
-#include "uthash.h"
 
 /*
  * Integer Key Hash
+ *   Elements are stored in a dense array (insertion order) indexed by an open-addressing
+ *   table (gt_hash_index). NOTE: Pointers to the gt_ihash_element are only valid
+ *   until the next insertion into the same ihash (the elements they point to never move)
  */
 typedef struct {
   int64_t key;
   void* element;
   gt_hash_element_type element_type;
+  bool removed;
   union {
     size_t element_size;
     gt_hash_element_setup element_setup;
   };
-  UT_hash_handle hh;
 } gt_ihash_element;
 typedef struct {
-  gt_ihash_element* ihash_head;
+  gt_ihash_element* elements; // Dense array (insertion order)
+  uint64_t elements_used;     // Including removed
+  uint64_t elements_allocated;
+  uint64_t num_elements;
+  gt_hash_index index;
 } gt_ihash;
 typedef struct {
-  gt_ihash_element* ihash;
-  gt_ihash_element* next;
+  gt_ihash* ihash;
+  uint64_t next;              // Position of the next element to visit
+  gt_ihash_element* current;
 } gt_ihash_iterator;
 
 /*
@@ -67,22 +74,26 @@ GT_INLINE uint64_t gt_ihash_get_num_elements(gt_ihash* const ihash);
  */
 GT_INLINE gt_ihash* gt_ihash_dup(gt_ihash* const ihash);
 GT_INLINE void gt_ihash_copy(gt_ihash* const ihash_dst,gt_ihash* const ihash_src);
-GT_INLINE void gt_ihash_sort_by_key(gt_ihash* const ihash);
+GT_INLINE void gt_ihash_sort_by_key(gt_ihash* const ihash); // Ascending key order
 
 /*
  * Iterator
+ *   Elements can be removed while iterating, but not inserted into the same ihash
  */
 #define GT_IHASH_BEGIN_ITERATE(ihash,it_ikey,it_element,type) { \
-  gt_ihash_element *ihash_##ih_element, *ihash_##tmp; \
-  HASH_ITER(hh,ihash->ihash_head,ihash_##ih_element,ihash_##tmp) { \
+  uint64_t ihash_##it_pos; \
+  for (ihash_##it_pos=0;ihash_##it_pos<(ihash)->elements_used;++ihash_##it_pos) { \
+    gt_ihash_element* const ihash_##ih_element = (ihash)->elements+ihash_##it_pos; \
+    if (ihash_##ih_element->removed) continue; \
     type* const it_element = (type*)(ihash_##ih_element->element); \
     int64_t const it_ikey = ihash_##ih_element->key;
 #define GT_IHASH_END_ITERATE }}
 
 GT_INLINE gt_ihash_iterator* gt_ihash_iterator_new(gt_ihash* const ihash);
+GT_INLINE void gt_ihash_iterator_init(gt_ihash_iterator* const ihash_iterator,gt_ihash* const ihash);
 GT_INLINE void gt_ihash_iterator_delete(gt_ihash_iterator* const ihash_iterator);
 
-GT_INLINE bool gt_ihash_iterator_next(gt_ihash_iterator* const ihash_iterator);
+GT_INLINE bool gt_ihash_iterator_next(gt_ihash_iterator* const ihash_iterator); // Moves to the next element (false if none)
 GT_INLINE int64_t gt_ihash_iterator_get_key(gt_ihash_iterator* const ihash_iterator);
 GT_INLINE void* gt_ihash_iterator_get_element(gt_ihash_iterator* const ihash_iterator);
 
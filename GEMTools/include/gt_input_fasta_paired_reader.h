@@ -0,0 +1,73 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_input_fasta_paired_reader.h
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Paired FASTA/FASTQ reader for ends split in two files (R1/R2).
+ *   Each file is read on its own I/O thread into a ring of paired blocks (block k of R1 holds
+ *   the mates of block k of R2), which are handed out to the readers already matched
+ */
+
+#ifndef GT_INPUT_FASTA_PAIRED_READER_H_
+#define GT_INPUT_FASTA_PAIRED_READER_H_
+
+#include "gt_essentials.h"
+#include "gt_input_file.h"
+#include "gt_buffered_input_file.h"
+#include "gt_input_fasta_parser.h"
+
+#define GT_IFP_PAIRED_NUM_SLOTS 8
+#define GT_IFP_PAIRED_RECORDS_PER_BLOCK GT_NUM_LINES_10K
+
+/*
+ * Checkers
+ */
+#define GT_INPUT_FASTA_PAIRED_READER_CHECK(paired_reader) \
+  GT_NULL_CHECK(paired_reader); \
+  GT_INPUT_FILE_CHECK(paired_reader->input_file[0]); \
+  GT_INPUT_FILE_CHECK(paired_reader->input_file[1])
+
+/*
+ * Paired reader
+ */
+typedef struct {
+  gt_vector* block_buffer[2]; // (char)
+  uint64_t lines_in_buffer[2];
+  uint64_t first_line_num[2];
+  bool filled[2];
+} gt_ifp_paired_slot;
+typedef struct {
+  /* Input files (End/1 & End/2) */
+  gt_input_file* input_file[2];
+  uint64_t lines_per_record;
+  uint64_t lines_per_block;
+  /* I/O threads */
+  pthread_t io_thread[2];
+  uint64_t io_block_num[2]; // Next block to be read by each thread
+  bool io_eof[2];
+  bool io_exit;
+  /* Ring of paired blocks */
+  gt_ifp_paired_slot slots[GT_IFP_PAIRED_NUM_SLOTS];
+  uint64_t block_num;       // Next block to be handed out (also its block ID)
+  /* Mutexes */
+  pthread_mutex_t reader_mutex;
+  pthread_cond_t block_filled_cond;
+  pthread_cond_t slot_free_cond;
+} gt_input_fasta_paired_reader;
+
+/*
+ * Setup (FASTA/FASTQ files only, launches the I/O threads)
+ */
+gt_input_fasta_paired_reader* gt_input_fasta_paired_reader_new(gt_input_file* const input_file_end1,gt_input_file* const input_file_end2);
+void gt_input_fasta_paired_reader_delete(gt_input_fasta_paired_reader* const paired_reader);
+
+/*
+ * Synch read of blocks (drop-in for gt_input_fasta_parser_synch_blocks)
+ *   Reloads both buffered inputs (if the first is exhausted) with the next pair of blocks,
+ *   checking that the tags of the mates agree (output buffers must be attached to @buffered_input_end1)
+ */
+GT_INLINE gt_status gt_input_fasta_paired_reader_synch_blocks(
+    gt_input_fasta_paired_reader* const paired_reader,
+    gt_buffered_input_file* const buffered_input_end1,gt_buffered_input_file* const buffered_input_end2);
+
+#endif /* GT_INPUT_FASTA_PAIRED_READER_H_ */
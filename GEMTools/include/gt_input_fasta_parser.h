@@ -39,6 +39,9 @@
 #define GT_IFP_PE_QUALS_BAD_CHARACTER 50
 #define GT_IFP_PE_QUALS_BAD_LENGTH 51
 
+#define GT_IFP_PE_PAIRED_TAGS_MISMATCH 60
+#define GT_IFP_PE_PAIRED_NUM_RECORDS 61
+
 /*
  * FASTQ File basics
  */
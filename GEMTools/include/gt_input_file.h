@@ -12,6 +12,9 @@
 #include "gt_essentials.h"
 #include "gt_attributes.h"
 #include "gt_sam_attributes.h"
+#include "gt_bgzf.h"
+#include "gt_dio.h"
+#include "gt_input_file_index.h"
 
 #ifdef HAVE_ZLIB
 #include <zlib.h>
@@ -36,14 +39,52 @@
 /*
  * GT Input file
  */
-typedef enum { FASTA, MAP, SAM, FILE_FORMAT_UNKNOWN } gt_file_format;
-typedef enum { STREAM, REGULAR_FILE, MAPPED_FILE, GZIPPED_FILE, BZIPPED_FILE } gt_file_type;
+typedef enum { FASTA, MAP, SAM, BAM, GTB, FILE_FORMAT_UNKNOWN } gt_file_format;
+typedef enum { STREAM, REGULAR_FILE, MAPPED_FILE, DIRECT_FILE, GZIPPED_FILE, BGZIPPED_FILE, BZIPPED_FILE } gt_file_type;
+/*
+ * Read-ahead (Producer thread filling a ring of buffers ahead of the readers)
+ */
+#define GT_INPUT_FILE_READAHEAD_MIN_BUFFERS 2
+#define GT_INPUT_FILE_READAHEAD_MAX_BUFFERS 3
+typedef struct {
+  /* Producer */
+  pthread_t producer_thread;
+  bool producer_eof;
+  bool producer_exit;
+  /* Ring of buffers */
+  uint8_t* buffers[GT_INPUT_FILE_READAHEAD_MAX_BUFFERS];
+  uint64_t buffers_size[GT_INPUT_FILE_READAHEAD_MAX_BUFFERS];
+  uint64_t num_buffers;
+  uint64_t consumer_idx; // Buffer currently handed to the readers
+  uint64_t num_filled;   // Buffers filled ahead of the consumer one
+  /* Mutexes */
+  pthread_mutex_t readahead_mutex;
+  pthread_cond_t  buffer_filled_cond;
+  pthread_cond_t  buffer_free_cond;
+} gt_input_file_readahead;
+/*
+ * Byte ranges (Seekable MAP/SAM files split in ranges parsed independently)
+ */
+#define GT_INPUT_FILE_RANGE_SIZE GT_BUFFER_SIZE_4M
+typedef struct {
+  uint64_t data_begin; // Offset of the first record (past the headers)
+  uint64_t range_size;
+  uint64_t num_ranges;
+  uint64_t next_range;
+} gt_input_file_ranges;
 typedef struct {
   /* Input file */
   char* file_name;
   gt_file_type file_type;
   FILE* file;
   int fildes;
+  gt_dio_reader* dio_reader;   // DIRECT_FILE (O_DIRECT parallel reads)
+#ifdef HAVE_ZLIB
+  gt_bgzf_reader* bgzf_reader; // BGZIPPED_FILE (block-parallel inflate)
+#endif
+#ifdef HAVE_BZLIB
+  bool bz_stream_end;          // BZIPPED_FILE (reading past the end is a sequence error)
+#endif
   bool eof;
   uint64_t file_size;
   /* File format */
@@ -52,17 +93,27 @@ typedef struct {
     gt_map_file_format map_type;
     gt_fasta_file_format fasta_type;
     gt_sam_headers sam_headers;
+    gt_bam_headers bam_headers;
   };
   pthread_mutex_t input_mutex;
   /* Auxiliary Buffer (for synch purposes) */
   uint8_t* file_buffer;
+  uint64_t buffer_allocated; // Small until the format is detected (full-size on the next fill)
   uint64_t buffer_size;
   uint64_t buffer_begin;
   uint64_t buffer_pos;
   uint64_t global_pos;
   uint64_t processed_lines;
+  /* Read-ahead (NULL if disabled) */
+  gt_input_file_readahead* readahead;
+  /* Byte ranges (NULL if disabled) */
+  gt_input_file_ranges* ranges;
+  /* Random-access index (NULL if not loaded) */
+  gt_input_file_index* index;
   /* ID generator */
   uint64_t processed_id;
+  uint64_t* shared_processed_id; // Shared by a set of files (NULL if none, see gt_input_file_set)
+  pthread_mutex_t* shared_mutex; // Lock shared by a concatenated set of files (NULL if none)
 } gt_input_file;
 
 /*
@@ -70,11 +121,54 @@ typedef struct {
  */
 gt_input_file* gt_input_stream_open(FILE* stream);
 gt_input_file* gt_input_file_open(char* const file_name,const bool mmap_file);
+gt_input_file* gt_input_file_open_direct(char* const file_name); // Uncompressed files only
 gt_status gt_input_file_close(gt_input_file* const input_file);
 
 /* Format detection */
 gt_file_format gt_input_file_detect_file_format(gt_input_file* const input_file);
 
+/*
+ * Read-ahead
+ *   Launches a producer thread that reads (and decompresses) the next chunks of the
+ *   file while the readers split the current one (no-op for MAPPED_FILE)
+ */
+void gt_input_file_enable_readahead(gt_input_file* const input_file,const uint64_t num_buffers);
+
+/*
+ * Byte ranges
+ *   Splits the file in ranges of @range_size bytes, handed out in order (each with the next block ID).
+ *   Each reader resyncs its range to record boundaries (see gt_buffered_input_file_get_range_block)
+ *   and reads it without holding the input mutex. Only for seekable MAP/SAM files
+ */
+void gt_input_file_enable_ranges(gt_input_file* const input_file,const uint64_t range_size);
+GT_INLINE bool gt_input_file_next_range(
+    gt_input_file* const input_file,uint64_t* const block_id,uint64_t* const range_begin,uint64_t* const range_end);
+GT_INLINE uint64_t gt_input_file_pread(
+    gt_input_file* const input_file,const uint64_t offset,const uint64_t length,gt_vector* const buffer_dst);
+GT_INLINE uint64_t gt_input_file_read_range(
+    gt_input_file* const input_file,const uint64_t offset,const uint64_t length,gt_vector* const buffer_dst);
+
+/*
+ * Random access
+ *   Repositions the file at @offset (uncompressed). BGZF files are positioned using the
+ *   @virtual_offset of that same byte. Only for plain (REGULAR/MAPPED) and BGZF files, without
+ *   read-ahead or ranges. @processed_lines is the number of lines before @offset
+ */
+GT_INLINE void gt_input_file_seek(
+    gt_input_file* const input_file,const uint64_t offset,const uint64_t virtual_offset,const uint64_t processed_lines);
+
+/*
+ * Random-access index (".gti" sidecar, see gt_input_file_index.h)
+ *   Records are numbered from 0. After seeking, the input is read as usual from that record on
+ *   (readers must not hold blocks of the previous position)
+ */
+GT_INLINE uint64_t gt_input_file_index_get_lines_per_record(gt_input_file* const input_file); // 0 if not indexable
+GT_INLINE gt_input_file_index* gt_input_file_index_build(gt_input_file* const input_file,const uint64_t sampling_rate);
+GT_INLINE bool gt_input_file_load_index(gt_input_file* const input_file); // Loads "<file_name>.gti" (false if missing)
+GT_INLINE bool gt_input_file_seek_template(gt_input_file* const input_file,const uint64_t template_num);
+GT_INLINE bool gt_input_file_seek_tag(
+    gt_input_file* const input_file,const char* const tag,const uint64_t tag_length,uint64_t* const template_num);
+
 /*
  * Accessors (Mutex,ID,...) functions
  */
@@ -88,12 +182,24 @@ GT_INLINE uint64_t gt_input_file_next_id(gt_input_file* const input_file);
 GT_INLINE size_t gt_input_file_dump_to_buffer(gt_input_file* const input_file,gt_vector* const buffer_dst);
 GT_INLINE size_t gt_input_file_fill_buffer(gt_input_file* const input_file);
 GT_INLINE size_t gt_input_file_next_line(gt_input_file* const input_file,gt_vector* const buffer_dst);
+GT_INLINE uint64_t gt_input_file_add_bytes(
+    gt_input_file* const input_file,gt_vector* const buffer_dst,const uint64_t num_bytes); // Binary records
 
 GT_INLINE size_t gt_input_file_next_record(
     gt_input_file* const input_file,gt_vector* const buffer_dst,gt_string* const first_field,
     uint64_t* const num_spaces,uint64_t* const num_tabs);
 GT_INLINE bool gt_input_file_next_record_cmp_first_field(gt_input_file* const input_file,gt_string* const first_field);
 
+/*
+ * Line scanning
+ *   Locates the @num_eols-th EOL in @buffer (vectorized if SSE2/AVX2 are available).
+ *   Returns the number of bytes up to (and including) that EOL, or @length if fewer EOLs are found.
+ *   Sets @dos_eol if any DOS_EOL is contained in the scanned bytes
+ */
+GT_INLINE uint64_t gt_input_file_scan_eols(
+    const uint8_t* const buffer,const uint64_t length,const uint64_t num_eols,
+    uint64_t* const num_eols_found,bool* const dos_eol);
+
 /*
  * Line Readers (thread-unsafe, must call mutex functions before)
  */
@@ -136,6 +242,7 @@ GT_INLINE uint64_t gt_input_file_get_lines(
       ++input_file->buffer_pos; \
       if (gt_expect_true(buffer_dst!=NULL)) { \
         gt_input_file_dump_to_buffer(input_file,buffer_dst); \
+        gt_vector_unset_view(buffer_dst,true); /* Views are read-only */ \
         gt_vector_dec_used(buffer_dst); \
         *gt_vector_get_last_elm(buffer_dst,char)=EOL; \
       } \
@@ -0,0 +1,91 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_input_file_index.h
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Random-access index for MAP/FASTA/FASTQ files (".gti" sidecar).
+ *   Records the offset of every K-th record (template) and a hash of the tag of every record,
+ *   so that the input can be positioned at the N-th record or at a given tag without scanning it.
+ *   Plain and BGZF files (BGZF virtual offsets) are supported
+ */
+
+#ifndef GT_INPUT_FILE_INDEX_H_
+#define GT_INPUT_FILE_INDEX_H_
+
+#include "gt_essentials.h"
+
+/*
+ * Index file (".gti")
+ *   magic[3] "GTI" | version[1] | lines_per_record (uint32) | bgzf (uint32) |
+ *   source_size (uint64) | source_mtime (uint64) |
+ *   sampling_rate (uint64) | num_records (uint64) | num_samples (uint64) |
+ *   { offset (uint64) | virtual_offset (uint64) }*num_samples | tag_hash (uint32)*num_records
+ *   (Host byte order. The size/mtime of the source file detect stale indexes)
+ */
+#define GT_INPUT_FILE_INDEX_EXTENSION ".gti"
+#define GT_INPUT_FILE_INDEX_MAGIC "GTI"
+#define GT_INPUT_FILE_INDEX_MAGIC_LENGTH 3
+#define GT_INPUT_FILE_INDEX_VERSION 1
+#define GT_INPUT_FILE_INDEX_SAMPLING_RATE 1024
+
+// Lines per record (template)
+#define GT_INPUT_FILE_INDEX_LINES_MAP   1
+#define GT_INPUT_FILE_INDEX_LINES_FASTA 2
+#define GT_INPUT_FILE_INDEX_LINES_FASTQ 4
+
+/*
+ * Index
+ */
+typedef struct {
+  uint64_t offset;         // Offset of the record in the (uncompressed) file
+  uint64_t virtual_offset; // BGZF virtual offset of the record (@offset if not BGZF)
+} gt_input_file_index_sample;
+typedef struct {
+  /* Layout */
+  uint64_t sampling_rate;    // Records between samples
+  uint64_t lines_per_record; // MAP=1, FASTA=2, FASTQ=4
+  bool bgzf;
+  /* Source file (as indexed) */
+  uint64_t source_size;  // Size on disk
+  uint64_t source_mtime; // Modification time
+  /* Index */
+  uint64_t num_records;
+  gt_vector* samples;    // (gt_input_file_index_sample) Every @sampling_rate-th record
+  gt_vector* tag_hashes; // (uint32_t) Every record
+  /* Builder (records scanned so far) */
+  uint64_t scan_offset;  // Bytes scanned
+  uint64_t record_line;  // Current line within the record
+  bool line_begin;       // Next byte begins a line
+  uint64_t tag_state;    // Reading the tag of the current record
+  gt_string* tag;
+} gt_input_file_index;
+
+/*
+ * Checkers
+ */
+#define GT_INPUT_FILE_INDEX_CHECK(index) \
+  GT_NULL_CHECK(index); \
+  GT_VECTOR_CHECK(index->samples); \
+  GT_VECTOR_CHECK(index->tag_hashes)
+
+/*
+ * Setup
+ */
+GT_INLINE gt_input_file_index* gt_input_file_index_new(
+    const uint64_t sampling_rate,const uint64_t lines_per_record,const bool bgzf);
+GT_INLINE void gt_input_file_index_delete(gt_input_file_index* const index);
+GT_INLINE char* gt_input_file_index_get_file_name(const char* const file_name); // "<file_name>.gti" (Freed by caller)
+
+/*
+ * Building
+ *   Records are delimited counting lines (@lines_per_record) over the bytes scanned, in order
+ */
+GT_INLINE void gt_input_file_index_scan(gt_input_file_index* const index,const uint8_t* const data,const uint64_t length);
+
+/*
+ * Index I/O
+ */
+GT_INLINE void gt_input_file_index_save(gt_input_file_index* const index,const char* const source_file_name); // Into "<source_file_name>.gti"
+GT_INLINE gt_input_file_index* gt_input_file_index_load(const char* const file_name);
+
+#endif /* GT_INPUT_FILE_INDEX_H_ */
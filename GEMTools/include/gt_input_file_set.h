@@ -0,0 +1,73 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_input_file_set.h
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Set of input files (shards) read as a single logical input.
+ *   All the files share the block ID generator, so the block IDs (and the sorted output) are global.
+ *   Concatenated sets also share the read lock, so the block IDs follow the order of the files
+ */
+
+#ifndef GT_INPUT_FILE_SET_H_
+#define GT_INPUT_FILE_SET_H_
+
+#include "gt_essentials.h"
+#include "gt_input_file.h"
+
+/*
+ * Checkers
+ */
+#define GT_INPUT_FILE_SET_CHECK(input_file_set) \
+  GT_NULL_CHECK(input_file_set); \
+  GT_VECTOR_CHECK(input_file_set->shards)
+
+/*
+ * Input file set
+ *   Concatenated: Readers go through the files in order (output as if the files were catted)
+ *   Sharded: Readers spread over the files (each reader sticks to one file until it's exhausted)
+ */
+typedef struct {
+  char* file_name;
+  gt_input_file* input_file; // NULL if not opened yet (or already closed)
+  uint64_t num_readers;
+  bool exhausted;
+} gt_input_file_shard;
+typedef struct {
+  gt_vector* shards; // (gt_input_file_shard)
+  bool mmap_files;
+  bool sharded;
+  bool owned_files;  // Files opened (and closed) by the set
+  gt_file_format file_format;
+  /* ID generator (shared by all files) */
+  uint64_t processed_id;
+  pthread_mutex_t read_mutex; // Concatenated. Reads of all the files (a block and its ID at once)
+  pthread_mutex_t set_mutex;
+} gt_input_file_set;
+
+/*
+ * Setup
+ *   Only the first file is opened upfront (it determines the format of the set),
+ *   the rest are opened on demand and closed as soon as they are exhausted
+ */
+gt_input_file_set* gt_input_file_set_open(
+    char** const file_names,const uint64_t num_files,const bool mmap_files,const bool sharded);
+gt_input_file_set* gt_input_file_set_open_glob(char* const pattern,const bool mmap_files,const bool sharded);
+gt_input_file_set* gt_input_file_set_new(
+    gt_input_file** const input_files,const uint64_t num_files,const bool sharded); // Already opened (not owned)
+void gt_input_file_set_close(gt_input_file_set* const input_file_set);
+
+/* Accessors */
+GT_INLINE uint64_t gt_input_file_set_get_num_files(gt_input_file_set* const input_file_set);
+GT_INLINE gt_input_file* gt_input_file_set_get_file(gt_input_file_set* const input_file_set); // First file
+GT_INLINE bool gt_input_file_set_is_pattern(char* const file_name); // List (comma separated) or glob pattern
+
+/*
+ * Readers
+ *   gt_input_file_set_acquire() hands out a file to a new reader (never NULL)
+ *   gt_input_file_set_next() moves a reader to the next file (NULL if there is none left)
+ */
+GT_INLINE gt_input_file* gt_input_file_set_acquire(gt_input_file_set* const input_file_set);
+GT_INLINE gt_input_file* gt_input_file_set_next(gt_input_file_set* const input_file_set,gt_input_file* const input_file);
+GT_INLINE void gt_input_file_set_release(gt_input_file_set* const input_file_set,gt_input_file* const input_file);
+
+#endif /* GT_INPUT_FILE_SET_H_ */
@@ -3,7 +3,7 @@
  * FILE: gt_input_generic_parser.h
  * DATE: 28/01/2013
  * AUTHOR(S): Santiago Marco-Sola <santiagomsola@gmail.com>
- * DESCRIPTION: Generic parser for {MAP,SAM,FASTQ}
+ * DESCRIPTION: Generic parser for {MAP,SAM,BAM,GTB,FASTQ}
  */
 
 #ifndef GT_INPUT_GENERIC_PARSER_H_
@@ -20,6 +20,8 @@
 #include "gt_input_fasta_parser.h"
 #include "gt_input_map_parser.h"
 #include "gt_input_sam_parser.h"
+#include "gt_input_bam_parser.h"
+#include "gt_input_gtb_parser.h"
 
 #define GT_IGP_FAIL -1
 #define GT_IGP_EOF 0
@@ -0,0 +1,97 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_input_gtb_parser.h
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Input parser for GTB format (compact binary MAP, see gt_output_gtb.h).
+ *   Each GTB block is read as one buffered block; records are decoded straight into templates/alignments
+ */
+
+#ifndef GT_INPUT_GTB_PARSER_H_
+#define GT_INPUT_GTB_PARSER_H_
+
+#include "gt_commons.h"
+#include "gt_template_utils.h"
+
+#include "gt_input_file.h"
+#include "gt_buffered_input_file.h"
+#include "gt_input_parser.h"
+#include "gt_input_map_parser.h"
+
+// Codes gt_status
+#define GT_IGTB_OK   GT_STATUS_OK
+#define GT_IGTB_FAIL GT_STATUS_FAIL
+#define GT_IGTB_EOF  0
+
+/*
+ * Parsing error/state codes
+ */
+#define GT_IGTB_PE_WRONG_FILE_FORMAT 10
+#define GT_IGTB_PE_BAD_VERSION 11
+#define GT_IGTB_PE_TRUNCATED_BLOCK 12
+#define GT_IGTB_PE_CORRUPTED_BLOCK 13
+#define GT_IGTB_PE_CORRUPTED_RECORD 14
+#define GT_IGTB_PE_BAD_CONTIG 15
+#define GT_IGTB_PE_NOT_SE 16
+
+/*
+ * GTB file format constants
+ *   File := Block*
+ *   Block := magic[3] "GTB" | version[1] | payload_size (uint32) | num_templates (uint32) | payload[payload_size]
+ *   Payload := { varint(length<<1|kind) | entry[length] }*
+ *     kind=0 Template record
+ *     kind=1 Contig definition (name). Contigs are numbered in order of definition within the block
+ *            and defined before the first record referencing them (blocks are self-contained)
+ *   Fixed-size integers are little-endian, varints are LEB128 (signed values zig-zag encoded)
+ *
+ *   Template record
+ *     num_blocks | { tag_length | tag } (MAP TAG text, TAB terminated)
+ *     { read_length | read | qualities_length | qualities }*num_blocks
+ *     flags | mcs+1 (0 if none) | num_counters | counter*
+ *     { num_maps | Map* }*num_blocks
+ *     num_blocks>1 => num_mmaps | { end_ref*num_blocks | distance | gt_score+1 | phred_score[1] }*
+ *       end_ref := 0 (NULL) | 1 (Map follows inline) | 2+i (i-th map of the end)
+ *   Map (blocks chained)
+ *     contig | flags[1] (strand,has_next,junction) | zigzag(position-last_position) | base_length |
+ *     gt_score+1 (0 if none) | phred_score[1] | num_misms | { zigzag(position-last_position)<<2|type | base[1]|size }* |
+ *     has_next => zigzag(junction_size) | Map
+ */
+#define GT_GTB_MAGIC "GTB"
+#define GT_GTB_MAGIC_LENGTH 3
+#define GT_GTB_VERSION 1
+#define GT_GTB_BLOCK_HEADER_SIZE 12
+#define GT_GTB_BLOCK_PAYLOAD_SIZE 4
+#define GT_GTB_BLOCK_NUM_TEMPLATES 8
+// Entries
+#define GT_GTB_ENTRY_TEMPLATE 0
+#define GT_GTB_ENTRY_CONTIG   1
+// Template record flags
+#define GT_GTB_RECORD_NOT_UNIQUE 1
+// Map flags
+#define GT_GTB_MAP_STRAND_MASK    3
+#define GT_GTB_MAP_HAS_NEXT       4
+#define GT_GTB_MAP_JUNCTION_SHIFT 3
+// MMap end references
+#define GT_GTB_MMAP_END_NULL   0
+#define GT_GTB_MMAP_END_INLINE 1
+#define GT_GTB_MMAP_END_MAP    2
+// Optional values (stored +1)
+#define GT_GTB_NONE 0
+
+/*
+ * GTB File basics
+ */
+GT_INLINE bool gt_input_file_test_gtb(gt_input_file* const input_file,const bool show_errors);
+GT_INLINE void gt_input_gtb_parser_prompt_error(
+    gt_buffered_input_file* const buffered_gtb_input,const uint64_t record_num,const gt_status error_code);
+GT_INLINE void gt_input_gtb_parser_next_record(gt_buffered_input_file* const buffered_gtb_input);
+
+/*
+ * High Level Parsers
+ */
+GT_INLINE gt_status gt_input_gtb_parser_get_template(
+    gt_buffered_input_file* const buffered_gtb_input,gt_template* const template,gt_map_parser_attributes* map_parser_attr);
+GT_INLINE gt_status gt_input_gtb_parser_get_alignment(
+    gt_buffered_input_file* const buffered_gtb_input,gt_alignment* const alignment,gt_map_parser_attributes* map_parser_attr);
+
+#endif /* GT_INPUT_GTB_PARSER_H_ */
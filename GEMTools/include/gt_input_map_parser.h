@@ -23,6 +23,8 @@
 
 #include "gt_template.h"
 #include "gt_template_utils.h"
+#include "gt_map_arena.h"
+#include "gt_map_table.h"
 
 /*
  * Codes gt_status
@@ -118,8 +120,12 @@ typedef struct {
   uint64_t max_parsed_maps; // Maximum number of maps to be parsed
   bool skip_based_model; // Allows only mismatches & skips in the cigar string
   bool remove_duplicates; // Instead of strictly parse the record, tries to merge duplicates (sort of cleanup in case of bugs ...)
+  bool lazy_maps; // Maps are just counted and decoded on demand, when accessed (see gt_lazy_maps)
   /* Auxiliary Buffers */
   gt_string* src_text; // Source text line parsed (parsing from file)
+  /* Memory */
+  gt_map_arena* map_arena; // Maps taken from the arena (cleared on each record read from file). NULL => gt_map_new()
+  bool read_views; // Read/qualities are views of the input buffer (valid until the next record is read from file)
 } gt_map_parser_attributes;
 #define GT_MAP_PARSER_ATTR_DEFAULT(_force_read_paired) { \
   /* PE/SE */ \
@@ -128,8 +134,12 @@ typedef struct {
   .max_parsed_maps=GT_ALL,  \
   .skip_based_model=false, \
   .remove_duplicates=false, \
+  .lazy_maps=false, \
   /* Auxiliary Buffers */ \
   .src_text=NULL, \
+  /* Memory */ \
+  .map_arena=NULL, \
+  .read_views=false, \
 }
 #define GT_MAP_PARSER_CHECK_ATTRIBUTES(attributes) \
   gt_map_parser_attributes __##attributes; \
@@ -149,6 +159,9 @@ GT_INLINE void gt_input_map_parser_attributes_set_max_parsed_maps(gt_map_parser_
 GT_INLINE void gt_input_map_parser_attributes_set_src_text(gt_map_parser_attributes* const attributes,gt_string* const src_text);
 GT_INLINE void gt_input_map_parser_attributes_set_skip_model(gt_map_parser_attributes* const attributes,const bool skip_based_model);
 GT_INLINE void gt_input_map_parser_attributes_set_duplicates_removal(gt_map_parser_attributes* const attributes,const bool remove_duplicates);
+GT_INLINE void gt_input_map_parser_attributes_set_map_arena(gt_map_parser_attributes* const attributes,gt_map_arena* const map_arena);
+GT_INLINE void gt_input_map_parser_attributes_set_read_views(gt_map_parser_attributes* const attributes,const bool read_views);
+GT_INLINE void gt_input_map_parser_attributes_set_lazy_maps(gt_map_parser_attributes* const attributes,const bool lazy_maps);
 
 /*
  * MAP File basics
@@ -182,6 +195,15 @@ GT_INLINE gt_status gt_input_map_parser_get_template(
     gt_buffered_input_file* const buffered_map_input,gt_template* const template,gt_map_parser_attributes* map_parser_attr);
 GT_INLINE gt_status gt_input_map_parser_get_alignment(
     gt_buffered_input_file* const buffered_map_input,gt_alignment* const alignment,gt_map_parser_attributes* map_parser_attr);
+/*
+ * MAP Map-Table Parser
+ *   Parses the next record, appending its maps to @map_table (@template just gets the tag/reads/counters).
+ *   With a map arena (gt_input_map_parser_attributes_set_map_arena) no gt_map is ever allocated,
+ *   they are parsed into the arena's scratch maps, recycled on the next record
+ */
+GT_INLINE gt_status gt_input_map_parser_get_map_table(
+    gt_buffered_input_file* const buffered_map_input,gt_template* const template,
+    gt_map_table* const map_table,gt_map_parser_attributes* map_parser_attr);
 
 /*
  * Synch read of blocks
@@ -73,4 +73,31 @@ GT_INLINE uint64_t gt_input_parse_tag_chomp_pairend_info(gt_string* const tag);
     ++(*text_line); \
   }
 
+/*
+ * Field Index
+ *   Locates the separators of the first fields of a line in a single (vectorized) pass.
+ *   Field i spans [begin(i),end(i)), being end(i) the separator that closes it (@separator, or
+ *   the terminator of the line/field: EOL/EOS, and also TAB if @separator is not TAB)
+ */
+#define GT_FIELD_INDEX_MAX_FIELDS 16
+typedef struct {
+  char* line;
+  uint64_t num_fields;
+  uint32_t field_end[GT_FIELD_INDEX_MAX_FIELDS]; // Offset of the separator closing each field
+} gt_field_index;
+
+GT_INLINE uint64_t gt_input_field_index_build(
+    gt_field_index* const field_index,char* const line,const char separator,const uint64_t max_fields);
+#define gt_field_index_get_begin(field_index,field_num) \
+  ((field_num)==0 ? (field_index)->line : (field_index)->line+(field_index)->field_end[(field_num)-1]+1)
+#define gt_field_index_get_end(field_index,field_num) ((field_index)->line+(field_index)->field_end[(field_num)])
+#define gt_field_index_get_length(field_index,field_num) \
+  ((uint64_t)(gt_field_index_get_end(field_index,field_num)-gt_field_index_get_begin(field_index,field_num)))
+
+/*
+ * Number parsing (whole field, 8 digits at a time)
+ *   Returns false if the field is empty or has non-digit characters
+ */
+GT_INLINE bool gt_input_parse_field_number(const char* const field,const uint64_t length,uint64_t* const number);
+
 #endif /* GT_INPUT_PARSER_H_ */
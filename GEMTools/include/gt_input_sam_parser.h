@@ -78,4 +78,37 @@ GT_INLINE gt_status gt_input_sam_parser_get_template(
 GT_INLINE gt_status gt_input_sam_parser_get_alignment(
     gt_buffered_input_file* const buffered_map_input,gt_alignment* const alignment,gt_sam_parser_attributes* const attributes);
 
+/*
+ * SAM parsing building blocks (shared with the BAM parser)
+ */
+// Pair-pending end
+typedef struct {
+  // Current map info
+  gt_string map_seq_name;
+  uint64_t map_position;
+  uint64_t end_position; // 0/1
+  // Next map info
+  gt_string next_seq_name;
+  uint64_t next_position;
+  // Map location and span info
+  uint64_t map_displacement; // In alignment's map vector
+  uint64_t num_maps; // Maps in the vector coupled to the first one
+} gt_sam_pending_end;
+#define GT_SAM_INIT_PENDING { .map_seq_name.allocated=0, .next_seq_name.allocated=0 }
+
+// CIGAR operations (@map_block is the block being built; a split (N) opens the next one)
+GT_INLINE gt_status gt_isp_cigar_add_op(
+    gt_map** const map_block,const char op_char,const uint64_t length,
+    uint64_t* const position,uint64_t* const reference_span,const bool reverse_strand);
+GT_INLINE void gt_isp_cigar_close(
+    gt_map** const _map,gt_map* const map_block,const uint64_t position,const bool reverse_strand);
+// BWA alternative hits (@text_line points to the value of the XA:Z field)
+GT_INLINE gt_status gt_isp_parse_sam_opt_xa_bwa(
+    char** const text_line,gt_alignment* const alignment,
+    gt_vector* const maps_vector,gt_sam_pending_end* const pending);
+// Pairing
+GT_INLINE void gt_isp_solve_pending_maps(
+    gt_vector* pending_v,gt_sam_pending_end* pending,gt_template* const template);
+GT_INLINE gt_status gt_isp_solve_remaining_maps(gt_vector* const pending_v,gt_template* const template);
+
 #endif /* GT_INPUT_SAM_PARSER_H_ */
@@ -14,6 +14,7 @@
 
 #include "gt_misms.h"
 #include "gt_dna_string.h"
+#include "gt_seq_name_table.h"
 
 /*
  * Constants
@@ -38,7 +39,7 @@ typedef struct {
  */
 struct _gt_map {
   /* Sequence-name(Chromosome/Contig/...), position and strand */
-  gt_string* seq_name;
+  uint32_t seq_name_id; // Interned (gt_seq_name_table)
   uint64_t position;
   uint64_t base_length; // Length not including indels
   gt_strand strand;
@@ -51,6 +52,8 @@ struct _gt_map {
   gt_map_junction next_block;
   /* Attributes */
   gt_attributes* attributes;
+  /* Memory */
+  bool arena_allocated; // Owned by a gt_map_arena (recycled, never freed on its own)
 };
 
 // Iterators
@@ -92,6 +95,7 @@ typedef struct {
  */
 GT_INLINE gt_map* gt_map_new(void);
 GT_INLINE void gt_map_clear(gt_map* const map);
+GT_INLINE void gt_map_block_delete(gt_map* const map);
 GT_INLINE void gt_map_delete(gt_map* const map);
 
 /*
@@ -99,7 +103,9 @@ GT_INLINE void gt_map_delete(gt_map* const map);
  */
 GT_INLINE char* gt_map_get_seq_name(gt_map* const map);
 GT_INLINE uint64_t gt_map_get_seq_name_length(gt_map* const map);
-GT_INLINE gt_string* gt_map_get_string_seq_name(gt_map* const map);
+GT_INLINE gt_string* gt_map_get_string_seq_name(gt_map* const map); // Read-only (shared)
+GT_INLINE uint32_t gt_map_get_seq_name_id(gt_map* const map);
+GT_INLINE void gt_map_set_seq_name_id(gt_map* const map,const uint32_t seq_name_id);
 GT_INLINE void gt_map_set_seq_name(gt_map* const map,const char* const seq_name,const uint64_t length);
 GT_INLINE void gt_map_set_string_seq_name(gt_map* const map,gt_string* const seq_name);
 GT_INLINE gt_strand gt_map_get_strand(gt_map* const map);
@@ -189,7 +195,7 @@ GT_INLINE void gt_map_reverse_misms(gt_map* const map);
  *   This concept is essential as to handle properly QUIMERAS
  */
 #define GT_MAP_IS_SAME_SEGMENT(map_1,map_2) \
-  (gt_string_equals(gt_map_get_string_seq_name(map_1),gt_map_get_string_seq_name(map_2)) && \
+  (gt_map_get_seq_name_id(map_1)==gt_map_get_seq_name_id(map_2) && \
    gt_map_get_strand(map_1)==gt_map_get_strand(map_2))
 GT_INLINE uint64_t gt_map_segment_get_num_segments(gt_map* const map);
 GT_INLINE gt_map* gt_map_segment_get_next_block(gt_map* const map);
@@ -0,0 +1,53 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_map_arena.h
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Per-thread arena of maps for parsing.
+ *   Maps handed out by the arena (together with their seq_name, mismatches and attributes) are never
+ *   freed, but recycled once the arena is cleared. So, after the first few records, parsing a record
+ *   doesn't call malloc/free at all (and clearing the arena is O(1))
+ */
+
+#ifndef GT_MAP_ARENA_H_
+#define GT_MAP_ARENA_H_
+
+#include "gt_essentials.h"
+#include "gt_map.h"
+
+/*
+ * Checkers
+ */
+#define GT_MAP_ARENA_CHECK(map_arena) \
+  GT_NULL_CHECK(map_arena); \
+  GT_VECTOR_CHECK((map_arena)->maps)
+
+/*
+ * Map Arena
+ */
+typedef struct {
+  gt_vector* maps;    // (gt_map*) All maps allocated so far
+  uint64_t next_map;  // Maps [0,next_map) are in use
+} gt_map_arena;
+
+/*
+ * Setup
+ *   NOTE: gt_map_delete() is a no-op on maps from the arena (they die with it)
+ */
+GT_INLINE gt_map_arena* gt_map_arena_new(void);
+GT_INLINE void gt_map_arena_clear(gt_map_arena* const map_arena);
+GT_INLINE void gt_map_arena_delete(gt_map_arena* const map_arena);
+
+/*
+ * Allocation
+ *   Returns a clear map (as gt_map_new() does), only valid until the arena is cleared
+ */
+GT_INLINE gt_map* gt_map_arena_alloc(gt_map_arena* const map_arena);
+
+/*
+ * Accessors
+ */
+GT_INLINE uint64_t gt_map_arena_get_num_maps(gt_map_arena* const map_arena); // Maps in use
+GT_INLINE uint64_t gt_map_arena_get_num_allocated(gt_map_arena* const map_arena);
+
+#endif /* GT_MAP_ARENA_H_ */
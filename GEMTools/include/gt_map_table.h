@@ -0,0 +1,110 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_map_table.h
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Compact (structure-of-arrays) read-only view of the maps of templates/alignments.
+ *   Each field is a contiguous column (contig IDs, positions, strands, distances, scores, ...)
+ *   and all the mismatches go to one flat pool. Meant for analytics that just scan the maps,
+ *   which then don't chase next_block pointers nor touch a mismatch vector per map
+ */
+
+#ifndef GT_MAP_TABLE_H_
+#define GT_MAP_TABLE_H_
+
+#include "gt_essentials.h"
+#include "gt_map.h"
+#include "gt_alignment.h"
+#include "gt_template.h"
+
+#define GT_MAP_TABLE_NO_MAP UINT64_MAX // Unpaired end of a mmap
+
+/*
+ * Checkers
+ */
+#define GT_MAP_TABLE_CHECK(map_table) \
+  GT_NULL_CHECK(map_table); \
+  GT_VECTOR_CHECK((map_table)->position); \
+  GT_VECTOR_CHECK((map_table)->block_offset)
+
+/*
+ * Map Table
+ *   Block i has the mismatches misms[misms_offset[i],misms_offset[i+1])
+ *   Map i has the blocks [block_offset[i],block_offset[i+1])
+ *   MMap i pairs the maps mmap_end1[i] and mmap_end2[i]
+ */
+typedef struct {
+  gt_map* map;
+  uint64_t map_num;
+} gt_map_table_map_index;
+typedef struct {
+  /* Map blocks */
+  gt_vector* seq_name_id;     // (uint32_t)
+  gt_vector* position;        // (uint64_t)
+  gt_vector* base_length;     // (uint64_t)
+  gt_vector* strand;          // (uint8_t) gt_strand
+  gt_vector* junction;        // (uint8_t) gt_junction_t to the next block
+  gt_vector* junction_size;   // (int64_t)
+  gt_vector* misms_offset;    // (uint64_t) num_blocks+1
+  /* Maps */
+  gt_vector* block_offset;    // (uint64_t) num_maps+1
+  gt_vector* end_position;    // (uint8_t) 0/1
+  gt_vector* distance;        // (uint64_t) Global distance
+  gt_vector* gt_score;        // (uint64_t)
+  gt_vector* phred_score;     // (uint8_t)
+  /* MMaps */
+  gt_vector* mmap_end1;       // (uint64_t) Map index (or GT_MAP_TABLE_NO_MAP)
+  gt_vector* mmap_end2;       // (uint64_t) Map index (or GT_MAP_TABLE_NO_MAP)
+  gt_vector* mmap_attributes; // (gt_mmap_attributes)
+  /* Mismatches (Flat pool) */
+  gt_vector* misms;           // (gt_misms)
+  /* Internals */
+  gt_vector* map_index;       // (gt_map_table_map_index) Maps of the template being added
+} gt_map_table;
+
+/*
+ * Setup
+ */
+GT_INLINE gt_map_table* gt_map_table_new(void);
+GT_INLINE void gt_map_table_clear(gt_map_table* const map_table);
+GT_INLINE void gt_map_table_delete(gt_map_table* const map_table);
+
+/*
+ * Loading (appends to the table)
+ */
+GT_INLINE uint64_t gt_map_table_add_map(gt_map_table* const map_table,gt_map* const map,const uint64_t end_position);
+GT_INLINE void gt_map_table_add_alignment(gt_map_table* const map_table,gt_alignment* const alignment,const uint64_t end_position);
+GT_INLINE void gt_map_table_add_template(gt_map_table* const map_table,gt_template* const template);
+
+/*
+ * Accessors
+ */
+GT_INLINE uint64_t gt_map_table_get_num_blocks(gt_map_table* const map_table);
+GT_INLINE uint64_t gt_map_table_get_num_maps(gt_map_table* const map_table);
+GT_INLINE uint64_t gt_map_table_get_num_mmaps(gt_map_table* const map_table);
+GT_INLINE uint64_t gt_map_table_get_num_misms(gt_map_table* const map_table);
+// Maps
+GT_INLINE uint64_t gt_map_table_get_map_num_blocks(gt_map_table* const map_table,const uint64_t map_num);
+GT_INLINE uint64_t gt_map_table_get_map_first_block(gt_map_table* const map_table,const uint64_t map_num);
+// Blocks
+GT_INLINE uint64_t gt_map_table_get_block_num_misms(gt_map_table* const map_table,const uint64_t block_num);
+GT_INLINE gt_misms* gt_map_table_get_block_misms(gt_map_table* const map_table,const uint64_t block_num);
+
+/*
+ * Columns (raw arrays, one element per block/map/mmap)
+ */
+#define gt_map_table_get_seq_name_ids(map_table)   gt_vector_get_mem((map_table)->seq_name_id,uint32_t)
+#define gt_map_table_get_positions(map_table)      gt_vector_get_mem((map_table)->position,uint64_t)
+#define gt_map_table_get_base_lengths(map_table)   gt_vector_get_mem((map_table)->base_length,uint64_t)
+#define gt_map_table_get_strands(map_table)        gt_vector_get_mem((map_table)->strand,uint8_t)
+#define gt_map_table_get_junctions(map_table)      gt_vector_get_mem((map_table)->junction,uint8_t)
+#define gt_map_table_get_junction_sizes(map_table) gt_vector_get_mem((map_table)->junction_size,int64_t)
+#define gt_map_table_get_end_positions(map_table)  gt_vector_get_mem((map_table)->end_position,uint8_t)
+#define gt_map_table_get_distances(map_table)      gt_vector_get_mem((map_table)->distance,uint64_t)
+#define gt_map_table_get_gt_scores(map_table)      gt_vector_get_mem((map_table)->gt_score,uint64_t)
+#define gt_map_table_get_phred_scores(map_table)   gt_vector_get_mem((map_table)->phred_score,uint8_t)
+#define gt_map_table_get_mmap_end1(map_table)      gt_vector_get_mem((map_table)->mmap_end1,uint64_t)
+#define gt_map_table_get_mmap_end2(map_table)      gt_vector_get_mem((map_table)->mmap_end2,uint64_t)
+#define gt_map_table_get_mmap_attributes(map_table) gt_vector_get_mem((map_table)->mmap_attributes,gt_mmap_attributes)
+
+#endif /* GT_MAP_TABLE_H_ */
@@ -153,6 +153,57 @@ GT_INLINE void gt_mm_free(gt_mm* const mm);
 GT_INLINE gt_mm* gt_mm_bulk_load_file(char* const file_name,const uint64_t num_threads);
 GT_INLINE gt_mm* gt_mm_bulk_mload_file(char* const file_name,const uint64_t num_threads);
 
+/*
+ * NUMA & Huge Pages (best effort, no-ops where unsupported)
+ *   - Huge pages. Large buffers are backed with 2MB pages (hugetlbfs, or transparent huge pages)
+ *   - NUMA. Per-thread buffers are first touched by their thread (so placed on its node by the
+ *       default local policy). Large buffers read by all threads (archives) are interleaved
+ */
+#define GT_MM_HUGE_PAGE_SIZE (2*1024*1024)
+#define GT_MM_HUGE_PAGE_THRESHOLD (8*GT_MM_HUGE_PAGE_SIZE) /* Buffers worth huge pages */
+#define GT_MM_NUMA_NO_NODE (-1)
+GT_INLINE void gt_mm_advise_huge_pages(void* const memory,const uint64_t num_bytes);
+GT_INLINE uint64_t gt_mm_numa_get_num_nodes(void);
+GT_INLINE int64_t gt_mm_numa_get_node(void); /* Node of the CPU running the calling thread */
+GT_INLINE void gt_mm_numa_interleave(void* const memory,const uint64_t num_bytes);
+GT_INLINE void gt_mm_numa_interleave_thread(const bool interleave); /* Memory first touched by the calling thread */
+
+/*
+ * Memory Accounting & Budget
+ *   Process-wide usage (current & peak) of the big consumers, accounted by the subsystems
+ *   owning the memory (the sizes are known there). Besides, the heap in use is sampled from the
+ *   allocator, so gt_malloc/gt_free memory not accounted by any subsystem is also observed.
+ *   A budget (0 = unbounded) makes the consumers back off when the usage exceeds it
+ *   (smaller input blocks, no new output buffers while others are in flight)
+ */
+typedef enum {
+  GT_MM_ACC_INPUT_BUFFERS,  /* Input files buffers & input blocks */
+  GT_MM_ACC_OUTPUT_BUFFERS, /* Output buffers */
+  GT_MM_ACC_TEMPLATES,      /* Slab units (templates, alignments, maps, ...) */
+  GT_MM_ACC_GTF,            /* GTF annotation entries */
+  GT_MM_ACC_ARCHIVE,        /* Sequence archives (MultiFASTA & BED) */
+  GT_MM_ACC_STATS,          /* Stats counters */
+  GT_MM_ACC_NUM_CATEGORIES
+} gt_mm_acc_category;
+GT_INLINE void gt_mm_acc_add(const gt_mm_acc_category category,const uint64_t num_bytes);
+GT_INLINE void gt_mm_acc_sub(const gt_mm_acc_category category,const uint64_t num_bytes);
+GT_INLINE void gt_mm_acc_resize(const gt_mm_acc_category category,const uint64_t old_num_bytes,const uint64_t new_num_bytes);
+GT_INLINE void gt_mm_acc_update(const gt_mm_acc_category category,uint64_t* const accounted_bytes,const uint64_t num_bytes);
+// Usage
+GT_INLINE uint64_t gt_mm_acc_get_current(const gt_mm_acc_category category);
+GT_INLINE uint64_t gt_mm_acc_get_peak(const gt_mm_acc_category category);
+GT_INLINE uint64_t gt_mm_acc_get_total_current(void);
+GT_INLINE uint64_t gt_mm_acc_get_total_peak(void);
+GT_INLINE uint64_t gt_mm_acc_get_heap_usage(void); /* Heap in use (0 if unknown) */
+GT_INLINE uint64_t gt_mm_acc_get_peak_rss(void);
+// Budget
+GT_INLINE void gt_mm_acc_set_budget(const uint64_t num_bytes);
+GT_INLINE uint64_t gt_mm_acc_get_budget(void);
+GT_INLINE bool gt_mm_acc_is_over_budget(void);
+GT_INLINE bool gt_mm_acc_fits_budget(const uint64_t num_bytes);
+// Display
+GT_INLINE void gt_mm_acc_print(FILE* const stream);
+
 // Accessors
 GT_INLINE void* gt_mm_get_mem(gt_mm* const mm);
 GT_INLINE void* gt_mm_get_base_mem(gt_mm* const mm);
@@ -203,23 +254,49 @@ GT_INLINE void gt_mm_write_mem(gt_mm* const mm,void* const src,const uint64_t nu
  *   Relative big amounts of objects allocated all at once (like the LINUX slab allocator)
  *   Objects of a certain type are ready to go inside the slab, thus reducing
  *   the overhead of malloc/setup/free cycles along the program
+ *     - Units are GT_MM_SLAB_UNIT_SIZE chunks aligned to their size (element => unit in O(1))
+ *     - Allocation is reserved to the thread owning the slab (no locks)
+ *     - Elements can be freed from any thread (other threads queue them lock-free to the owner)
  */
-#define GT_MM_NUM_INITIAL_SLABS 10 /* 1 SysPage => (usually) => 4KB => 514*(uint64_t) */
+#define GT_MM_NUM_INITIAL_SLABS 1
+#define GT_MM_SLAB_UNIT_SIZE (32*1024)
+#define GT_MM_SLAB_MIN_ELEMENT_SIZE 16
+#define GT_MM_SLAB_MAX_EMPTY_UNITS 2 /* Empty units kept by the slab (the rest go back to the pool) */
 typedef enum { GT_SLAB_EMPTY, GT_SLAB_PARTIAL, GT_SLAB_FULL } gt_mm_slab_state;
-typedef struct {
-  void* memory;                 /* Memory chunk of PageSize Bytes */
+typedef struct _gt_mm_slab gt_mm_slab;
+typedef struct _gt_mm_slab_unit gt_mm_slab_unit;
+typedef struct _gt_mm_pool gt_mm_pool;
+struct _gt_mm_slab_unit {
+  gt_mm_slab* slab;             /* Slab owning the unit */
+  void* memory;                 /* Elements (within the same chunk, after the occupancy map) */
   uint64_t* occupancy_map;      /* Bitmap with 1-Allocated/0-Free */
   uint64_t element_size;
   uint64_t total_elements;
   uint64_t allocated_elements;
-} gt_mm_slab_unit;
-typedef struct {
+  uint64_t free_word_hint;      /* No free element before this word of the occupancy map */
+  gt_mm_slab_state state;
+  gt_mm_slab_unit *prev, *next; /* List of units with free elements (EMPTY/PARTIAL) */
+  gt_mm_slab_unit *prev_unit, *next_unit; /* List of all units */
+};
+struct _gt_mm_slab {
   /* Slab Units */
   uint64_t element_size;
-  gt_vector* slabs_units; /* (gt_mm_slab_unit*) */
+  gt_mm_slab_unit* free_units;  /* Units with free elements */
+  gt_mm_slab_unit* units;       /* All units */
+  uint64_t num_units;
+  uint64_t num_empty_units;
+  gt_mm_pool* mm_pool;          /* Pool providing/recycling the units (NULL => system memory) */
+  /* Concurrency */
+  pthread_t owner;              /* Thread allocating from the slab */
+  void* volatile remote_frees;  /* Elements freed by other threads (lock-free stack) */
   /* Internals */
   uint64_t page_size;     /* System Page Size (Constant) */
-} gt_mm_slab;
+};
+
+// Checkers
+#define GT_MM_SLAB_CHECK(slab) \
+  GT_NULL_CHECK(slab); \
+  GT_ZERO_CHECK((slab)->element_size)
 
 #define gt_mm_slab_new(type) (gt_mm_slab_new_(sizeof(type),GT_MM_NUM_INITIAL_SLABS))
 GT_INLINE gt_mm_slab* gt_mm_slab_new_(const uint64_t element_size,const uint64_t num_intial_slabs);
@@ -229,23 +306,79 @@ GT_INLINE void gt_mm_slab_delete(gt_mm_slab* const slab);
 
 GT_INLINE void* gt_mm_slab_malloc(gt_mm_slab* const slab);
 GT_INLINE void gt_mm_slab_free(gt_mm_slab* const slab,void* mem_addr);
+// Contiguous elements (within one unit)
+GT_INLINE void* gt_mm_slab_mmalloc(gt_mm_slab* const slab,const uint64_t num_elements);
+GT_INLINE void gt_mm_slab_mfree(gt_mm_slab* const slab,void* mem_addr,const uint64_t num_elements);
+
+// Slab of any element allocated from a slab
+#define gt_mm_slab_get_unit(mem_addr) ((gt_mm_slab_unit*)(GT_MM_CAST_ADDR(mem_addr) & ~((uintptr_t)GT_MM_SLAB_UNIT_SIZE-1)))
+#define gt_mm_slab_get_slab(mem_addr) (gt_mm_slab_get_unit(mem_addr)->slab)
 
 /*
  * PoolMemory
  *   Pool of Slabs as gather all slabs needed along a program
  *   The goal is to minimize all memory malloc/setup/free overhead
  *   Offers thread safe allocation of slabs as to balance memory consumption across threads
+ *     - The pool keeps the free units (shared by all its instances)
+ *     - Each thread gets its own instance (one slab per size class), so threads never contend
+ *       on allocation. Instances of finished threads are adopted by new threads
+ *     - Each instance also keeps a few recycled objects of the core types (cleared, but with all
+ *       their strings/vectors), so that deleting and creating them again (eg. a template per read)
+ *       doesn't build them from scratch
  */
-typedef struct {
+typedef enum { GT_MM_RECYCLED_TEMPLATE=0, GT_MM_RECYCLED_ALIGNMENT=1 } gt_mm_recycled_t;
+#define GT_MM_POOL_NUM_RECYCLED_TYPES 2
+#define GT_MM_POOL_MAX_RECYCLED 64 /* Recycled objects kept per type (and instance) */
+#define GT_MM_POOL_SIZE_CLASS 16
+#define GT_MM_POOL_NUM_SIZE_CLASSES 16
+#define GT_MM_POOL_MAX_ELEMENT_SIZE (GT_MM_POOL_SIZE_CLASS*GT_MM_POOL_NUM_SIZE_CLASSES) /* Bigger => gt_malloc() */
+#define GT_MM_POOL_MAX_FREE_UNITS 256 /* Free units kept by the pool (the rest go back to the system) */
+struct _gt_mm_pool {
   // Slab Pool
-  gt_vector* free_slabs_units; /* (gt_mm_slab_unit*) */
-
+  gt_vector* free_slabs_units; /* (void*) */
+  gt_vector* free_instances;   /* (gt_mm_pool*) Instances released by finished threads */
+  // Instance
+  gt_mm_pool* parent_pool;     /* Pool of the instance (NULL for the pool itself) */
+  gt_mm_slab* slabs[GT_MM_POOL_NUM_SIZE_CLASSES];
+  void* recycled[GT_MM_POOL_NUM_RECYCLED_TYPES][GT_MM_POOL_MAX_RECYCLED];
+  uint64_t num_recycled[GT_MM_POOL_NUM_RECYCLED_TYPES];
   // Concurrent items
   uint64_t pool_id;
   pthread_mutex_t input_mutex;
-} gt_mm_pool;
+};
 
 GT_INLINE gt_mm_pool* gt_mm_pool_new();
 GT_INLINE gt_mm_pool* gt_mm_pool_get_new_instance(gt_mm_pool* mm_pool);
+GT_INLINE void gt_mm_pool_release_instance(gt_mm_pool* const mm_pool_instance);
+GT_INLINE void gt_mm_pool_delete(gt_mm_pool* const mm_pool);
+
+// Units
+GT_INLINE void* gt_mm_pool_get_unit(gt_mm_pool* const mm_pool);
+GT_INLINE void gt_mm_pool_put_unit(gt_mm_pool* const mm_pool,void* const unit_memory);
+
+// Allocation (from the instance of the calling thread)
+GT_INLINE gt_mm_pool* gt_mm_pool_get_thread_instance(void);
+GT_INLINE void* gt_mm_pool_malloc(const uint64_t num_bytes);
+GT_INLINE void gt_mm_pool_free(void* const mem_addr,const uint64_t num_bytes);
+
+// Recycled objects (of the instance of the calling thread)
+GT_INLINE void* gt_mm_pool_get_recycled(const gt_mm_recycled_t recycled_type); // NULL if none
+GT_INLINE bool gt_mm_pool_put_recycled(const gt_mm_recycled_t recycled_type,void* const object); // False if full
+
+/*
+ * Pooled objects (core objects: templates, alignments, maps, strings, ...)
+ *   Compile with GT_MM_NO_POOL to resort to the system allocator (eg. debugging with valgrind)
+ */
+#ifdef GT_MM_NO_POOL
+  #define gt_pool_alloc(type) gt_alloc(type)
+  #define gt_pool_free(mem_addr,type) gt_free(mem_addr)
+  #define gt_pool_get_recycled(recycled_type) NULL
+  #define gt_pool_put_recycled(recycled_type,object) false
+#else
+  #define gt_pool_alloc(type) ((type*)gt_mm_pool_malloc(sizeof(type)))
+  #define gt_pool_free(mem_addr,type) gt_mm_pool_free(mem_addr,sizeof(type))
+  #define gt_pool_get_recycled(recycled_type) gt_mm_pool_get_recycled(recycled_type)
+  #define gt_pool_put_recycled(recycled_type,object) gt_mm_pool_put_recycled(recycled_type,object)
+#endif
 
 #endif /* GT_MEMORY_MANAGEMENT_H_ */
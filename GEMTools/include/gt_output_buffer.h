@@ -11,6 +11,8 @@
 
 #include "gt_essentials.h"
 
+#define GT_OUTPUT_BUFFER_INITIAL_SIZE GT_BUFFER_SIZE_16M
+
 typedef enum { GT_OUTPUT_BUFFER_FREE, GT_OUTPUT_BUFFER_BUSY, GT_OUTPUT_BUFFER_WRITE_PENDING } gt_output_buffer_state;
 
 typedef struct {
@@ -21,6 +23,8 @@ typedef struct {
   gt_output_buffer_state buffer_state;
   /* Buffer */
   gt_vector* buffer;
+  int64_t numa_node; // Node of the thread that created (first touched) it
+  uint64_t accounted_memory; // Bytes accounted (GT_MM_ACC_OUTPUT_BUFFERS)
 } gt_output_buffer;
 
 /*
@@ -69,5 +73,7 @@ GT_INLINE gt_status gt_vbprintf_(
     const char *template,va_list v_args);
 GT_INLINE gt_status gt_bprintf_(
     gt_output_buffer* const output_buffer,const uint64_t expected_mem_usage,const char *template,...);
+// Binary data
+GT_INLINE gt_status gt_bwrite(gt_output_buffer* const output_buffer,const void* const data,const uint64_t length);
 
 #endif /* GT_OUTPUT_BUFFER_H_ */
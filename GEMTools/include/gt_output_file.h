@@ -11,6 +11,7 @@
 
 #include "gt_essentials.h"
 #include "gt_output_buffer.h"
+#include "gt_input_file_index.h"
 
 #define GT_MAX_OUTPUT_BUFFERS 25
 #define GT_OUTPUT_COMPRESS_BUFFER_SIZE 16384
@@ -34,6 +35,10 @@ typedef struct {
   gt_output_buffer* buffer[GT_MAX_OUTPUT_BUFFERS];
   uint64_t buffer_busy;
   uint64_t buffer_write_pending;
+  uint64_t buffer_releases;        // Buffers released so far
+  uint64_t buffer_budget_waiters;  // Threads holding off a new buffer (over the memory budget)
+  /* Random-access index of the output (NULL if disabled) */
+  gt_input_file_index* index;
   /* Block ID (for synchronization purposes) */
   uint32_t mayor_block_id;
   uint32_t minor_block_id;
@@ -70,11 +75,20 @@ gt_output_file* gt_output_file_new_compress(char* const file_name,const gt_outpu
 #define gt_output_stream_new(file_name,output_file_type) gt_output_stream_new_compress(file_name,output_file_type,NONE)
 gt_status gt_output_file_close(gt_output_file* const output_file);
 
+/*
+ * Output File Index
+ *   Builds a random-access index over everything written; saved as "<file_name>.gti" on close
+ *   (Uncompressed output files only)
+ */
+void gt_output_file_enable_index(
+    gt_output_file* const output_file,const uint64_t lines_per_record,const uint64_t sampling_rate);
+
 /*
  * Output File Printers
  */
 GT_INLINE gt_status gt_vofprintf(gt_output_file* const output_file,const char *template,va_list v_args);
 GT_INLINE gt_status gt_ofprintf(gt_output_file* const output_file,const char *template,...);
+GT_INLINE gt_status gt_ofwrite(gt_output_file* const output_file,const void* const data,const uint64_t length); // Binary
 
 /*
  * Internal Buffers Accessors
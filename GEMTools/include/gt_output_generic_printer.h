@@ -3,7 +3,7 @@
  * FILE: gt_output_generic_printer.h
  * DATE: 28/01/2013
  * AUTHOR(S): Santiago Marco-Sola <santiagomsola@gmail.com>
- * DESCRIPTION: Generic printer for {FASTA,FASTQ,MAP,SAM}
+ * DESCRIPTION: Generic printer for {FASTA,FASTQ,MAP,SAM,GTB}
  */
 
 #ifndef GT_OUTPUT_GENERIC_PRINTER_H_
@@ -19,6 +19,7 @@
 #include "gt_output_fasta.h"
 #include "gt_output_map.h"
 #include "gt_output_sam.h"
+#include "gt_output_gtb.h"
 
 
 /*
@@ -31,6 +32,7 @@ typedef struct {
   gt_output_map_attributes *output_map_attributes;
   gt_output_sam_attributes *output_sam_attributes;
   gt_output_fasta_attributes *output_fasta_attributes;
+  gt_output_gtb_attributes *output_gtb_attributes;
 } gt_generic_printer_attributes;
 
 GT_INLINE gt_generic_printer_attributes* gt_generic_printer_attributes_new(const gt_file_format file_format);
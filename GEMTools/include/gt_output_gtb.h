@@ -0,0 +1,52 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_output_gtb.h
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Output printers for GTB format (compact binary MAP; layout in gt_input_gtb_parser.h)
+ *   Templates printed into an output buffer (BUFFER/BOF printers) are appended to the block open in
+ *   that buffer, as long as nothing else was printed in between. Other printers write one block per call
+ */
+
+#ifndef GT_OUTPUT_GTB_H_
+#define GT_OUTPUT_GTB_H_
+
+#include "gt_essentials.h"
+#include "gt_template.h"
+
+#include "gt_generic_printer.h"
+#include "gt_buffered_output_file.h"
+#include "gt_output_map.h"
+
+/*
+ * Output attributes (Keep the state of the open block. One per thread/printer)
+ */
+typedef struct {
+  /* Open block */
+  gt_vector* block_buffer; // Buffer holding the open block (NULL if none)
+  uint64_t block_id;       // Block IDs of the output buffer when the block was opened
+  uint64_t block_offset;   // Offset of the block header within @block_buffer
+  uint64_t block_end;      // Used bytes of @block_buffer after the last record
+  uint32_t num_templates;
+  /* Block dictionary */
+  gt_vector* contig_ids;   /* (uint32_t) Contig ID+1 in the open block, indexed by seq_name_id (0 if not defined) */
+  gt_vector* block_contigs; /* (uint32_t) seq_name_ids defined in the open block */
+  /* Buffers */
+  gt_vector* record; /* (uint8_t) */
+  gt_vector* block;  /* (uint8_t) Whole block (Printers other than BUFFER/BOF) */
+  gt_string* tag;
+} gt_output_gtb_attributes;
+
+GT_INLINE gt_output_gtb_attributes* gt_output_gtb_attributes_new(void);
+GT_INLINE void gt_output_gtb_attributes_delete(gt_output_gtb_attributes* const attributes);
+GT_INLINE void gt_output_gtb_attributes_reset(gt_output_gtb_attributes* const attributes); // Close the open block
+
+/*
+ * GTB Printers
+ */
+GT_GENERIC_PRINTER_PROTOTYPE(gt_output_gtb,print_template,
+    gt_template* const template,gt_output_gtb_attributes* const attributes);
+GT_GENERIC_PRINTER_PROTOTYPE(gt_output_gtb,print_alignment,
+    gt_alignment* const alignment,gt_output_gtb_attributes* const attributes);
+
+#endif /* GT_OUTPUT_GTB_H_ */
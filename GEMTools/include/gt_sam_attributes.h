@@ -54,6 +54,17 @@ typedef struct {
   gt_vector* comments; // @ CO /* (gt_string*) */
 } gt_sam_headers; // SAM Headers
 
+/*
+ * BAM File specifics (Binary header)
+ */
+typedef struct {
+  gt_vector* reference_ids; // (uint32_t) Interned reference names (indexed by refID)
+  gt_vector* next_record;   // (uint8_t) Record read ahead as to synchronize blocks wrt the QNAME (empty if none)
+} gt_bam_headers;
+
+GT_INLINE void gt_bam_headers_init(gt_bam_headers* const bam_headers);
+GT_INLINE void gt_bam_headers_destroy(gt_bam_headers* const bam_headers);
+
 GT_INLINE gt_sam_headers* gt_sam_header_new(void);
 GT_INLINE void gt_sam_header_clear(gt_sam_headers* const sam_headers);
 GT_INLINE void gt_sam_header_delete(gt_sam_headers* const sam_headers);
@@ -0,0 +1,76 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_seq_name_table.h
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Table of interned sequence names (Chromosome/Contig/...).
+ *   Each distinct name gets a small integer ID, so maps only store the ID and
+ *   comparing/hashing sequence names becomes an integer operation.
+ *   Thread safe. Lookups of names already in the table (ID->name and name->ID) take no lock,
+ *   only adding a new name does (names are never removed, and their memory never moves)
+ */
+
+#ifndef GT_SEQ_NAME_TABLE_H_
+#define GT_SEQ_NAME_TABLE_H_
+
+#include "gt_essentials.h"
+
+#define GT_SEQ_NAME_TABLE_CHUNK_BITS 12
+#define GT_SEQ_NAME_TABLE_CHUNK_SIZE (1ull<<GT_SEQ_NAME_TABLE_CHUNK_BITS)
+#define GT_SEQ_NAME_TABLE_MAX_CHUNKS 4096  // Up to 16M distinct names
+#define GT_SEQ_NAME_TABLE_INITIAL_SLOTS 1024
+
+#define GT_SEQ_NAME_NULL_ID 0 // Empty name ("")
+
+/*
+ * Checkers
+ */
+#define GT_SEQ_NAME_TABLE_CHECK(seq_name_table) \
+  GT_NULL_CHECK(seq_name_table); \
+  GT_NULL_CHECK((seq_name_table)->index)
+#define GT_SEQ_NAME_TABLE_CHECK_ID(seq_name_table,seq_name_id) \
+  gt_fatal_check((seq_name_id)>=(seq_name_table)->num_names,SEQ_NAME_TABLE_ID,(uint64_t)(seq_name_id))
+
+/*
+ * Sequence-name table
+ */
+typedef struct {
+  uint64_t num_slots;
+  volatile uint64_t slots[]; // {hash_tag[63:32],ID+1[31:0]} (0 if empty)
+} gt_seq_name_index;
+typedef struct {
+  /* Names (ID->name) */
+  gt_string* chunks[GT_SEQ_NAME_TABLE_MAX_CHUNKS];
+  volatile uint64_t num_names;
+  /* Index (name->ID). Open addressing, linear probing */
+  gt_seq_name_index* volatile index;
+  gt_vector* retired_indexes; // (gt_seq_name_index*) Outgrown, readers might still be probing them
+  pthread_mutex_t table_mutex;
+} gt_seq_name_table;
+
+/*
+ * Setup
+ */
+GT_INLINE gt_seq_name_table* gt_seq_name_table_new(void);
+GT_INLINE void gt_seq_name_table_delete(gt_seq_name_table* const seq_name_table);
+
+/*
+ * Accessors
+ */
+GT_INLINE uint32_t gt_seq_name_table_get_id(
+    gt_seq_name_table* const seq_name_table,const char* const name,const uint64_t length); // Interns @name
+GT_INLINE gt_string* gt_seq_name_table_get_string(gt_seq_name_table* const seq_name_table,const uint32_t seq_name_id);
+GT_INLINE uint64_t gt_seq_name_table_get_num_names(gt_seq_name_table* const seq_name_table);
+GT_INLINE int64_t gt_seq_name_table_cmp(
+    gt_seq_name_table* const seq_name_table,const uint32_t seq_name_id_a,const uint32_t seq_name_id_b); // Lexicographic
+
+/*
+ * Global table (shared by all maps)
+ *   NOTE: Strings returned are read-only
+ */
+GT_INLINE gt_seq_name_table* gt_seq_name_table_get_global(void);
+#define gt_seq_name_intern(name,length) gt_seq_name_table_get_id(gt_seq_name_table_get_global(),name,length)
+#define gt_seq_name_get_string(seq_name_id) gt_seq_name_table_get_string(gt_seq_name_table_get_global(),seq_name_id)
+#define gt_seq_name_cmp(seq_name_id_a,seq_name_id_b) gt_seq_name_table_cmp(gt_seq_name_table_get_global(),seq_name_id_a,seq_name_id_b)
+
+#endif /* GT_SEQ_NAME_TABLE_H_ */
@@ -37,7 +37,8 @@ typedef struct {
 
 typedef struct {
   gt_sequence_archive* sequence_archive;
-  gt_shash_element *shash_it;
+  gt_shash_iterator shash_it;
+  bool shash_it_eos;
 } gt_sequence_archive_iterator;
 
 /*
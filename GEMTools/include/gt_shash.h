@@ -10,27 +10,41 @@
 #define GT_SHASH_H_
 
 #include "gt_hash.h"
-#include "uthash.h"
+
+#define GT_SHASH_KEYS_INITIAL_CHUNK_SIZE 256
+#define GT_SHASH_KEYS_MAX_CHUNK_SIZE (64*1024)
 
 /*
  * String Key Hash
+ *   Elements are stored in a dense array (insertion order) indexed by an open-addressing
+ *   table (gt_hash_index). Keys are packed into chunks owned by the shash (they never move,
+ *   so pointers to them stay valid until the shash is cleared). NOTE: Pointers to the
+ *   gt_shash_element are only valid until the next insertion into the same shash
  */
 typedef struct {
-  char* key;
+  char* key;                  // NULL if removed
   void* element;
   gt_hash_element_type element_type;
-  //union {
-    size_t element_size;
-    gt_hash_element_setup element_setup;
-  //};
-  UT_hash_handle hh;
+  uint32_t key_length;
+  size_t element_size;
+  gt_hash_element_setup element_setup;
+  uint64_t hash;
 } gt_shash_element;
 typedef struct {
-  gt_shash_element* shash_head;
+  gt_shash_element* elements; // Dense array (insertion order)
+  uint64_t elements_used;     // Including removed
+  uint64_t elements_allocated;
+  uint64_t num_elements;
+  gt_hash_index index;
+  /* Keys */
+  char* keys_chunk;           // Current chunk (begins with a pointer to the previous one)
+  uint64_t keys_chunk_used;
+  uint64_t keys_chunk_size;
 } gt_shash;
 typedef struct {
-  gt_shash_element* shash;
-  gt_shash_element* next;
+  gt_shash* shash;
+  uint64_t next;              // Position of the next element to visit
+  gt_shash_element* current;
 } gt_shash_iterator;
 
 /*
@@ -68,34 +82,39 @@ GT_INLINE uint64_t gt_shash_get_num_elements(gt_shash* const shash);
  */
 GT_INLINE gt_shash* gt_shash_dup(gt_shash* const shash);
 GT_INLINE void gt_shash_copy(gt_shash* const shash_dst,gt_shash* const shash_src);
+GT_INLINE void gt_shash_sort_by_key(gt_shash* const shash,int (*key_cmp_fx)(char*,char*));
 
 /*
  * Iterator
+ *   Elements can be removed while iterating, but not inserted into the same shash
  */
-#define GT_SHASH_BEGIN_ITERATE(shash,it_skey,it_element,type) { \
-  gt_shash_element *shash_##sh_element, *shash_##tmp; \
-  HASH_ITER(hh,shash->shash_head,shash_##sh_element,shash_##tmp) { \
+#define GT_SHASH_BEGIN_ELEMENT_ITERATE_(shash) { \
+  uint64_t shash_##it_pos; \
+  for (shash_##it_pos=0;shash_##it_pos<(shash)->elements_used;++shash_##it_pos) { \
+    gt_shash_element* const shash_##sh_element = (shash)->elements+shash_##it_pos; \
+    if (shash_##sh_element->key==NULL) continue;
+
+#define GT_SHASH_BEGIN_ITERATE(shash,it_skey,it_element,type) \
+  GT_SHASH_BEGIN_ELEMENT_ITERATE_(shash) \
     type* const it_element = (type*)(shash_##sh_element->element); \
     char* const it_skey = shash_##sh_element->key;
 
-#define GT_SHASH_BEGIN_ELEMENT_ITERATE(shash,it_element,type) { \
-  gt_shash_element *shash_##sh_element, *shash_##tmp; \
-  HASH_ITER(hh,shash->shash_head,shash_##sh_element,shash_##tmp) { \
+#define GT_SHASH_BEGIN_ELEMENT_ITERATE(shash,it_element,type) \
+  GT_SHASH_BEGIN_ELEMENT_ITERATE_(shash) \
     type* const it_element = (type*)(shash_##sh_element->element);
 
-#define GT_SHASH_BEGIN_KEY_ITERATE(shash,it_skey) { \
-  gt_shash_element *shash_##sh_element, *shash_##tmp; \
-  HASH_ITER(hh,shash->shash_head,shash_##sh_element,shash_##tmp) { \
+#define GT_SHASH_BEGIN_KEY_ITERATE(shash,it_skey) \
+  GT_SHASH_BEGIN_ELEMENT_ITERATE_(shash) \
     char* const it_skey = shash_##sh_element->key;
 
 #define GT_SHASH_END_ITERATE }}
 
 GT_INLINE gt_shash_iterator* gt_shash_iterator_new(gt_shash* const shash);
+GT_INLINE void gt_shash_iterator_init(gt_shash_iterator* const shash_iterator,gt_shash* const shash);
 GT_INLINE void gt_shash_iterator_delete(gt_shash_iterator* const shash_iterator);
 
-GT_INLINE bool gt_shash_iterator_next(gt_shash_iterator* const shash_iterator);
+GT_INLINE bool gt_shash_iterator_next(gt_shash_iterator* const shash_iterator); // Moves to the next element (false if none)
 GT_INLINE char* gt_shash_iterator_get_key(gt_shash_iterator* const shash_iterator);
 GT_INLINE void* gt_shash_iterator_get_element(gt_shash_iterator* const shash_iterator);
 
-
 #endif /* GT_SHASH_H_ */
@@ -5,7 +5,10 @@
  * AUTHOR(S): Santiago Marco-Sola <santiagomsola@gmail.com>
  * DESCRIPTION: Simple string implementation.
  *   Static stings gt_string_new(0), which share memory across instances (stores mem ptr)
- *   Dynamic strings gt_string_new(n>0), which handle their own memory and hold copy of the string
+ *   Dynamic strings gt_string_new(n>0), which handle their own memory and hold copy of the string.
+ *     Short ones (up to GT_STRING_INLINE_SIZE bytes) are kept inline, within the gt_string itself.
+ *     A dynamic string can also be set as a view of external memory (gt_string_set_view), which
+ *     is not copied (nor EOS terminated) until the string is modified through this API
  */
 
 #ifndef GT_STRING_H_
@@ -14,10 +17,14 @@
 #include "gt_commons.h"
 #include "gt_error.h"
 
+#define GT_STRING_INLINE_SIZE 48
+
 typedef struct {
-  char* buffer;
-  uint64_t allocated;
+  char* buffer;       // Contents (@memory, or external memory if the string is a view)
+  uint64_t allocated; // Size of @memory (0 if static)
   uint64_t length;
+  char* memory;       // Own memory (@inline_buffer or heap)
+  char inline_buffer[GT_STRING_INLINE_SIZE];
 } gt_string;
 
 /*
@@ -58,6 +65,15 @@ GT_INLINE void gt_string_set_string_static(gt_string* const string,const char* c
 GT_INLINE void gt_string_set_nstring_static(gt_string* const string,const char* const string_src,const uint64_t length);
 GT_INLINE char* gt_string_get_string(gt_string* const string);
 
+/*
+ * Views (Dynamic strings referencing external memory)
+ *   NOTE: The contents must not be modified through gt_string_get_string(), as that would write the
+ *         external memory. Any function of this API modifying the string copies it beforehand
+ */
+GT_INLINE void gt_string_set_view(gt_string* const string,const char* const string_src,const uint64_t length);
+GT_INLINE bool gt_string_is_view(gt_string* const string);
+GT_INLINE void gt_string_unview(gt_string* const string);
+
 GT_INLINE uint64_t gt_string_get_length(gt_string* const string);
 GT_INLINE void gt_string_set_length(gt_string* const string,const uint64_t length);
 
@@ -32,6 +32,8 @@ typedef struct {
   gt_alignment* alignment_end2;
   gt_vector* counters; /* (uint64_t) */
   gt_vector* mmaps; /* (gt_mmap) */
+  gt_lazy_maps* pending_maps; /* MMaps not decoded yet (NULL if none) */
+  gt_lazy_maps* lazy_maps;    /* Own lazy maps (storage) */
   gt_attributes* attributes;
   /* Hashed Dictionary */
   gt_template_dictionary* alg_dictionary;
@@ -88,6 +90,12 @@ typedef struct {
   GT_NULL_CHECK(template_dictionary); \
   GT_HASH_CHECK(template_dictionary->refs_dictionary)
 
+/*
+ * Lazy maps (see gt_alignment.h)
+ */
+#define GT_TEMPLATE_DECODE_MAPS(template) \
+  if (gt_expect_false((template)->pending_maps!=NULL)) gt_lazy_maps_decode((template)->pending_maps,GT_ALL)
+
 /*
  * Reduction to single alignment
  */
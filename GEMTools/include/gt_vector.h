@@ -34,6 +34,10 @@ typedef struct {
   size_t used;
   size_t element_size;
   size_t elements_allocated;
+  /* View (memory not owned, eg. pointing into a memory-mapped file) */
+  bool is_view;
+  void* owned_memory;
+  size_t owned_elements_allocated;
 } gt_vector;
 
 // Get the content of the vector
@@ -46,7 +50,8 @@ typedef struct {
 #define gt_vector_inc_used(vector) (++((vector)->used))
 #define gt_vector_dec_used(vector) (--((vector)->used))
 #define gt_vector_add_used(vector,additional) gt_vector_set_used(vector,gt_vector_get_used(vector)+additional)
-#define gt_vector_clear(vector) (vector)->used=0
+#define gt_vector_clear(vector) \
+  ((gt_expect_false((vector)->is_view) ? gt_vector_unset_view(vector,false) : (void)0), (vector)->used=0)
 #define gt_vector_is_empty(vector) (gt_vector_get_used(vector)==0)
 // Initialization and allocation
 #define gt_vector_reserve_additional(vector,additional) gt_vector_reserve(vector,gt_vector_get_used(vector)+additional,false)
@@ -91,4 +96,13 @@ GT_INLINE gt_vector* gt_vector_dup(gt_vector* vector);
 
 GT_INLINE void* gt_vector_get_mem_element(gt_vector* vector,size_t position,size_t element_size);
 
+/*
+ * Views
+ *   The vector points to external memory (read-only, never reallocated nor freed).
+ *   Any operation requiring to grow or modify the vector turns it back into a regular vector (copying the content)
+ */
+GT_INLINE void gt_vector_set_view(gt_vector* vector,void* const memory,const size_t num_elements);
+GT_INLINE void gt_vector_unset_view(gt_vector* vector,const bool keep_content);
+#define gt_vector_is_view(vector) ((vector)->is_view)
+
 #endif /* _GT_VECTOR_H_GUARD_ */
@@ -13,17 +13,24 @@
  */
 gt_option gt_filter_options[] = {
   /* I/O */
-  { 'i', "input", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "<file>" , "" },
+  { 'i', "input", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "<file>|<file>,<file>,...|'<pattern>'" , "" },
   { 'o', "output", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "<file>" , "" },
   { 'r', "reference", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "<file> (MultiFASTA/FASTA)" , "" },
   { 'I', "gem-index", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "<file> (GEM2-Index)" , "" },
   { 200, "annotation", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "<file> (GTF Annotation)" , "" },
   { 201, "mmap-input", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 2 , false, "" , "" },
   { 'p', "paired-end", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 2 , true, "" , "" },
-  { 202, "output-format", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "'FASTA'|'MAP'|'SAM' (default='InputFormat')" , "" },
+  { 202, "output-format", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "'FASTA'|'MAP'|'SAM'|'GTB' (default='InputFormat')" , "" },
   { 203, "discarded-output", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "" , "" },
   { 204, "no-output", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 2 , true, "" , "" },
   { 205, "check-duplicates", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 2 , true, "" , "Check for duplicated mappings" },
+  { 206, "readahead", GT_OPT_OPTIONAL, GT_OPT_INT, 2 , true, "[<num_buffers>] (default=3)" , "Read the input ahead on a separate thread" },
+  { 207, "input-ranges", GT_OPT_OPTIONAL, GT_OPT_INT, 2 , true, "[<range_size_MB>] (default=4)" , "Split the input (seekable MAP/SAM) in byte ranges parsed independently" },
+  { 208, "direct-input", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 2 , true, "" , "Read the input bypassing the page cache (O_DIRECT), several reads in flight" },
+  { 209, "shard-input", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 2 , true, "" , "Spread the threads over the input files (-i <file>,<file>,...|'<pattern>') instead of concatenating them" },
+  { 210, "block-sizing", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "'fixed'|'throughput'|'latency' (default='fixed')" , "Size the input blocks from the recent throughput" },
+  { 211, "gzip-output", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 2 , true, "" , "Compress the output (gzip)" },
+  { 212, "index-output", GT_OPT_OPTIONAL, GT_OPT_INT, 2 , true, "[<sampling_rate>] (default=1024)" , "Write a random-access index of the output (<output_file>.gti)" },
   /* Filter Read/Qualities */
   { 300, "hard-trim", GT_OPT_REQUIRED, GT_OPT_FLOAT, 3 , true, "<left>,<right>" , "" },
   { 301, "quality-trim", GT_OPT_REQUIRED, GT_OPT_FLOAT, 3 , false, "<quality-threshold>,<min-read-length>" , "" },
@@ -97,6 +104,7 @@ gt_option gt_filter_options[] = {
 #ifdef HAVE_OPENMP
   { 't', "threads", GT_OPT_REQUIRED, GT_OPT_INT, 11 , true, "" , "" },
 #endif
+  { 1100, "max-memory", GT_OPT_REQUIRED, GT_OPT_INT, 11 , true, "<size_MB>" , "Memory budget (smaller input blocks and no new output buffers beyond it)" },
   { 'v', "verbose", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 11 , true, "" , "" },
   { 'h', "help", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 11 , true, "" , "" },
   { 'H', "help-full", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 11 , false, "" , "" },
@@ -126,6 +134,7 @@ gt_option gt_stats_options[] = {
   /* I/O */
   { 'i', "input", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "<file>" , "" },
   { 200, "mmap-input", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 2 , false, "" , "" },
+  { 201, "direct-input", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 2 , true, "" , "Read the input bypassing the page cache (O_DIRECT), several reads in flight" },
   { 'r', "reference", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , false, "<file> (MultiFASTA/FASTA)" , "" },
   { 'I', "gem-index", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , false, "<file> (GEM2-Index)" , "" },
   { 'p', "paired-end", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 2 , true, "" , "" },
@@ -316,6 +325,7 @@ gt_option gt_gtfcount_options[] = {
   /* Misc */
   { 500, "shell", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 4, true, "", "Interactive shell to query the annotation"},
   { 'c', "coverage", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 4, true, "", "Compute coverage profiles (stored in JSON output)"},
+  { 501, "max-memory", GT_OPT_REQUIRED, GT_OPT_INT, 4, true, "<size_MB>", "Memory budget (smaller input blocks beyond it)"},
   { 'v', "verbose", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 4, true, "", ""},
   { 't', "threads", GT_OPT_REQUIRED, GT_OPT_INT, 4, true, "", ""},
   { 'h', "help", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 4, true, "", ""},
@@ -360,6 +370,31 @@ char* gt_region_groups[] = {
   /*  5 */ "Misc",
 };
 
+/*
+ * gt.index menu options
+ */
+gt_option gt_index_options[] = {
+  /* I/O */
+  { 'i', "input", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "<file> (MAP/FASTA/FASTQ, plain or BGZF)" , "" },
+  { 'o', "output", GT_OPT_REQUIRED, GT_OPT_STRING, 2 , true, "<file>" , "Records retrieved (default=stdout)" },
+  /* Index */
+  { 's', "sampling-rate", GT_OPT_REQUIRED, GT_OPT_INT, 3 , true, "<number> (default=1024)" , "Build the index (<input_file>.gti) sampling every <number> records" },
+  { 200, "template", GT_OPT_REQUIRED, GT_OPT_INT, 3 , true, "<number>" , "Print the <number>-th record (from 0) using the index" },
+  { 201, "tag", GT_OPT_REQUIRED, GT_OPT_STRING, 3 , true, "<tag>" , "Print the record with tag <tag> using the index" },
+  /* Misc */
+  { 'v', "verbose", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 4 , true, "" , "" },
+  { 'h', "help", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 4 , true, "" , "" },
+  { 'H', "help-full", GT_OPT_NO_ARGUMENT, GT_OPT_NONE, 4 , false, "" , "" },
+  {  0, "", 0, 0, 0, false, "", ""}
+};
+char* gt_index_groups[] = {
+  /*  0 */ "Null",
+  /*  1 */ "Unclassified",
+  /*  2 */ "I/O",
+  /*  3 */ "Index",
+  /*  4 */ "Misc",
+};
+
 
 
 GT_INLINE uint64_t gt_options_get_num_options(const gt_option* const options) {
@@ -9,7 +9,7 @@
 #include "gt_alignment.h"
 #include "gt_sam_attributes.h"
 
-#define GT_ALIGNMENT_TAG_INITIAL_LENGTH 100
+#define GT_ALIGNMENT_TAG_INITIAL_LENGTH GT_STRING_INLINE_SIZE
 #define GT_ALIGNMENT_READ_INITIAL_LENGTH 150
 #define GT_ALIGNMENT_NUM_INITIAL_MAPS 20
 #define GT_ALIGNMENT_NUM_INITIAL_COUNTERS 5
@@ -18,7 +18,11 @@
  * Setup
  */
 GT_INLINE gt_alignment* gt_alignment_new() {
-  gt_alignment* alignment = gt_alloc(gt_alignment);
+  // Reuse a recycled alignment (already clear)
+  gt_alignment* alignment = gt_pool_get_recycled(GT_MM_RECYCLED_ALIGNMENT);
+  if (alignment!=NULL) return alignment;
+  // Allocate
+  alignment = gt_pool_alloc(gt_alignment);
   alignment->alignment_id = UINT32_MAX;
   alignment->in_block_id = UINT32_MAX;
   alignment->tag = gt_string_new(GT_ALIGNMENT_TAG_INITIAL_LENGTH);
@@ -26,6 +30,8 @@ GT_INLINE gt_alignment* gt_alignment_new() {
   alignment->qualities = gt_string_new(GT_ALIGNMENT_READ_INITIAL_LENGTH);
   alignment->counters = gt_vector_new(GT_ALIGNMENT_NUM_INITIAL_COUNTERS,sizeof(uint64_t));
   alignment->maps = gt_vector_new(GT_ALIGNMENT_NUM_INITIAL_MAPS,sizeof(gt_map));
+  alignment->pending_maps = NULL;
+  alignment->lazy_maps = NULL;
   alignment->attributes = gt_attributes_new();
   alignment->alg_dictionary = NULL;
   return alignment;
@@ -41,13 +47,27 @@ GT_INLINE void gt_alignment_clear_handler(gt_alignment* const alignment) {
 }
 GT_INLINE void gt_alignment_clear(gt_alignment* const alignment) {
   GT_ALIGNMENT_CHECK(alignment);
+  if (alignment->pending_maps!=NULL) gt_lazy_maps_discard(alignment->pending_maps);
   gt_alignment_clear_maps(alignment);
   gt_vector_clear(alignment->counters);
   gt_alignment_clear_handler(alignment);
 }
+GT_INLINE bool gt_alignment_recycle(gt_alignment* const alignment) {
+  // Strings turned static are not what gt_alignment_new() hands out
+  if (gt_string_is_static(alignment->tag) ||
+      gt_string_is_static(alignment->read) ||
+      gt_string_is_static(alignment->qualities)) return false;
+  gt_alignment_clear(alignment);
+  alignment->alignment_id = UINT32_MAX;
+  alignment->in_block_id = UINT32_MAX;
+  return gt_pool_put_recycled(GT_MM_RECYCLED_ALIGNMENT,alignment);
+}
 GT_INLINE void gt_alignment_delete(gt_alignment* const alignment) {
   GT_ALIGNMENT_CHECK(alignment);
+  if (gt_alignment_recycle(alignment)) return;
+  if (alignment->pending_maps!=NULL) gt_lazy_maps_discard(alignment->pending_maps);
   gt_alignment_clear_maps(alignment);
+  if (alignment->lazy_maps!=NULL) gt_lazy_maps_delete(alignment->lazy_maps);
   gt_string_delete(alignment->tag);
   gt_string_delete(alignment->read);
   gt_string_delete(alignment->qualities);
@@ -55,7 +75,38 @@ GT_INLINE void gt_alignment_delete(gt_alignment* const alignment) {
   gt_vector_delete(alignment->maps);
   gt_attributes_delete(alignment->attributes);
   if (alignment->alg_dictionary!=NULL) gt_alignment_dictionary_delete(alignment->alg_dictionary);
-  gt_free(alignment);
+  gt_pool_free(alignment,gt_alignment);
+}
+
+/*
+ * Lazy maps
+ */
+GT_INLINE gt_lazy_maps* gt_lazy_maps_new(void) {
+  gt_lazy_maps* const lazy_maps = gt_alloc(gt_lazy_maps);
+  lazy_maps->text = gt_string_new(0);
+  lazy_maps->next_offset = 0;
+  lazy_maps->num_maps = 0;
+  lazy_maps->num_decoded = 0;
+  lazy_maps->owner = NULL;
+  lazy_maps->paired = false;
+  lazy_maps->map_arena = NULL;
+  lazy_maps->skip_based_model = false;
+  lazy_maps->file_name = NULL;
+  lazy_maps->line_num = 0;
+  lazy_maps->column_pos = 0;
+  lazy_maps->error_code = 0;
+  return lazy_maps;
+}
+GT_INLINE void gt_lazy_maps_delete(gt_lazy_maps* const lazy_maps) {
+  GT_NULL_CHECK(lazy_maps);
+  gt_string_delete(lazy_maps->text);
+  gt_free(lazy_maps);
+}
+GT_INLINE void gt_alignment_decode_maps(gt_alignment* const alignment,const uint64_t num_maps) {
+  GT_ALIGNMENT_CHECK(alignment);
+  if (gt_expect_false(alignment->pending_maps!=NULL)) {
+    gt_lazy_maps_decode(alignment->pending_maps,(alignment->pending_maps->paired) ? GT_ALL : num_maps);
+  }
 }
 
 /*
@@ -191,11 +242,16 @@ GT_INLINE gt_map* gt_alignment_get_map_primary(gt_alignment* const alignment) {
  */
 GT_INLINE uint64_t gt_alignment_get_num_maps(gt_alignment* const alignment) {
   GT_ALIGNMENT_CHECK(alignment);
+  if (gt_expect_false(alignment->pending_maps!=NULL)) {
+    if (!alignment->pending_maps->paired) return alignment->pending_maps->num_maps; // Counted by the parser
+    gt_lazy_maps_decode(alignment->pending_maps,GT_ALL);
+  }
   return gt_vector_get_used(alignment->maps);
 }
 GT_INLINE void gt_alignment_add_map(gt_alignment* const alignment,gt_map* const map) {
   GT_ALIGNMENT_CHECK(alignment);
   GT_NULL_CHECK(map);
+  GT_ALIGNMENT_DECODE_MAPS(alignment);
   // Insert the map
   gt_vector_insert(alignment->maps,map,gt_map*);
 }
@@ -209,16 +265,25 @@ GT_INLINE void gt_alignment_add_map_gt_vector(gt_alignment* const alignment,gt_v
 }
 GT_INLINE gt_map* gt_alignment_get_map(gt_alignment* const alignment,const uint64_t position) {
   GT_ALIGNMENT_CHECK(alignment);
+  gt_alignment_decode_maps(alignment,position+1);
   return *gt_vector_get_elm(alignment->maps,position,gt_map*);
 }
 GT_INLINE void gt_alignment_set_map(gt_alignment* const alignment,gt_map* const map,const uint64_t position) {
   GT_ALIGNMENT_CHECK(alignment);
   GT_MAP_CHECK(map);
+  gt_alignment_decode_maps(alignment,position+1);
   // Insert the map
   *gt_vector_get_elm(alignment->maps,position,gt_map*) = map;
 }
 GT_INLINE void gt_alignment_clear_maps(gt_alignment* const alignment) {
   GT_ALIGNMENT_CHECK(alignment);
+  if (alignment->pending_maps!=NULL) {
+    if (alignment->pending_maps->paired) { // The mmaps of the template keep them
+      gt_lazy_maps_decode(alignment->pending_maps,GT_ALL);
+    } else {
+      gt_lazy_maps_discard(alignment->pending_maps);
+    }
+  }
   GT_VECTOR_ITERATE(alignment->maps,alg_map,alg_map_pos,gt_map*) {
     gt_map_delete(*alg_map);
   }
@@ -227,6 +292,7 @@ GT_INLINE void gt_alignment_clear_maps(gt_alignment* const alignment) {
 GT_INLINE bool gt_alignment_locate_map_reference(gt_alignment* const alignment,gt_map* const map,uint64_t* const position) {
   GT_ALIGNMENT_CHECK(alignment);
   GT_MAP_CHECK(map);
+  GT_ALIGNMENT_DECODE_MAPS(alignment);
   GT_VECTOR_ITERATE(alignment->maps,alg_map,alg_map_pos,gt_map*) {
     if (*alg_map==map) { /* Cmp references */
       *position = alg_map_pos;
@@ -260,6 +326,7 @@ GT_INLINE gt_alignment* gt_alignment_copy(gt_alignment* const alignment,const bo
   if (copy_maps) {
     // Copy map related fields (deep copy) {MAPS,MAPS_DICCTIONARY,COUNTERS,ATTRIBUTES}
     gt_vector_copy(alignment_cp->counters,alignment->counters);
+    GT_ALIGNMENT_DECODE_MAPS(alignment);
     GT_VECTOR_ITERATE(alignment->maps,alg_map,alg_map_pos,gt_map*) {
       gt_alignment_add_map(alignment_cp,gt_map_copy(*alg_map));
     }
@@ -279,7 +346,8 @@ GT_INLINE void gt_alignment_new_map_iterator(gt_alignment* const alignment,gt_al
 GT_INLINE gt_map* gt_alignment_next_map(gt_alignment_map_iterator* const alignment_map_iterator) {
   GT_NULL_CHECK(alignment_map_iterator);
   GT_ALIGNMENT_CHECK(alignment_map_iterator->alignment);
-  const gt_alignment* const alignment = alignment_map_iterator->alignment;
+  gt_alignment* const alignment = alignment_map_iterator->alignment;
+  gt_alignment_decode_maps(alignment,alignment_map_iterator->next_pos+1);
   if (gt_expect_true(alignment_map_iterator->next_pos<gt_vector_get_used(alignment->maps))) {
     gt_map* const map = *gt_vector_get_elm(alignment->maps,alignment_map_iterator->next_pos,gt_map*);
     ++alignment_map_iterator->next_pos;
@@ -375,7 +443,7 @@ GT_INLINE bool gt_alignment_dictionary_try_add(
   GT_ALIGNMENT_DICTIONARY_CHECK(alignment_dictionary);
   GT_MAP_CHECK(map);
   *alg_dicc_elem = gt_shash_get(alignment_dictionary->maps_dictionary,
-      gt_string_get_string(map->seq_name),gt_alignment_dictionary_element);
+      gt_map_get_seq_name(map),gt_alignment_dictionary_element);
   if (*alg_dicc_elem!=NULL) {
     // Find positions {begin, end}
     *ihash_element_b = gt_ihash_get_ihash_element((*alg_dicc_elem)->begin_position,begin_position);
@@ -388,7 +456,7 @@ GT_INLINE bool gt_alignment_dictionary_try_add(
     }
   } else {
     // Add new element
-    *alg_dicc_elem = gt_alignment_dictionary_element_add(alignment_dictionary,gt_string_get_string(map->seq_name));
+    *alg_dicc_elem = gt_alignment_dictionary_element_add(alignment_dictionary,gt_map_get_seq_name(map));
     gt_alignment_dictionary_element_add_position(*alg_dicc_elem,begin_position,end_position,vector_position);
     return true;
   }
@@ -139,6 +139,9 @@ GT_INLINE bool gt_alignment_is_map_contained_fx(
 GT_INLINE void gt_alignment_reduce_maps(gt_alignment* const alignment,const uint64_t max_num_matches) {
   const uint64_t num_matches = gt_alignment_get_num_maps(alignment);
   if (max_num_matches < num_matches) {
+    // Maps not decoded yet (beyond the first max_num_matches) are just dropped
+    gt_alignment_decode_maps(alignment,max_num_matches);
+    if (alignment->pending_maps!=NULL) gt_lazy_maps_discard(alignment->pending_maps);
     // Free unused maps
     GT_VECTOR_ITERATE_OFFSET(alignment->maps,map,map_pos,max_num_matches,gt_map*) {
       gt_map_delete(*map);
@@ -233,11 +236,13 @@ int gt_alignment_cmp_distance__score_no_split(gt_map** const map_a,gt_map** cons
 }
 GT_INLINE void gt_alignment_sort_by_distance__score(gt_alignment* const alignment) {
   GT_ALIGNMENT_CHECK(alignment);
+  GT_ALIGNMENT_DECODE_MAPS(alignment);
   qsort(gt_vector_get_mem(alignment->maps,gt_map*),gt_vector_get_used(alignment->maps),
       sizeof(gt_map*),(int (*)(const void *,const void *))gt_alignment_cmp_distance__score);
 }
 GT_INLINE void gt_alignment_sort_by_distance__score_no_split(gt_alignment* const alignment) {
   GT_ALIGNMENT_CHECK(alignment);
+  GT_ALIGNMENT_DECODE_MAPS(alignment);
   qsort(gt_vector_get_mem(alignment->maps,gt_map*),gt_vector_get_used(alignment->maps),
       sizeof(gt_map*),(int (*)(const void *,const void *))gt_alignment_cmp_distance__score_no_split);
 }
@@ -276,6 +281,7 @@ GT_INLINE uint64_t gt_alignment_get_max_mismatch_quality(gt_alignment* const ali
 GT_INLINE void gt_alignment_merge_alignment_maps(gt_alignment* const alignment_dst,gt_alignment* const alignment_src) {
   GT_ALIGNMENT_CHECK(alignment_dst);
   GT_ALIGNMENT_CHECK(alignment_src);
+  GT_ALIGNMENT_DECODE_MAPS(alignment_dst);
   // Perform regular merge
   if (alignment_dst->alg_dictionary == NULL) {
     gt_alignment_merge_alignment_maps_fx(gt_map_cmp,alignment_dst,alignment_src);
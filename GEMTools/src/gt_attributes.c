@@ -10,37 +10,246 @@
 #include "gt_attributes.h"
 #include "gt_sam_attributes.h"
 
+#define GT_ATTR_CUSTOM_INITIAL_SIZE 4
+
+#define GT_ATTR_SLOT_MASK(slot) (1u<<(slot))
+#define gt_attribute_is_string(attribute) \
+  ((attribute)->element_type==GT_HASH_TYPE_OBJECT && \
+   (attribute)->element_setup.element_free_fx==(void(*)())gt_string_delete)
+
+/*
+ * Attribute (value holder)
+ */
+GT_INLINE void gt_attribute_free(gt_attribute* const attribute) {
+  if (attribute->element_type==GT_HASH_TYPE_OBJECT) {
+    attribute->element_setup.element_free_fx(attribute->element);
+  } else if (attribute->element!=attribute->value) {
+    gt_free(attribute->element);
+  }
+  attribute->element = NULL;
+}
+GT_INLINE void gt_attribute_set_primitive(gt_attribute* const attribute,void* const element,const size_t element_size) {
+  if (element_size<=GT_ATTR_INLINE_SIZE) {
+    memcpy(attribute->value,element,element_size);
+    attribute->element = attribute->value;
+  } else {
+    attribute->element = gt_malloc(element_size);
+    memcpy(attribute->element,element,element_size);
+  }
+  attribute->element_type = GT_HASH_TYPE_REGULAR;
+  attribute->element_size = element_size;
+}
+GT_INLINE void gt_attribute_set_object(
+    gt_attribute* const attribute,void* const object,void* (*element_dup_fx)(),void (*element_free_fx)()) {
+  attribute->element = object;
+  attribute->element_type = GT_HASH_TYPE_OBJECT;
+  attribute->element_setup.element_dup_fx = element_dup_fx;
+  attribute->element_setup.element_free_fx = element_free_fx;
+}
+GT_INLINE void gt_attribute_copy(gt_attribute* const attribute_dst,gt_attribute* const attribute_src) {
+  if (attribute_src->element_type==GT_HASH_TYPE_OBJECT) {
+    gt_attribute_set_object(attribute_dst,attribute_src->element_setup.element_dup_fx(attribute_src->element),
+        attribute_src->element_setup.element_dup_fx,attribute_src->element_setup.element_free_fx);
+  } else {
+    gt_attribute_set_primitive(attribute_dst,attribute_src->element,attribute_src->element_size);
+  }
+}
+
+/*
+ * Custom attributes (overflow table)
+ */
+GT_INLINE uint64_t gt_attributes_custom_hash(const char* const key) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  const char* c;
+  for (c=key;*c!=EOS;++c) {
+    hash ^= (uint8_t)*c;
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+GT_INLINE gt_attribute_custom* gt_attributes_custom_find(
+    gt_attributes* const attributes,const char* const key,const uint64_t hash) {
+  if (attributes->custom==NULL) return NULL;
+  const uint64_t mask = attributes->custom_size-1;
+  uint64_t pos = hash&mask;
+  while (attributes->custom[pos].key!=NULL) {
+    gt_attribute_custom* const custom = attributes->custom+pos;
+    if (custom->hash==hash && gt_streq(custom->key,(char*)key)) return custom;
+    pos = (pos+1)&mask;
+  }
+  return NULL;
+}
+GT_INLINE gt_attribute_custom* gt_attributes_custom_find_free(gt_attributes* const attributes,const uint64_t hash) {
+  const uint64_t mask = attributes->custom_size-1;
+  uint64_t pos = hash&mask;
+  while (attributes->custom[pos].key!=NULL) pos = (pos+1)&mask;
+  return attributes->custom+pos;
+}
+GT_INLINE void gt_attributes_custom_grow(gt_attributes* const attributes) {
+  gt_attribute_custom* const old_custom = attributes->custom;
+  const uint64_t old_size = attributes->custom_size;
+  attributes->custom_size = (old_size==0) ? GT_ATTR_CUSTOM_INITIAL_SIZE : 2*old_size;
+  attributes->custom = gt_calloc(attributes->custom_size,gt_attribute_custom,true);
+  uint64_t i;
+  for (i=0;i<old_size;++i) {
+    if (old_custom[i].key!=NULL) {
+      gt_attribute_custom* const custom = gt_attributes_custom_find_free(attributes,old_custom[i].hash);
+      *custom = old_custom[i];
+      if (custom->attribute.element==old_custom[i].attribute.value) custom->attribute.element = custom->attribute.value;
+    }
+  }
+  if (old_custom!=NULL) gt_free(old_custom);
+}
+GT_INLINE gt_attribute* gt_attributes_custom_get_dyn(gt_attributes* const attributes,char* const key) {
+  const uint64_t hash = gt_attributes_custom_hash(key);
+  gt_attribute_custom* custom = gt_attributes_custom_find(attributes,key,hash);
+  if (custom!=NULL) {
+    gt_attribute_free(&custom->attribute);
+    return &custom->attribute;
+  }
+  if (2*(attributes->num_custom+1) > attributes->custom_size) gt_attributes_custom_grow(attributes);
+  custom = gt_attributes_custom_find_free(attributes,hash);
+  custom->key = gt_strndup(key,strlen(key));
+  custom->hash = hash;
+  ++(attributes->num_custom);
+  return &custom->attribute;
+}
+GT_INLINE void gt_attributes_custom_remove(gt_attributes* const attributes,gt_attribute_custom* const custom) {
+  gt_attribute_free(&custom->attribute);
+  gt_free(custom->key);
+  custom->key = NULL;
+  --(attributes->num_custom);
+  // Shift back the entries of the cluster (no tombstones)
+  const uint64_t mask = attributes->custom_size-1;
+  uint64_t hole = custom-attributes->custom, pos = (hole+1)&mask;
+  while (attributes->custom[pos].key!=NULL) {
+    const uint64_t home = attributes->custom[pos].hash&mask;
+    if (((pos-home)&mask) >= ((pos-hole)&mask)) {
+      attributes->custom[hole] = attributes->custom[pos];
+      if (attributes->custom[hole].attribute.element==attributes->custom[pos].attribute.value) {
+        attributes->custom[hole].attribute.element = attributes->custom[hole].attribute.value;
+      }
+      attributes->custom[pos].key = NULL;
+      hole = pos;
+    }
+    pos = (pos+1)&mask;
+  }
+}
+GT_INLINE void gt_attributes_custom_clear(gt_attributes* const attributes) {
+  if (attributes->num_custom==0) return;
+  uint64_t i;
+  for (i=0;i<attributes->custom_size;++i) {
+    gt_attribute_custom* const custom = attributes->custom+i;
+    if (custom->key!=NULL) {
+      gt_attribute_free(&custom->attribute);
+      gt_free(custom->key);
+      custom->key = NULL;
+    }
+  }
+  attributes->num_custom = 0;
+}
+
+/*
+ * Slot attributes
+ */
+GT_INLINE gt_attribute* gt_attributes_slot_get_dyn(gt_attributes* const attributes,const uint64_t slot) {
+  gt_attribute* const attribute = attributes->slots+slot;
+  if (attributes->slots_set & GT_ATTR_SLOT_MASK(slot)) {
+    gt_attribute_free(attribute);
+  } else if (attributes->slots_kept & GT_ATTR_SLOT_MASK(slot)) {
+    gt_attribute_free(attribute); // Not a string any more
+    attributes->slots_kept &= ~GT_ATTR_SLOT_MASK(slot);
+  }
+  attributes->slots_set |= GT_ATTR_SLOT_MASK(slot);
+  return attribute;
+}
+GT_INLINE void gt_attributes_slot_remove(gt_attributes* const attributes,const uint64_t slot) {
+  if (attributes->slots_set & GT_ATTR_SLOT_MASK(slot)) {
+    gt_attribute* const attribute = attributes->slots+slot;
+    attributes->slots_set &= ~GT_ATTR_SLOT_MASK(slot);
+    if (gt_attribute_is_string(attribute)) {
+      attributes->slots_kept |= GT_ATTR_SLOT_MASK(slot); // Keep the string
+    } else {
+      gt_attribute_free(attribute);
+    }
+  }
+}
+GT_INLINE gt_attribute* gt_attributes_get_attribute_dyn(gt_attributes* const attributes,char* const attribute_id) {
+  return GT_ATTR_ID_IS_SLOT(attribute_id) ?
+      gt_attributes_slot_get_dyn(attributes,GT_ATTR_ID_GET_SLOT(attribute_id)) :
+      gt_attributes_custom_get_dyn(attributes,attribute_id);
+}
+
 /*
  * General Attribute accessors
  */
 GT_INLINE gt_attributes* gt_attributes_new(void) {
-  return gt_shash_new();
+  gt_attributes* const attributes = gt_alloc(gt_attributes);
+  attributes->slots_set = 0;
+  attributes->slots_kept = 0;
+  attributes->custom = NULL;
+  attributes->num_custom = 0;
+  attributes->custom_size = 0;
+  return attributes;
 }
 GT_INLINE void gt_attributes_clear(gt_attributes* const attributes) {
   GT_ATTRIBUTES_CHECK(attributes);
-  gt_shash_clear(attributes,true);
+  uint32_t slots_set = attributes->slots_set;
+  while (slots_set) {
+    const uint64_t slot = __builtin_ctz(slots_set);
+    gt_attributes_slot_remove(attributes,slot);
+    slots_set &= slots_set-1;
+  }
+  gt_attributes_custom_clear(attributes);
 }
 GT_INLINE void gt_attributes_delete(gt_attributes* const attributes) {
   GT_ATTRIBUTES_CHECK(attributes);
-  gt_shash_delete(attributes,true);
+  gt_attributes_clear(attributes);
+  uint32_t slots_kept = attributes->slots_kept;
+  while (slots_kept) {
+    gt_attribute_free(attributes->slots+__builtin_ctz(slots_kept));
+    slots_kept &= slots_kept-1;
+  }
+  if (attributes->custom!=NULL) gt_free(attributes->custom);
+  gt_free(attributes);
 }
 GT_INLINE void* gt_attributes_get(gt_attributes* const attributes,char* const attribute_id) {
   GT_ATTRIBUTES_CHECK(attributes);
   GT_NULL_CHECK(attribute_id);
-  return gt_shash_get(attributes,attribute_id,void);
+  if (GT_ATTR_ID_IS_SLOT(attribute_id)) {
+    const uint64_t slot = GT_ATTR_ID_GET_SLOT(attribute_id);
+    return (attributes->slots_set & GT_ATTR_SLOT_MASK(slot)) ? attributes->slots[slot].element : NULL;
+  } else {
+    gt_attribute_custom* const custom =
+        gt_attributes_custom_find(attributes,attribute_id,gt_attributes_custom_hash(attribute_id));
+    return (custom!=NULL) ? custom->attribute.element : NULL;
+  }
 }
 GT_INLINE bool gt_attributes_is_contained(gt_attributes* const attributes,char* const attribute_id) {
   GT_ATTRIBUTES_CHECK(attributes);
   GT_NULL_CHECK(attribute_id);
-  return gt_shash_is_contained(attributes,attribute_id);
+  return gt_attributes_get(attributes,attribute_id)!=NULL;
 }
 GT_INLINE void gt_attributes_add_string(
     gt_attributes* const attributes,char* const attribute_id,gt_string* const attribute_string) {
   GT_ATTRIBUTES_CHECK(attributes);
   GT_NULL_CHECK(attribute_id);
   GT_STRING_CHECK(attribute_string);
+  // Reuse the string kept in the slot (if any)
+  if (GT_ATTR_ID_IS_SLOT(attribute_id)) {
+    const uint64_t slot = GT_ATTR_ID_GET_SLOT(attribute_id);
+    gt_attribute* const attribute = attributes->slots+slot;
+    if ((attributes->slots_kept & GT_ATTR_SLOT_MASK(slot)) ||
+        ((attributes->slots_set & GT_ATTR_SLOT_MASK(slot)) && gt_attribute_is_string(attribute))) {
+      gt_string_copy(attribute->element,attribute_string);
+      attributes->slots_kept &= ~GT_ATTR_SLOT_MASK(slot);
+      attributes->slots_set |= GT_ATTR_SLOT_MASK(slot);
+      return;
+    }
+  }
   // Insert attribute
-  gt_shash_insert_string(attributes,attribute_id,attribute_string);
+  gt_attribute_set_object(gt_attributes_get_attribute_dyn(attributes,attribute_id),gt_string_dup(attribute_string),
+      (void*(*)())gt_string_dup,(void(*)())gt_string_delete);
 }
 GT_INLINE void gt_attributes_add_primitive(
     gt_attributes* const attributes,char* const attribute_id,void* const attribute,const size_t element_size) {
@@ -49,10 +258,7 @@ GT_INLINE void gt_attributes_add_primitive(
   GT_NULL_CHECK(attribute);
   GT_ZERO_CHECK(element_size);
   // We do a copy of the element as to handle it ourselves from here
-  void* attribute_cp = gt_malloc(element_size); // Allocate attribute
-  memcpy(attribute_cp,attribute,element_size); // Copy attribute
-  // Insert attribute
-  gt_shash_insert_primitive(attributes,attribute_id,attribute_cp,element_size);
+  gt_attribute_set_primitive(gt_attributes_get_attribute_dyn(attributes,attribute_id),attribute,element_size);
 }
 GT_INLINE void gt_attributes_add_object(
     gt_attributes* const attributes,char* const attribute_id,
@@ -63,20 +269,50 @@ GT_INLINE void gt_attributes_add_object(
   GT_NULL_CHECK(attribute_dup_fx);
   GT_NULL_CHECK(attribute_free_fx);
   // Insert attribute
-  gt_shash_insert_object(attributes,attribute_id,attribute,attribute_dup_fx,attribute_free_fx);
+  gt_attribute_set_object(gt_attributes_get_attribute_dyn(attributes,attribute_id),
+      attribute,attribute_dup_fx,attribute_free_fx);
 }
 GT_INLINE void gt_attributes_remove(gt_attributes* const attributes,char* const attribute_id) {
   GT_ATTRIBUTES_CHECK(attributes);
-  gt_shash_remove(attributes,attribute_id,true);
+  if (GT_ATTR_ID_IS_SLOT(attribute_id)) {
+    gt_attributes_slot_remove(attributes,GT_ATTR_ID_GET_SLOT(attribute_id));
+  } else {
+    gt_attribute_custom* const custom =
+        gt_attributes_custom_find(attributes,attribute_id,gt_attributes_custom_hash(attribute_id));
+    if (custom!=NULL) gt_attributes_custom_remove(attributes,custom);
+  }
 }
 GT_INLINE gt_attributes* gt_attributes_dup(gt_attributes* const attributes) {
   GT_ATTRIBUTES_CHECK(attributes);
-  return gt_shash_dup(attributes);
+  gt_attributes* const attributes_cp = gt_attributes_new();
+  gt_attributes_copy(attributes_cp,attributes);
+  return attributes_cp;
 }
 GT_INLINE void gt_attributes_copy(gt_attributes* const attributes_dst,gt_attributes* const attributes_src) {
   GT_ATTRIBUTES_CHECK(attributes_dst);
   GT_ATTRIBUTES_CHECK(attributes_src);
-  gt_shash_copy(attributes_dst,attributes_src);
+  // Slots
+  uint32_t slots_set = attributes_src->slots_set;
+  while (slots_set) {
+    const uint64_t slot = __builtin_ctz(slots_set);
+    gt_attribute* const attribute_src = attributes_src->slots+slot;
+    if (gt_attribute_is_string(attribute_src)) {
+      gt_attributes_add_string(attributes_dst,GT_ATTR_SLOT_ID(slot),attribute_src->element);
+    } else {
+      gt_attribute_copy(gt_attributes_slot_get_dyn(attributes_dst,slot),attribute_src);
+    }
+    slots_set &= slots_set-1;
+  }
+  // Custom
+  if (attributes_src->num_custom>0) {
+    uint64_t i;
+    for (i=0;i<attributes_src->custom_size;++i) {
+      gt_attribute_custom* const custom = attributes_src->custom+i;
+      if (custom->key!=NULL) {
+        gt_attribute_copy(gt_attributes_custom_get_dyn(attributes_dst,custom->key),&custom->attribute);
+      }
+    }
+  }
 }
 
 /*
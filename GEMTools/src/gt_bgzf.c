@@ -0,0 +1,170 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_bgzf.c
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Block-parallel reader for BGZF files
+ */
+
+#include "gt_bgzf.h"
+
+#ifdef HAVE_ZLIB
+
+#define GT_BGZF_NUM_INITIAL_BLOCKS 1024
+
+#define GT_BGZF_UNPACK_INT16(buffer) ((uint64_t)(buffer)[0] | ((uint64_t)(buffer)[1]<<8))
+#define GT_BGZF_UNPACK_INT32(buffer) \
+  ((uint64_t)(buffer)[0] | ((uint64_t)(buffer)[1]<<8) | ((uint64_t)(buffer)[2]<<16) | ((uint64_t)(buffer)[3]<<24))
+
+/*
+ * BGZF header
+ *   ID1=31 ID2=139 CM=8 FLG=FEXTRA ... XLEN=6 SI1='B' SI2='C' SLEN=2 BSIZE
+ */
+GT_INLINE bool gt_bgzf_is_bgzf_header(const uint8_t* const header,const uint64_t header_length) {
+  GT_NULL_CHECK(header);
+  if (header_length < GT_BGZF_HEADER_SIZE) return false;
+  return header[0]==31 && header[1]==139 && header[2]==8 && (header[3]&4)!=0 &&
+         GT_BGZF_UNPACK_INT16(header+10)==6 &&
+         header[12]=='B' && header[13]=='C' && GT_BGZF_UNPACK_INT16(header+14)==2;
+}
+
+/*
+ * Setup
+ */
+GT_INLINE gt_bgzf_reader* gt_bgzf_reader_new(FILE* const file) {
+  GT_NULL_CHECK(file);
+  gt_bgzf_reader* const bgzf_reader = gt_alloc(gt_bgzf_reader);
+  bgzf_reader->file = file;
+  bgzf_reader->eof = false;
+  bgzf_reader->file_offset = 0;
+  bgzf_reader->compressed_buffer = gt_vector_new(GT_BGZF_NUM_INITIAL_BLOCKS*GT_BGZF_MAX_BLOCK_SIZE,sizeof(uint8_t));
+  bgzf_reader->blocks = gt_vector_new(GT_BGZF_NUM_INITIAL_BLOCKS,sizeof(gt_bgzf_block));
+  bgzf_reader->pending_block = false;
+  return bgzf_reader;
+}
+GT_INLINE void gt_bgzf_reader_delete(gt_bgzf_reader* const bgzf_reader) {
+  GT_BGZF_READER_CHECK(bgzf_reader);
+  gt_vector_delete(bgzf_reader->compressed_buffer);
+  gt_vector_delete(bgzf_reader->blocks);
+  gt_free(bgzf_reader);
+}
+
+/*
+ * Block reading
+ */
+GT_INLINE bool gt_bgzf_reader_read_block(gt_bgzf_reader* const bgzf_reader,gt_bgzf_block* const block) {
+  // Read header
+  const uint64_t offset = gt_vector_get_used(bgzf_reader->compressed_buffer);
+  gt_vector_reserve_additional(bgzf_reader->compressed_buffer,GT_BGZF_MAX_BLOCK_SIZE);
+  uint8_t* const header = gt_vector_get_mem(bgzf_reader->compressed_buffer,uint8_t)+offset;
+  const uint64_t header_read = fread(header,sizeof(uint8_t),GT_BGZF_HEADER_SIZE,bgzf_reader->file);
+  if (header_read==0) return false; // EOF
+  gt_cond_fatal_error(!gt_bgzf_is_bgzf_header(header,header_read),BGZF_BAD_HEADER);
+  // Read the rest of the block
+  const uint64_t block_size = GT_BGZF_UNPACK_INT16(header+16)+1;
+  gt_cond_fatal_error(block_size<GT_BGZF_HEADER_SIZE+GT_BGZF_FOOTER_SIZE,BGZF_BAD_HEADER);
+  const uint64_t remaining = block_size-GT_BGZF_HEADER_SIZE;
+  gt_cond_fatal_error(fread(header+GT_BGZF_HEADER_SIZE,sizeof(uint8_t),remaining,bgzf_reader->file)!=remaining,BGZF_TRUNCATED);
+  gt_vector_add_used(bgzf_reader->compressed_buffer,block_size);
+  // Fill block info
+  block->file_offset = bgzf_reader->file_offset;
+  bgzf_reader->file_offset += block_size;
+  block->compressed_offset = offset;
+  block->compressed_size = block_size;
+  block->uncompressed_size = GT_BGZF_UNPACK_INT32(header+block_size-4);
+  gt_cond_fatal_error(block->uncompressed_size>GT_BGZF_MAX_BLOCK_SIZE,BGZF_BAD_HEADER);
+  return true;
+}
+GT_INLINE bool gt_bgzf_reader_inflate_block(
+    gt_bgzf_reader* const bgzf_reader,gt_bgzf_block* const block,uint8_t* const buffer) {
+  if (block->uncompressed_size==0) return true; // Empty block (Typically the EOF marker)
+  z_stream zs;
+  zs.zalloc = NULL;
+  zs.zfree = NULL;
+  zs.next_in = gt_vector_get_mem(bgzf_reader->compressed_buffer,uint8_t)+block->compressed_offset+GT_BGZF_HEADER_SIZE;
+  zs.avail_in = block->compressed_size-GT_BGZF_HEADER_SIZE;
+  zs.next_out = buffer+block->uncompressed_offset;
+  zs.avail_out = block->uncompressed_size;
+  if (inflateInit2(&zs,-15)!=Z_OK) return false;
+  const int z_status = inflate(&zs,Z_FINISH);
+  inflateEnd(&zs);
+  return z_status==Z_STREAM_END && zs.total_out==block->uncompressed_size;
+}
+GT_INLINE uint64_t gt_bgzf_reader_read_chunk(
+    gt_bgzf_reader* const bgzf_reader,uint8_t* const buffer,const uint64_t buffer_size) {
+  GT_BGZF_READER_CHECK(bgzf_reader);
+  GT_NULL_CHECK(buffer);
+  gt_vector* const blocks = bgzf_reader->blocks;
+  // Carry the block that didn't fit in the previous chunk
+  if (bgzf_reader->pending_block) {
+    gt_bgzf_block* const pending = gt_vector_get_last_elm(blocks,gt_bgzf_block);
+    uint8_t* const compressed_mem = gt_vector_get_mem(bgzf_reader->compressed_buffer,uint8_t);
+    memmove(compressed_mem,compressed_mem+pending->compressed_offset,pending->compressed_size);
+    gt_vector_set_used(bgzf_reader->compressed_buffer,pending->compressed_size);
+    pending->compressed_offset = 0;
+    pending->uncompressed_offset = 0;
+    *gt_vector_get_elm(blocks,0,gt_bgzf_block) = *pending;
+    gt_vector_set_used(blocks,1);
+    bgzf_reader->pending_block = false;
+  } else {
+    gt_vector_clear(bgzf_reader->compressed_buffer);
+    gt_vector_clear(blocks);
+  }
+  uint64_t total_size = gt_vector_is_empty(blocks) ? 0 : gt_vector_get_elm(blocks,0,gt_bgzf_block)->uncompressed_size;
+  // Read blocks (as many as fit in the buffer)
+  while (!bgzf_reader->eof) {
+    gt_vector_reserve_additional(blocks,1);
+    gt_bgzf_block* const block = gt_vector_get_free_elm(blocks,gt_bgzf_block);
+    if (!gt_bgzf_reader_read_block(bgzf_reader,block)) {
+      bgzf_reader->eof = true;
+      break;
+    }
+    gt_vector_inc_used(blocks);
+    if (total_size+block->uncompressed_size > buffer_size) {
+      bgzf_reader->pending_block = true;
+      break;
+    }
+    block->uncompressed_offset = total_size;
+    total_size += block->uncompressed_size;
+  }
+  // Inflate all blocks in parallel
+  const int64_t num_blocks = gt_vector_get_used(blocks) - (bgzf_reader->pending_block ? 1 : 0);
+  bool inflate_error = false;
+  int64_t i;
+  #pragma omp parallel for schedule(dynamic,16) reduction(|:inflate_error)
+  for (i=0;i<num_blocks;++i) {
+    inflate_error |= !gt_bgzf_reader_inflate_block(bgzf_reader,gt_vector_get_elm(blocks,i,gt_bgzf_block),buffer);
+  }
+  gt_cond_fatal_error(inflate_error,BGZF_INFLATE);
+  return total_size;
+}
+
+/*
+ * Random access
+ */
+GT_INLINE bool gt_bgzf_reader_seek(gt_bgzf_reader* const bgzf_reader,const uint64_t block_offset) {
+  GT_BGZF_READER_CHECK(bgzf_reader);
+  if (fseek(bgzf_reader->file,block_offset,SEEK_SET)==-1) return false;
+  bgzf_reader->eof = false;
+  bgzf_reader->file_offset = block_offset;
+  gt_vector_clear(bgzf_reader->compressed_buffer);
+  gt_vector_clear(bgzf_reader->blocks);
+  bgzf_reader->pending_block = false;
+  return true;
+}
+/* Virtual offset of the byte at @chunk_offset of the last chunk read */
+GT_INLINE uint64_t gt_bgzf_reader_get_virtual_offset(gt_bgzf_reader* const bgzf_reader,const uint64_t chunk_offset) {
+  GT_BGZF_READER_CHECK(bgzf_reader);
+  gt_bgzf_block* const blocks = gt_vector_get_mem(bgzf_reader->blocks,gt_bgzf_block);
+  const uint64_t num_blocks = gt_vector_get_used(bgzf_reader->blocks) - (bgzf_reader->pending_block ? 1 : 0);
+  gt_check(num_blocks==0,ALG_INCONSISNTENCY);
+  // Last block starting at (or before) @chunk_offset (empty blocks share the offset of the next one)
+  uint64_t lo = 0, hi = num_blocks-1;
+  while (lo < hi) {
+    const uint64_t mid = (lo+hi+1)/2;
+    if (blocks[mid].uncompressed_offset <= chunk_offset) lo = mid; else hi = mid-1;
+  }
+  return GT_BGZF_VIRTUAL_OFFSET(blocks[lo].file_offset,chunk_offset-blocks[lo].uncompressed_offset);
+}
+
+#endif /* HAVE_ZLIB */
@@ -7,9 +7,32 @@
  */
 
 #include "gt_buffered_input_file.h"
+#include "gt_input_parser.h"
 
 #define GT_BMI_BUFFER_SIZE GT_BUFFER_SIZE_4M
 #define GT_BMI_NUM_LINES GT_NUM_LINES_5K
+#define GT_BMI_RANGE_SYNC_WINDOW GT_BUFFER_SIZE_16K
+
+#define GT_BMI_THROUGHPUT_BLOCK_SIZE GT_BUFFER_SIZE_8M
+#define GT_BMI_THROUGHPUT_BLOCK_TIME 0.5
+#define GT_BMI_LATENCY_BLOCK_SIZE    GT_BUFFER_SIZE_1M
+#define GT_BMI_LATENCY_BLOCK_TIME    0.05
+#define GT_BMI_ADAPTIVE_LINES_ALIGN  8   /* Never split FASTQ records (paired/interleaved) */
+#define GT_BMI_ADAPTIVE_MIN_LINES    GT_BMI_ADAPTIVE_LINES_ALIGN /* A few records (the byte target bounds long lines) */
+#define GT_BMI_ADAPTIVE_MAX_LINES    GT_NUM_LINES_1M
+#define GT_BMI_ADAPTIVE_WEIGHT       0.25 /* Weight of the last block in the moving averages */
+#define GT_BMI_BUDGET_SHRINK_FACTOR  4    /* Block shrink when over the memory budget */
+
+/*
+ * Memory accounting (memory owned by the block buffer, not the views)
+ */
+GT_INLINE void gt_buffered_input_file_account_block_buffer(gt_buffered_input_file* const buffered_input_file) {
+  gt_vector* const block_buffer = buffered_input_file->block_buffer;
+  const uint64_t elements_allocated = gt_vector_is_view(block_buffer) ?
+      block_buffer->owned_elements_allocated : block_buffer->elements_allocated;
+  gt_mm_acc_update(GT_MM_ACC_INPUT_BUFFERS,
+      &buffered_input_file->block_buffer_accounted,elements_allocated*block_buffer->element_size);
+}
 
 /*
  * Buffered map file handlers
@@ -19,18 +42,36 @@ gt_buffered_input_file* gt_buffered_input_file_new(gt_input_file* const input_fi
   gt_buffered_input_file* buffered_input_file = gt_alloc(gt_buffered_input_file);
   /* Input file */
   buffered_input_file->input_file = input_file;
+  buffered_input_file->input_file_set = NULL;
   /* Block buffer and cursors */
   buffered_input_file->block_id = UINT32_MAX;
   buffered_input_file->block_buffer = gt_vector_new(GT_BMI_BUFFER_SIZE,sizeof(uint8_t));
   buffered_input_file->cursor = (char*) gt_vector_get_mem(buffered_input_file->block_buffer,uint8_t);
   buffered_input_file->current_line_num = UINT64_MAX;
+  buffered_input_file->block_buffer_accounted = 0;
+  gt_buffered_input_file_account_block_buffer(buffered_input_file);
+  gt_buffered_input_file_set_block_sizing(buffered_input_file,GT_BMI_BLOCK_FIXED);
+  /* Block dictionary */
+  buffered_input_file->block_seq_name_ids = NULL;
   /* Attached output buffer */
   buffered_input_file->attached_buffered_output_file = gt_vector_new(2,sizeof(gt_buffered_output_file*));
   return buffered_input_file;
 }
+gt_buffered_input_file* gt_buffered_input_file_new_from_set(gt_input_file_set* const input_file_set) {
+  GT_INPUT_FILE_SET_CHECK(input_file_set);
+  gt_buffered_input_file* const buffered_input_file =
+      gt_buffered_input_file_new(gt_input_file_set_acquire(input_file_set));
+  buffered_input_file->input_file_set = input_file_set;
+  return buffered_input_file;
+}
 gt_status gt_buffered_input_file_close(gt_buffered_input_file* const buffered_input_file) {
   GT_BUFFERED_INPUT_FILE_CHECK(buffered_input_file);
+  if (buffered_input_file->input_file_set!=NULL) {
+    gt_input_file_set_release(buffered_input_file->input_file_set,buffered_input_file->input_file);
+  }
+  gt_mm_acc_update(GT_MM_ACC_INPUT_BUFFERS,&buffered_input_file->block_buffer_accounted,0);
   gt_vector_delete(buffered_input_file->block_buffer);
+  if (buffered_input_file->block_seq_name_ids!=NULL) gt_vector_delete(buffered_input_file->block_seq_name_ids);
   gt_free(buffered_input_file);
   return GT_BMI_OK;
 }
@@ -47,6 +88,7 @@ GT_INLINE gt_status gt_buffered_input_file_get_block(
     gt_buffered_input_file* const buffered_input_file,const uint64_t num_lines) {
   GT_BUFFERED_INPUT_FILE_CHECK(buffered_input_file);
   gt_input_file* const input_file = buffered_input_file->input_file;
+  if (input_file->ranges!=NULL) return gt_buffered_input_file_get_range_block(buffered_input_file);
   // Read lines
   if (input_file->eof) return GT_BMI_EOF;
   gt_input_file_lock(input_file);
@@ -54,14 +96,18 @@ GT_INLINE gt_status gt_buffered_input_file_get_block(
     gt_input_file_unlock(input_file);
     return GT_BMI_EOF;
   }
-  buffered_input_file->block_id = gt_input_file_next_id(input_file) % UINT32_MAX;
   buffered_input_file->current_line_num = input_file->processed_lines+1;
   buffered_input_file->lines_in_buffer =
       gt_input_file_get_lines(input_file,buffered_input_file->block_buffer,
-          gt_expect_true(num_lines)?num_lines:GT_BMI_NUM_LINES);
+          gt_buffered_input_file_block_lines(buffered_input_file,gt_expect_true(num_lines)?num_lines:GT_BMI_NUM_LINES));
+  // Empty blocks don't take an ID (IDs can be shared by a set of files)
+  if (buffered_input_file->lines_in_buffer>0) {
+    buffered_input_file->block_id = gt_input_file_next_id(input_file) % UINT32_MAX;
+  }
   gt_input_file_unlock(input_file);
   // Setup the block
   buffered_input_file->cursor = gt_vector_get_mem(buffered_input_file->block_buffer,char);
+  gt_buffered_input_file_block_read(buffered_input_file);
   return buffered_input_file->lines_in_buffer;
 }
 GT_INLINE gt_status gt_buffered_input_file_add_lines_to_block(
@@ -79,6 +125,225 @@ GT_INLINE gt_status gt_buffered_input_file_add_lines_to_block(
   buffered_input_file->cursor = gt_vector_get_elm(buffered_input_file->block_buffer,current_position,char);
   return lines_added;
 }
+/*
+ * Block sizing
+ */
+GT_INLINE void gt_buffered_input_file_set_block_sizing(
+    gt_buffered_input_file* const buffered_input_file,const gt_bmi_block_sizing_mode mode) {
+  GT_NULL_CHECK(buffered_input_file);
+  gt_bmi_block_sizing* const block_sizing = &buffered_input_file->block_sizing;
+  block_sizing->mode = mode;
+  switch (mode) {
+    case GT_BMI_BLOCK_FIXED:
+      block_sizing->target_block_size = 0;
+      block_sizing->target_block_time = 0.0;
+      break;
+    case GT_BMI_BLOCK_THROUGHPUT:
+      block_sizing->target_block_size = GT_BMI_THROUGHPUT_BLOCK_SIZE;
+      block_sizing->target_block_time = GT_BMI_THROUGHPUT_BLOCK_TIME;
+      break;
+    case GT_BMI_BLOCK_LATENCY:
+      block_sizing->target_block_size = GT_BMI_LATENCY_BLOCK_SIZE;
+      block_sizing->target_block_time = GT_BMI_LATENCY_BLOCK_TIME;
+      break;
+    default:
+      GT_INVALID_CASE();
+      break;
+  }
+  block_sizing->bytes_per_line = 0.0;
+  block_sizing->bytes_per_second = 0.0;
+  block_sizing->last_block_size = 0;
+}
+GT_INLINE void gt_buffered_input_file_set_block_targets(
+    gt_buffered_input_file* const buffered_input_file,const uint64_t target_block_size,const double target_block_time) {
+  GT_NULL_CHECK(buffered_input_file);
+  gt_bmi_block_sizing* const block_sizing = &buffered_input_file->block_sizing;
+  if (block_sizing->mode==GT_BMI_BLOCK_FIXED) block_sizing->mode = GT_BMI_BLOCK_THROUGHPUT;
+  block_sizing->target_block_size = target_block_size;
+  block_sizing->target_block_time = target_block_time;
+}
+GT_INLINE double gt_bmi_moving_average(const double average,const double sample) {
+  return (average==0.0) ? sample : (1.0-GT_BMI_ADAPTIVE_WEIGHT)*average + GT_BMI_ADAPTIVE_WEIGHT*sample;
+}
+GT_INLINE uint64_t gt_bmi_budget_block_lines(const uint64_t num_lines) {
+  // Over the memory budget. Smaller blocks (less memory in flight) till the usage drops
+  if (num_lines <= GT_BMI_ADAPTIVE_MIN_LINES) return num_lines;
+  const uint64_t block_lines = GT_MAX(num_lines/GT_BMI_BUDGET_SHRINK_FACTOR,GT_BMI_ADAPTIVE_MIN_LINES);
+  return ((block_lines+GT_BMI_ADAPTIVE_LINES_ALIGN-1)/GT_BMI_ADAPTIVE_LINES_ALIGN)*GT_BMI_ADAPTIVE_LINES_ALIGN;
+}
+GT_INLINE uint64_t gt_buffered_input_file_block_lines(
+    gt_buffered_input_file* const buffered_input_file,const uint64_t num_lines) {
+  GT_NULL_CHECK(buffered_input_file);
+  gt_bmi_block_sizing* const block_sizing = &buffered_input_file->block_sizing;
+  if (gt_expect_false(gt_mm_acc_is_over_budget())) return gt_bmi_budget_block_lines(num_lines);
+  if (block_sizing->mode==GT_BMI_BLOCK_FIXED) return num_lines;
+  // Throughput processing the last block (time since it was handed out)
+  if (block_sizing->last_block_size > 0) {
+    struct timeval now;
+    gettimeofday(&now,NULL);
+    const double elapsed = GT_TIME_DIFF(block_sizing->last_block_timestamp,now);
+    if (elapsed > 0.0) {
+      block_sizing->bytes_per_second =
+          gt_bmi_moving_average(block_sizing->bytes_per_second,(double)block_sizing->last_block_size/elapsed);
+    }
+  }
+  if (block_sizing->bytes_per_line==0.0) return GT_MIN(num_lines,GT_BMI_ADAPTIVE_MIN_LINES); // Nothing read yet (probe)
+  // Bytes to read (size target, capped by the time target)
+  double block_size = block_sizing->target_block_size;
+  if (block_sizing->target_block_time > 0.0 && block_sizing->bytes_per_second > 0.0) {
+    block_size = GT_MIN(block_size,block_sizing->bytes_per_second*block_sizing->target_block_time);
+  }
+  uint64_t block_lines = (uint64_t)(block_size/block_sizing->bytes_per_line);
+  block_lines = GT_MIN(GT_MAX(block_lines,GT_BMI_ADAPTIVE_MIN_LINES),GT_BMI_ADAPTIVE_MAX_LINES);
+  return ((block_lines+GT_BMI_ADAPTIVE_LINES_ALIGN-1)/GT_BMI_ADAPTIVE_LINES_ALIGN)*GT_BMI_ADAPTIVE_LINES_ALIGN;
+}
+GT_INLINE void gt_buffered_input_file_block_read(gt_buffered_input_file* const buffered_input_file) {
+  GT_NULL_CHECK(buffered_input_file);
+  gt_bmi_block_sizing* const block_sizing = &buffered_input_file->block_sizing;
+  gt_buffered_input_file_account_block_buffer(buffered_input_file);
+  if (block_sizing->mode==GT_BMI_BLOCK_FIXED) return;
+  block_sizing->last_block_size = gt_vector_get_used(buffered_input_file->block_buffer);
+  if (buffered_input_file->lines_in_buffer > 0) {
+    block_sizing->bytes_per_line = gt_bmi_moving_average(block_sizing->bytes_per_line,
+        (double)block_sizing->last_block_size/(double)buffered_input_file->lines_in_buffer);
+  }
+  gettimeofday(&block_sizing->last_block_timestamp,NULL);
+}
+/*
+ * Byte ranges
+ *   A template belongs to the range holding its first byte. Ranges are cut at the first line
+ *   starting at (or after) the range limit whose tag differs from the previous line's
+ *   (paired-end mates and SAM records of the same template are never split).
+ *   Both sides of a limit are computed the same way, so ranges never overlap nor leave gaps
+ */
+GT_INLINE bool gt_bmi_range_sync_get_tag(
+    const char* const window,const uint64_t window_begin,const uint64_t window_end,
+    const uint64_t file_size,const uint64_t line_begin,gt_string* const tag) {
+  uint64_t pos = line_begin;
+  while (pos<window_end) {
+    const char character = window[pos-window_begin];
+    if (character==TAB || character==SPACE || character==EOL || character==DOS_EOL) break;
+    ++pos;
+  }
+  if (pos==window_end && window_end<file_size) return false; // Window too short
+  gt_string_set_nstring(tag,(char*)window+(line_begin-window_begin),pos-line_begin);
+  gt_input_parse_tag_chomp_pairend_info(tag);
+  return true;
+}
+GT_INLINE uint64_t gt_bmi_range_sync_window(
+    const char* const window,const uint64_t window_begin,const uint64_t window_end,
+    const uint64_t data_begin,const uint64_t file_size,const uint64_t offset,
+    gt_string* prev_tag,gt_string* tag) {
+  // Locate the first line starting at (or after) the offset
+  uint64_t line_begin = offset;
+  while (line_begin<window_end && window[line_begin-1-window_begin]!=EOL) ++line_begin;
+  if (window[line_begin-1-window_begin]!=EOL) return (window_end==file_size) ? file_size : UINT64_MAX;
+  if (line_begin>=file_size) return file_size;
+  // Locate the previous line
+  uint64_t prev_line_begin = line_begin-1;
+  while (prev_line_begin>window_begin && window[prev_line_begin-1-window_begin]!=EOL) --prev_line_begin;
+  if (prev_line_begin==window_begin && window_begin>data_begin) return UINT64_MAX; // Window too short
+  if (!gt_bmi_range_sync_get_tag(window,window_begin,window_end,file_size,prev_line_begin,prev_tag)) return UINT64_MAX;
+  // Skip lines belonging to the previous template
+  while (true) {
+    if (!gt_bmi_range_sync_get_tag(window,window_begin,window_end,file_size,line_begin,tag)) return UINT64_MAX;
+    if (!gt_string_equals(prev_tag,tag)) return line_begin;
+    while (line_begin<window_end && window[line_begin-window_begin]!=EOL) ++line_begin;
+    if (line_begin==window_end) return (window_end==file_size) ? file_size : UINT64_MAX;
+    if (++line_begin>=file_size) return file_size;
+    GT_SWAP(prev_tag,tag);
+  }
+}
+GT_INLINE uint64_t gt_buffered_input_file_range_sync(
+    gt_buffered_input_file* const buffered_input_file,const uint64_t offset,
+    gt_string* const prev_tag,gt_string* const tag) {
+  gt_input_file* const input_file = buffered_input_file->input_file;
+  const uint64_t data_begin = input_file->ranges->data_begin;
+  const uint64_t file_size = input_file->file_size;
+  if (offset<=data_begin) return data_begin;
+  if (offset>=file_size) return file_size;
+  // Read a window around the offset (doubling it until it holds the records involved)
+  uint64_t window_size = GT_BMI_RANGE_SYNC_WINDOW;
+  while (true) {
+    const uint64_t window_begin = (offset-data_begin > window_size) ? offset-window_size : data_begin;
+    const uint64_t window_end = (file_size-offset > window_size) ? offset+window_size : file_size;
+    gt_input_file_pread(input_file,window_begin,window_end-window_begin,buffered_input_file->block_buffer);
+    const uint64_t sync_offset = gt_bmi_range_sync_window(
+        gt_vector_get_mem(buffered_input_file->block_buffer,char),window_begin,window_end,
+        data_begin,file_size,offset,prev_tag,tag);
+    if (sync_offset!=UINT64_MAX) return sync_offset;
+    window_size *= 2;
+  }
+}
+GT_INLINE void gt_bmi_range_strip_dos_eols(gt_vector* const block_buffer) {
+  gt_vector_unset_view(block_buffer,true); // Views are read-only
+  char* const block = gt_vector_get_mem(block_buffer,char);
+  const uint64_t block_length = gt_vector_get_used(block_buffer);
+  uint64_t i, j;
+  for (i=0,j=0;i<block_length;++i) {
+    if (block[i]==DOS_EOL) {
+      if (i+1<block_length && block[i+1]==EOL) continue;
+      block[j++] = EOL;
+    } else {
+      block[j++] = block[i];
+    }
+  }
+  gt_vector_set_used(block_buffer,j);
+}
+GT_INLINE gt_status gt_buffered_input_file_get_range_block(gt_buffered_input_file* const buffered_input_file) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_input_file);
+  gt_input_file* const input_file = buffered_input_file->input_file;
+  gt_vector* const block_buffer = buffered_input_file->block_buffer;
+  gt_string* const prev_tag = gt_string_new(0);
+  gt_string* const tag = gt_string_new(0);
+  uint64_t block_id, range_begin, range_end, block_begin, block_end;
+  do {
+    if (!gt_input_file_next_range(input_file,&block_id,&range_begin,&range_end)) {
+      gt_string_delete(prev_tag);
+      gt_string_delete(tag);
+      return GT_BMI_EOF;
+    }
+    buffered_input_file->block_id = block_id % UINT32_MAX;
+    // Resync to record boundaries (empty if a single template spans the whole range)
+    block_begin = gt_buffered_input_file_range_sync(buffered_input_file,range_begin,prev_tag,tag);
+    block_end = gt_buffered_input_file_range_sync(buffered_input_file,range_end,prev_tag,tag);
+    if (block_begin<block_end) break;
+    // Keep the block ID sequence (and the output order) dumping an empty block
+    gt_buffered_input_file_set_id_attached_buffers(buffered_input_file->attached_buffered_output_file,buffered_input_file->block_id);
+    gt_buffered_input_file_dump_attached_buffers(buffered_input_file->attached_buffered_output_file);
+  } while (true);
+  gt_string_delete(prev_tag);
+  gt_string_delete(tag);
+  // Read the block
+  gt_input_file_read_range(input_file,block_begin,block_end-block_begin,block_buffer);
+  if (*gt_vector_get_last_elm(block_buffer,char)!=EOL) {
+    gt_vector_unset_view(block_buffer,true);
+    gt_vector_insert(block_buffer,EOL,char);
+  }
+  uint64_t lines_in_block;
+  bool dos_eol;
+  gt_input_file_scan_eols(gt_vector_get_mem(block_buffer,uint8_t),
+      gt_vector_get_used(block_buffer),UINT64_MAX,&lines_in_block,&dos_eol);
+  if (gt_expect_false(dos_eol)) gt_bmi_range_strip_dos_eols(block_buffer);
+  // Setup the block (line numbers are relative to the range)
+  buffered_input_file->lines_in_buffer = lines_in_block;
+  buffered_input_file->current_line_num = 1;
+  buffered_input_file->cursor = gt_vector_get_mem(block_buffer,char);
+  gt_buffered_input_file_account_block_buffer(buffered_input_file);
+  return buffered_input_file->lines_in_buffer;
+}
+/*
+ * Input file sets
+ */
+GT_INLINE bool gt_buffered_input_file_next_input(gt_buffered_input_file* const buffered_input_file) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_input_file);
+  if (buffered_input_file->input_file_set==NULL) return false;
+  gt_input_file* const next_input_file =
+      gt_input_file_set_next(buffered_input_file->input_file_set,buffered_input_file->input_file);
+  if (next_input_file==NULL) return false;
+  buffered_input_file->input_file = next_input_file;
+  return true;
+}
 /*
  * Block Synchronization with Output
  *   In the weird case that multiple buffers are attached,
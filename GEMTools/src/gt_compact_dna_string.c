@@ -106,6 +106,7 @@ GT_INLINE gt_compact_dna_string* gt_cdna_string_new(const uint64_t initial_chars
   cdna_string->bitmaps = gt_malloc(GT_CDNA_GET_BLOCKS_MEM(initial_blocks));
   gt_cond_fatal_error(!cdna_string->bitmaps,MEM_ALLOC);
   cdna_string->allocated = GT_CDNA_GET_NUM_CHARS(initial_blocks);
+  gt_mm_acc_add(GT_MM_ACC_ARCHIVE,GT_CDNA_GET_BLOCKS_MEM(initial_blocks));
   cdna_string->length = 0;
   GT_CDNA_INIT_BLOCK(cdna_string->bitmaps); // Init 0-block
   return cdna_string;
@@ -116,6 +117,8 @@ GT_INLINE void gt_cdna_string_resize(gt_compact_dna_string* const cdna_string,co
     const uint64_t num_blocks = GT_CDNA_GET_NUM_BLOCKS(num_chars);
     cdna_string->bitmaps=realloc(cdna_string->bitmaps,GT_CDNA_GET_BLOCKS_MEM(num_blocks));
     gt_cond_fatal_error(!cdna_string->bitmaps,MEM_REALLOC);
+    gt_mm_acc_resize(GT_MM_ACC_ARCHIVE,
+        GT_CDNA_GET_BLOCKS_MEM(GT_CDNA_GET_NUM_BLOCKS(cdna_string->allocated)),GT_CDNA_GET_BLOCKS_MEM(num_blocks));
     cdna_string->allocated = GT_CDNA_GET_NUM_CHARS(num_blocks);
   }
 }
@@ -126,6 +129,7 @@ GT_INLINE void gt_cdna_string_clear(gt_compact_dna_string* const cdna_string) {
 }
 GT_INLINE void gt_cdna_string_delete(gt_compact_dna_string* const cdna_string) {
   GT_COMPACT_DNA_STRING_CHECK(cdna_string);
+  gt_mm_acc_sub(GT_MM_ACC_ARCHIVE,GT_CDNA_GET_BLOCKS_MEM(GT_CDNA_GET_NUM_BLOCKS(cdna_string->allocated)));
   gt_free(cdna_string->bitmaps);
   gt_free(cdna_string);
 }
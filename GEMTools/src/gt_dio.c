@@ -0,0 +1,107 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_dio.c
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Direct I/O reader
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE // O_DIRECT
+#endif
+#include "gt_dio.h"
+
+#ifdef HAVE_OPENMP
+#include <omp.h>
+#endif
+
+#define GT_DIO_ALIGN_UP(value) (((value)+(GT_DIO_ALIGNMENT-1)) & ~((uint64_t)GT_DIO_ALIGNMENT-1))
+#define GT_DIO_ALIGN_DOWN(value) ((value) & ~((uint64_t)GT_DIO_ALIGNMENT-1))
+
+/*
+ * Setup
+ */
+GT_INLINE gt_dio_reader* gt_dio_reader_open(char* const file_name) {
+  GT_NULL_CHECK(file_name);
+  gt_dio_reader* const dio_reader = gt_alloc(gt_dio_reader);
+  struct stat stat_info;
+  gt_cond_fatal_error__perror(stat(file_name,&stat_info)==-1,FILE_STAT,file_name);
+  dio_reader->file_name = file_name;
+  dio_reader->file_size = stat_info.st_size;
+  dio_reader->offset = 0;
+  // Open bypassing the page cache (fall back to buffered reads if the filesystem refuses it)
+#ifdef O_DIRECT
+  dio_reader->fildes = open(file_name,O_RDONLY|O_DIRECT,0);
+  dio_reader->direct_io = (dio_reader->fildes!=-1);
+  if (!dio_reader->direct_io) dio_reader->fildes = open(file_name,O_RDONLY,0);
+#else
+  dio_reader->fildes = open(file_name,O_RDONLY,0);
+  dio_reader->direct_io = false;
+#endif
+  gt_cond_fatal_error__perror(dio_reader->fildes==-1,FILE_OPEN,file_name);
+  // Short reads can leave the next request unaligned (O_DIRECT would refuse it)
+  if (dio_reader->direct_io) {
+    dio_reader->fildes_buffered = open(file_name,O_RDONLY,0);
+    gt_cond_fatal_error__perror(dio_reader->fildes_buffered==-1,FILE_OPEN,file_name);
+  } else {
+    dio_reader->fildes_buffered = dio_reader->fildes;
+  }
+  return dio_reader;
+}
+GT_INLINE gt_status gt_dio_reader_close(gt_dio_reader* const dio_reader) {
+  GT_DIO_READER_CHECK(dio_reader);
+  gt_status status = 0;
+  if (dio_reader->fildes_buffered!=dio_reader->fildes) status = close(dio_reader->fildes_buffered);
+  status |= close(dio_reader->fildes);
+  gt_free(dio_reader);
+  return status;
+}
+
+/*
+ * Buffers
+ */
+GT_INLINE void* gt_dio_buffer_new(const uint64_t buffer_size) {
+  void* buffer;
+  gt_cond_fatal_error(posix_memalign(&buffer,GT_DIO_ALIGNMENT,GT_DIO_ALIGN_UP(buffer_size))!=0,MEM_ALLOC_INFO,buffer_size);
+  return buffer;
+}
+
+/*
+ * Read
+ *   The chunk is split in GT_DIO_NUM_REQUESTS aligned requests read in parallel.
+ *   All requests but the last one of the file are aligned (and only that one can be short).
+ *   A short read that stops off the alignment is completed through the buffered descriptor
+ */
+GT_INLINE uint64_t gt_dio_reader_read_chunk(
+    gt_dio_reader* const dio_reader,uint8_t* const buffer,const uint64_t buffer_size) {
+  GT_DIO_READER_CHECK(dio_reader);
+  GT_NULL_CHECK(buffer);
+  gt_fatal_check(!GT_MM_MEM_IS_ALIGNED(buffer,4KB),MEM_ALG_FAILED);
+  gt_cond_fatal_error(buffer_size<GT_DIO_ALIGNMENT,FILE_DIRECT_BUFFER_SIZE,buffer_size,(uint64_t)GT_DIO_ALIGNMENT);
+  if (dio_reader->offset>=dio_reader->file_size) return 0;
+  const uint64_t chunk_size = GT_MIN(GT_DIO_ALIGN_DOWN(buffer_size),dio_reader->file_size-dio_reader->offset);
+  const uint64_t request_size = GT_DIO_ALIGN_UP((chunk_size+GT_DIO_NUM_REQUESTS-1)/GT_DIO_NUM_REQUESTS);
+  const int64_t num_requests = (chunk_size+request_size-1)/request_size;
+  bool read_error = false;
+  int64_t i;
+  #pragma omp parallel for num_threads(GT_DIO_NUM_REQUESTS) reduction(|:read_error)
+  for (i=0;i<num_requests;++i) {
+    const uint64_t request_offset = i*request_size;
+    const uint64_t request_length = GT_MIN(request_size,chunk_size-request_offset);
+    const uint64_t io_length = GT_DIO_ALIGN_UP(request_length); // Aligned (EOF cuts it short)
+    uint64_t bytes_read = 0;
+    while (bytes_read<request_length) {
+      const bool aligned = (GT_DIO_ALIGN_DOWN(bytes_read)==bytes_read);
+      const ssize_t pread_bytes = aligned ?
+          pread(dio_reader->fildes,buffer+request_offset+bytes_read,
+              io_length-bytes_read,dio_reader->offset+request_offset+bytes_read) :
+          pread(dio_reader->fildes_buffered,buffer+request_offset+bytes_read,
+              request_length-bytes_read,dio_reader->offset+request_offset+bytes_read);
+      if (pread_bytes<=0) { read_error = true; break; }
+      bytes_read += pread_bytes;
+    }
+  }
+  gt_cond_fatal_error(read_error,FILE_READ,dio_reader->file_name);
+  dio_reader->offset += chunk_size;
+  return chunk_size;
+}
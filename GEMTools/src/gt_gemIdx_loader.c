@@ -117,8 +117,10 @@ GT_INLINE void gt_gemIdx_load_archive(
      * Dump BED into the sequence archive
      */
     // uint64_t* const ptr_block = gt_mm_read_mem(mm,bed_size);
-    sequence_archive->mm = gt_mm_bulk_mmalloc(bed_size,false);
+    sequence_archive->mm = gt_mm_bulk_mmalloc(bed_size,bed_size>=GT_MM_HUGE_PAGE_THRESHOLD);
     sequence_archive->bed = gt_mm_get_base_mem(sequence_archive->mm);
+    gt_mm_acc_add(GT_MM_ACC_ARCHIVE,sequence_archive->mm->allocated);
+    gt_mm_numa_interleave(sequence_archive->bed,bed_size); // Read by all threads
     gt_fm_bulk_read_file(index_file_name,sequence_archive->bed,gt_mm_get_current_position(mm),bed_size);
   }
   // Free MM
@@ -89,4 +89,28 @@ GT_INLINE gt_status gt_gprintf(gt_generic_printer* const generic_printer,const c
   va_end(v_args);
   return chars_printed;
 }
-
+GT_INLINE gt_status gt_gwrite(gt_generic_printer* const generic_printer,const void* const data,const uint64_t length) {
+  GT_GENERIC_PRINTER_CHECK(generic_printer);
+  GT_NULL_CHECK(data);
+  switch (generic_printer->printer_type) {
+    case GT_FILE_PRINTER:
+      gt_cond_fatal_error(fwrite(data,1,length,generic_printer->file)!=length,OUTPUT_FILE_FAIL_WRITE);
+      break;
+    case GT_STRING_PRINTER:
+      gt_string_right_append_string(generic_printer->string,data,length);
+      break;
+    case GT_BUFFER_PRINTER:
+      gt_bwrite(generic_printer->output_buffer,data,length);
+      break;
+    case GT_BOF_PRINTER:
+      gt_bofwrite(generic_printer->buffered_output_file,data,length);
+      break;
+    case GT_OUTPUT_FILE_PRINTER:
+      gt_cond_fatal_error(gt_ofwrite(generic_printer->output_file,data,length)<0,OUTPUT_FILE_FAIL_WRITE);
+      break;
+    default:
+      gt_fatal_error(SELECTION_NOT_IMPLEMENTED);
+      break;
+  }
+  return length;
+}
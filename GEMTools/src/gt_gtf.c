@@ -2,6 +2,7 @@
 
 GT_INLINE gt_gtf_entry* gt_gtf_entry_new(const uint64_t start, const uint64_t end, const gt_strand strand, gt_string* const type){
   gt_gtf_entry* entry = malloc(sizeof(gt_gtf_entry));
+  gt_mm_acc_add(GT_MM_ACC_GTF,sizeof(gt_gtf_entry));
   entry->uid = 0;
   entry->start = start;
   entry->end = end;
@@ -15,6 +16,7 @@ GT_INLINE gt_gtf_entry* gt_gtf_entry_new(const uint64_t start, const uint64_t en
   return entry;
 }
 GT_INLINE void gt_gtf_entry_delete(gt_gtf_entry* const entry){
+  gt_mm_acc_sub(GT_MM_ACC_GTF,sizeof(gt_gtf_entry));
   free(entry);
 }
 
@@ -136,7 +138,7 @@ GT_INLINE bool gt_gtf_contains_ref(const gt_gtf* const gtf, char* const name){
 GT_INLINE gt_string* gt_gtf_get_gene_id(const gt_gtf* const gtf, char* const name){
   if(!gt_gtf_contains_gene_id(gtf, name)){
     gt_string* const gene_id = gt_string_set_new(name);
-    gt_shash_insert(gtf->gene_ids, name, gene_id, gt_string*);
+    gt_shash_insert_string(gtf->gene_ids, name, gene_id);
   }
   return gt_shash_get(gtf->gene_ids, name, gt_string);
 }
@@ -147,7 +149,7 @@ GT_INLINE bool gt_gtf_contains_gene_id(const gt_gtf* const gtf, char* const name
 GT_INLINE gt_string* gt_gtf_get_transcript_id(const gt_gtf* const gtf, char* const name){
   if(!gt_gtf_contains_transcript_id(gtf, name)){
     gt_string* const gene_id = gt_string_set_new(name);
-    gt_shash_insert(gtf->transcript_ids, name, gene_id, gt_string*);
+    gt_shash_insert_string(gtf->transcript_ids, name, gene_id);
   }
   return gt_shash_get(gtf->transcript_ids, name, gt_string);
 }
@@ -158,7 +160,7 @@ GT_INLINE bool gt_gtf_contains_transcript_id(const gt_gtf* const gtf, char* cons
 GT_INLINE gt_string* gt_gtf_get_gene_type(const gt_gtf* const gtf, char* const name){
   if(!gt_gtf_contains_gene_type(gtf, name)){
     gt_string* const gene_type = gt_string_set_new(name);
-    gt_shash_insert(gtf->gene_types, name, gene_type, gt_string*);
+    gt_shash_insert_string(gtf->gene_types, name, gene_type);
   }
   return gt_shash_get(gtf->gene_types, name, gt_string);
 }
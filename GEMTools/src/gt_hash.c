@@ -3,8 +3,81 @@
  * FILE: gt_hash.c
  * DATE: 2/09/2012
  * AUTHOR(S): Santiago Marco-Sola <santiagomsola@gmail.com>
- * DESCRIPTION: // TODO
+ * DESCRIPTION: Open-addressing index & hash functions shared by ihash/shash
  */
 
 #include "gt_hash.h"
+#include "gt_mm.h"
 
+/*
+ * Open-addressing Index
+ */
+GT_INLINE void gt_hash_index_init(gt_hash_index* const hash_index) {
+  hash_index->slots = NULL;
+  hash_index->num_slots = 0;
+}
+GT_INLINE void gt_hash_index_destroy(gt_hash_index* const hash_index) {
+  if (hash_index->slots!=NULL) gt_free(hash_index->slots);
+  gt_hash_index_init(hash_index);
+}
+GT_INLINE void gt_hash_index_clear(gt_hash_index* const hash_index) {
+  if (hash_index->slots!=NULL) memset(hash_index->slots,0,hash_index->num_slots*sizeof(uint64_t));
+}
+GT_INLINE void gt_hash_index_reset(gt_hash_index* const hash_index,const uint64_t num_slots) {
+  if (hash_index->num_slots!=num_slots) {
+    if (hash_index->slots!=NULL) gt_free(hash_index->slots);
+    hash_index->slots = gt_calloc(num_slots,uint64_t,true);
+    hash_index->num_slots = num_slots;
+  } else {
+    gt_hash_index_clear(hash_index);
+  }
+}
+GT_INLINE void gt_hash_index_insert(gt_hash_index* const hash_index,const uint64_t hash,const uint64_t position) {
+  const uint64_t mask = hash_index->num_slots-1;
+  uint64_t slot_num = GT_HASH_INDEX_HOME(hash,hash_index->num_slots);
+  while (hash_index->slots[slot_num]!=0) slot_num = (slot_num+1)&mask;
+  hash_index->slots[slot_num] = GT_HASH_INDEX_SLOT(hash,position);
+}
+GT_INLINE void gt_hash_index_remove(gt_hash_index* const hash_index,const uint64_t slot_num) {
+  const uint64_t mask = hash_index->num_slots-1;
+  uint64_t* const slots = hash_index->slots;
+  // Shift back the following slots of the cluster that can move into the hole
+  uint64_t hole = slot_num, next = (slot_num+1)&mask;
+  while (slots[next]!=0) {
+    const uint64_t home = GT_HASH_INDEX_HOME(slots[next],hash_index->num_slots);
+    if (((next-home)&mask) >= ((next-hole)&mask)) {
+      slots[hole] = slots[next];
+      hole = next;
+    }
+    next = (next+1)&mask;
+  }
+  slots[hole] = 0;
+}
+GT_INLINE bool gt_hash_index_is_full(gt_hash_index* const hash_index,const uint64_t num_elements) {
+  return 2*num_elements > hash_index->num_slots;
+}
+
+/*
+ * Hash functions
+ */
+GT_INLINE uint64_t gt_hash_int64(const int64_t key) {
+  // SplitMix64 finalizer
+  uint64_t hash = (uint64_t)key + 0x9e3779b97f4a7c15ull;
+  hash = (hash ^ (hash>>30)) * 0xbf58476d1ce4e5b9ull;
+  hash = (hash ^ (hash>>27)) * 0x94d049bb133111ebull;
+  return hash ^ (hash>>31);
+}
+GT_INLINE uint64_t gt_hash_string(const char* const key,uint64_t* const key_length) {
+  // FNV-1a
+  uint64_t hash = 0xcbf29ce484222325ull;
+  const char* c;
+  for (c=key;*c!=EOS;++c) {
+    hash ^= (uint8_t)*c;
+    hash *= 0x100000001b3ull;
+  }
+  *key_length = c-key;
+  // Spread the low bits over the high ones (slot tag/home)
+  hash ^= hash>>33;
+  hash *= 0xff51afd7ed558ccdull;
+  return hash ^ (hash>>33);
+}
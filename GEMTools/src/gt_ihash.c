@@ -28,12 +28,61 @@ GT_INLINE void gt_ihash_free_element(gt_ihash_element *ihash_element) {
       break;
   }
 }
-GT_INLINE void gt_ihash_free_ihash_element(gt_ihash_element *ihash_element,const bool free_element) {
-  GT_NULL_CHECK(ihash_element);
-  // Free element
-  if (free_element) gt_ihash_free_element(ihash_element);
-  // Free handler
-  gt_free(ihash_element);
+
+/*
+ * Dense array & Index
+ */
+GT_INLINE void gt_ihash_rebuild_index(gt_ihash* const ihash,const uint64_t num_slots) {
+  gt_hash_index_reset(&ihash->index,num_slots);
+  uint64_t i;
+  for (i=0;i<ihash->elements_used;++i) {
+    if (ihash->elements[i].removed) continue;
+    gt_hash_index_insert(&ihash->index,gt_hash_int64(ihash->elements[i].key),i);
+  }
+}
+GT_INLINE void gt_ihash_compact(gt_ihash* const ihash) {
+  uint64_t i, used = 0;
+  for (i=0;i<ihash->elements_used;++i) {
+    if (!ihash->elements[i].removed) ihash->elements[used++] = ihash->elements[i];
+  }
+  ihash->elements_used = used;
+  gt_ihash_rebuild_index(ihash,ihash->index.num_slots);
+}
+GT_INLINE uint64_t gt_ihash_find_slot(gt_ihash* const ihash,const int64_t key,const uint64_t hash) {
+  if (gt_expect_false(ihash->index.num_slots==0)) return UINT64_MAX;
+  const uint64_t* const slots = ihash->index.slots;
+  const uint64_t mask = ihash->index.num_slots-1;
+  uint64_t slot_num = GT_HASH_INDEX_HOME(hash,ihash->index.num_slots);
+  while (slots[slot_num]!=0) {
+    if (GT_HASH_INDEX_SLOT_MATCHES(slots[slot_num],hash) &&
+        ihash->elements[GT_HASH_INDEX_SLOT_GET_POSITION(slots[slot_num])].key==key) return slot_num;
+    slot_num = (slot_num+1)&mask;
+  }
+  return UINT64_MAX;
+}
+GT_INLINE gt_ihash_element* gt_ihash_add_ihash_element(gt_ihash* const ihash,const int64_t key,const uint64_t hash) {
+  // Make room in the dense array (squeezing out removed elements first)
+  if (gt_expect_false(ihash->elements_used==ihash->elements_allocated)) {
+    if (ihash->num_elements < ihash->elements_used/2) {
+      gt_ihash_compact(ihash);
+    } else {
+      ihash->elements_allocated = (ihash->elements_allocated==0) ? GT_HASH_INITIAL_ELEMENTS : 2*ihash->elements_allocated;
+      ihash->elements = realloc(ihash->elements,ihash->elements_allocated*sizeof(gt_ihash_element));
+      gt_cond_fatal_error(ihash->elements==NULL,MEM_REALLOC);
+    }
+  }
+  // Grow the index
+  if (gt_expect_false(gt_hash_index_is_full(&ihash->index,ihash->num_elements+1))) {
+    gt_ihash_rebuild_index(ihash,(ihash->index.num_slots==0) ? GT_HASH_INDEX_INITIAL_SLOTS : 2*ihash->index.num_slots);
+  }
+  // Add
+  const uint64_t position = ihash->elements_used++;
+  gt_ihash_element* const ihash_element = ihash->elements+position;
+  ihash_element->key = key;
+  ihash_element->removed = false;
+  gt_hash_index_insert(&ihash->index,hash,position);
+  ++(ihash->num_elements);
+  return ihash_element;
 }
 
 /*
@@ -41,26 +90,35 @@ GT_INLINE void gt_ihash_free_ihash_element(gt_ihash_element *ihash_element,const
  */
 GT_INLINE gt_ihash* gt_ihash_new(void) {
   gt_ihash* ihash = gt_alloc(gt_ihash);
-  ihash->ihash_head = NULL; // uthash initializer
+  ihash->elements = NULL;
+  ihash->elements_used = 0;
+  ihash->elements_allocated = 0;
+  ihash->num_elements = 0;
+  gt_hash_index_init(&ihash->index);
   return ihash;
 }
 GT_INLINE void gt_ihash_clear(gt_ihash* const ihash,const bool free_element) {
   GT_HASH_CHECK(ihash);
-  gt_ihash_element *ihash_element, *tmp;
-  HASH_ITER(hh,ihash->ihash_head,ihash_element,tmp) {
-    HASH_DEL(ihash->ihash_head,ihash_element);
-    gt_ihash_free_ihash_element(ihash_element,free_element);
+  if (free_element) {
+    uint64_t i;
+    for (i=0;i<ihash->elements_used;++i) {
+      if (!ihash->elements[i].removed) gt_ihash_free_element(ihash->elements+i);
+    }
   }
+  ihash->elements_used = 0;
+  ihash->num_elements = 0;
+  gt_hash_index_clear(&ihash->index);
 }
 GT_INLINE void gt_ihash_delete(gt_ihash* const ihash,const bool free_element) {
   GT_HASH_CHECK(ihash);
   gt_ihash_clear(ihash,free_element);
+  if (ihash->elements!=NULL) free(ihash->elements);
+  gt_hash_index_destroy(&ihash->index);
   gt_free(ihash);
 }
 GT_INLINE void gt_ihash_destroy(gt_ihash* const ihash) {
   GT_HASH_CHECK(ihash);
-  gt_ihash_clear(ihash,true);
-  gt_free(ihash);
+  gt_ihash_delete(ihash,true);
 }
 
 /*
@@ -68,8 +126,15 @@ GT_INLINE void gt_ihash_destroy(gt_ihash* const ihash) {
  */
 GT_INLINE gt_ihash_element* gt_ihash_get_ihash_element(gt_ihash* const ihash,const int64_t key) {
   GT_HASH_CHECK(ihash);
-  gt_ihash_element *ihash_element;
-  HASH_FIND_INT(ihash->ihash_head,&key,ihash_element);
+  const uint64_t slot_num = gt_ihash_find_slot(ihash,key,gt_hash_int64(key));
+  return (slot_num==UINT64_MAX) ? NULL : ihash->elements+GT_HASH_INDEX_SLOT_GET_POSITION(ihash->index.slots[slot_num]);
+}
+GT_INLINE gt_ihash_element* gt_ihash_get_or_add_ihash_element(gt_ihash* const ihash,const int64_t key) {
+  const uint64_t hash = gt_hash_int64(key);
+  const uint64_t slot_num = gt_ihash_find_slot(ihash,key,hash);
+  if (gt_expect_true(slot_num==UINT64_MAX)) return gt_ihash_add_ihash_element(ihash,key,hash);
+  gt_ihash_element* const ihash_element = ihash->elements+GT_HASH_INDEX_SLOT_GET_POSITION(ihash->index.slots[slot_num]);
+  gt_ihash_free_element(ihash_element);
   return ihash_element;
 }
 GT_INLINE void gt_ihash_insert_primitive(
@@ -77,17 +142,9 @@ GT_INLINE void gt_ihash_insert_primitive(
   GT_HASH_CHECK(ihash);
   GT_ZERO_CHECK(element_size);
   GT_NULL_CHECK(element);
-  gt_ihash_element* ihash_element = gt_ihash_get_ihash_element(ihash,key);
-  if (gt_expect_true(ihash_element==NULL)) {
-    ihash_element = gt_alloc(gt_ihash_element);
-    ihash_element->key = key;
-    ihash_element->element = element;
-    HASH_ADD_INT(ihash->ihash_head,key,ihash_element);
-  } else {
-    gt_ihash_free_element(ihash_element);
-    ihash_element->element = element;
-  }
-  // Set shash element type
+  gt_ihash_element* const ihash_element = gt_ihash_get_or_add_ihash_element(ihash,key);
+  ihash_element->element = element;
+  // Set ihash element type
   ihash_element->element_type = GT_HASH_TYPE_REGULAR;
   ihash_element->element_size = element_size;
 }
@@ -97,16 +154,8 @@ GT_INLINE void gt_ihash_insert_object(
   GT_HASH_CHECK(ihash);
   GT_NULL_CHECK(object);
   GT_NULL_CHECK(element_dup_fx); GT_NULL_CHECK(element_free_fx);
-  gt_ihash_element* ihash_element = gt_ihash_get_ihash_element(ihash,key);
-  if (gt_expect_true(ihash_element==NULL)) {
-    ihash_element = gt_alloc(gt_ihash_element);
-    ihash_element->key = key;
-    ihash_element->element = object;
-    HASH_ADD_INT(ihash->ihash_head,key,ihash_element);
-  } else {
-    gt_ihash_free_element(ihash_element);
-    ihash_element->element = object;
-  }
+  gt_ihash_element* const ihash_element = gt_ihash_get_or_add_ihash_element(ihash,key);
+  ihash_element->element = object;
   // Set ihash element type
   ihash_element->element_type = GT_HASH_TYPE_OBJECT;
   ihash_element->element_setup.element_dup_fx = element_dup_fx;
@@ -119,10 +168,13 @@ GT_INLINE void* gt_ihash_get_element(gt_ihash* const ihash,const int64_t key) {
 }
 GT_INLINE void gt_ihash_remove(gt_ihash* const ihash,const int64_t key,const bool free_element) {
   GT_HASH_CHECK(ihash);
-  gt_ihash_element *ihash_element = gt_ihash_get_ihash_element(ihash,key);
-  if (ihash_element) {
-    HASH_DEL(ihash->ihash_head,ihash_element);
-    gt_ihash_free_ihash_element(ihash_element,free_element);
+  const uint64_t slot_num = gt_ihash_find_slot(ihash,key,gt_hash_int64(key));
+  if (slot_num!=UINT64_MAX) {
+    gt_ihash_element* const ihash_element = ihash->elements+GT_HASH_INDEX_SLOT_GET_POSITION(ihash->index.slots[slot_num]);
+    if (free_element) gt_ihash_free_element(ihash_element);
+    ihash_element->removed = true;
+    gt_hash_index_remove(&ihash->index,slot_num);
+    --(ihash->num_elements);
   }
 }
 
@@ -135,7 +187,7 @@ GT_INLINE bool gt_ihash_is_contained(gt_ihash* const ihash,const int64_t key) {
 }
 GT_INLINE uint64_t gt_ihash_get_num_elements(gt_ihash* const ihash) {
   GT_HASH_CHECK(ihash);
-  return (uint64_t)HASH_COUNT(ihash->ihash_head);
+  return ihash->num_elements;
 }
 
 /*
@@ -167,32 +219,39 @@ GT_INLINE void gt_ihash_copy(gt_ihash* const ihash_dst,gt_ihash* const ihash_src
     }
   } GT_IHASH_END_ITERATE;
 }
-int gt_ihash_cmp_keys(int64_t* a,int64_t* b) {
+int gt_ihash_cmp_keys(const gt_ihash_element* const a,const gt_ihash_element* const b) {
   /*
    * return (int) -1 if (a < b)
    * return (int)  0 if (a == b)
    * return (int)  1 if (a > b)
    */
-  return a-b;
+  return (a->key > b->key) - (a->key < b->key);
 }
-#define gt_ihash_cmp_keys_wrapper(arg1,arg2) gt_ihash_cmp_keys((int64_t*)arg1,(int64_t*)arg2)
 GT_INLINE void gt_ihash_sort_by_key(gt_ihash* const ihash) {
   GT_HASH_CHECK(ihash);
-  // Sort
-  HASH_SORT(ihash->ihash_head,gt_ihash_cmp_keys_wrapper);
+  if (ihash->num_elements==0) return;
+  // Sort the dense array (once compacted) and reindex it
+  if (ihash->num_elements < ihash->elements_used) gt_ihash_compact(ihash);
+  qsort(ihash->elements,ihash->elements_used,sizeof(gt_ihash_element),
+      (int (*)(const void *,const void *))gt_ihash_cmp_keys);
+  gt_ihash_rebuild_index(ihash,ihash->index.num_slots);
 }
 
-
 /*
  * Iterator
  */
+GT_INLINE void gt_ihash_iterator_init(gt_ihash_iterator* const ihash_iterator,gt_ihash* const ihash) {
+  GT_HASH_CHECK(ihash);
+  ihash_iterator->ihash = ihash;
+  ihash_iterator->next = 0;
+  ihash_iterator->current = NULL;
+}
 GT_INLINE gt_ihash_iterator* gt_ihash_iterator_new(gt_ihash* const ihash) {
   GT_HASH_CHECK(ihash);
   // Allocate
   gt_ihash_iterator* const ihash_iterator = gt_alloc(gt_ihash_iterator);
   // Init
-  ihash_iterator->ihash = ihash;
-  ihash_iterator->next = ihash;
+  gt_ihash_iterator_init(ihash_iterator,ihash);
   return ihash_iterator;
 }
 GT_INLINE void gt_ihash_iterator_delete(gt_ihash_iterator* const ihash_iterator) {
@@ -201,18 +260,24 @@ GT_INLINE void gt_ihash_iterator_delete(gt_ihash_iterator* const ihash_iterator)
 }
 GT_INLINE bool gt_ihash_iterator_next(gt_ihash_iterator* const ihash_iterator) {
   GT_HASH_CHECK(ihash_iterator->ihash);
-  if (gt_expect_false(ihash_iterator->next==NULL)) return false;
-  ihash_iterator->next = ihash_iterator->next->hh.next;
-  return true;
+  gt_ihash* const ihash = ihash_iterator->ihash;
+  while (ihash_iterator->next < ihash->elements_used) {
+    gt_ihash_element* const ihash_element = ihash->elements+(ihash_iterator->next++);
+    if (!ihash_element->removed) {
+      ihash_iterator->current = ihash_element;
+      return true;
+    }
+  }
+  ihash_iterator->current = NULL;
+  return false;
 }
 GT_INLINE int64_t gt_ihash_iterator_get_key(gt_ihash_iterator* const ihash_iterator) {
   GT_HASH_CHECK(ihash_iterator->ihash);
-  GT_HASH_CHECK(ihash_iterator->next);
-  return ihash_iterator->next->key;
+  GT_HASH_CHECK(ihash_iterator->current);
+  return ihash_iterator->current->key;
 }
 GT_INLINE void* gt_ihash_iterator_get_element(gt_ihash_iterator* const ihash_iterator) {
   GT_HASH_CHECK(ihash_iterator->ihash);
-  GT_HASH_CHECK(ihash_iterator->next);
-  return ihash_iterator->next->element;
+  GT_HASH_CHECK(ihash_iterator->current);
+  return ihash_iterator->current->element;
 }
-
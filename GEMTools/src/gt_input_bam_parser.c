@@ -0,0 +1,660 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_input_bam_parser.c
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Input parser for BAM format
+ */
+
+#include "gt_input_bam_parser.h"
+
+// Constants
+#define GT_IBP_NUM_RECORDS GT_NUM_LINES_10K
+#define GT_IBP_NUM_INITIAL_MAPS 5
+
+/*
+ * BAM record layout (little-endian)
+ *   block_size | refID | pos | l_read_name,mapq,bin | n_cigar_op,flag | l_seq | next_refID | next_pos | tlen |
+ *   read_name[l_read_name] | cigar[n_cigar_op] | seq[(l_seq+1)/2] | qual[l_seq] | tags...
+ */
+#define GT_BAM_BLOCK_SIZE   0
+#define GT_BAM_REF_ID       4
+#define GT_BAM_POS          8
+#define GT_BAM_L_READ_NAME 12
+#define GT_BAM_MAPQ        13
+#define GT_BAM_N_CIGAR_OP  16
+#define GT_BAM_FLAG        18
+#define GT_BAM_L_SEQ       20
+#define GT_BAM_NEXT_REF_ID 24
+#define GT_BAM_NEXT_POS    28
+#define GT_BAM_READ_NAME   36
+
+// NOTE: BAM is little-endian, so is the host (loads are unaligned, thus memcpy)
+GT_INLINE uint32_t gt_bam_get_uint32(const uint8_t* const mem) {
+  uint32_t value;
+  memcpy(&value,mem,sizeof(uint32_t));
+  return value;
+}
+GT_INLINE int32_t gt_bam_get_int32(const uint8_t* const mem) {
+  int32_t value;
+  memcpy(&value,mem,sizeof(int32_t));
+  return value;
+}
+GT_INLINE uint16_t gt_bam_get_uint16(const uint8_t* const mem) {
+  uint16_t value;
+  memcpy(&value,mem,sizeof(uint16_t));
+  return value;
+}
+#define gt_bam_record_size(record) (sizeof(uint32_t)+gt_bam_get_uint32((record)+GT_BAM_BLOCK_SIZE))
+#define gt_bam_record_read_name(record) ((char*)(record)+GT_BAM_READ_NAME)
+#define gt_bam_record_read_name_length(record) ((uint64_t)(record)[GT_BAM_L_READ_NAME]-1) // Without the NUL
+
+/*
+ * BAM File Format test
+ *   magic | l_text | text[l_text] | n_ref | { l_name | name[l_name] | l_ref }*n_ref
+ *   Reads the binary header (reference names are interned, indexed by refID)
+ */
+GT_INLINE bool gt_input_bam_parser_read_headers(
+    const uint8_t* const buffer,const uint64_t buffer_size,
+    gt_bam_headers* const bam_headers,uint64_t* const characters_read) {
+  uint64_t buffer_pos = GT_BAM_MAGIC_LENGTH;
+  // Skip text header
+  if (buffer_pos+sizeof(int32_t) > buffer_size) return false;
+  const int32_t l_text = gt_bam_get_int32(buffer+buffer_pos);
+  if (l_text<0) return false;
+  buffer_pos += sizeof(int32_t)+l_text;
+  // References
+  if (buffer_pos+sizeof(int32_t) > buffer_size) return false;
+  const int32_t n_ref = gt_bam_get_int32(buffer+buffer_pos);
+  if (n_ref<0) return false;
+  buffer_pos += sizeof(int32_t);
+  int32_t i;
+  for (i=0;i<n_ref;++i) {
+    if (buffer_pos+sizeof(int32_t) > buffer_size) return false;
+    const int32_t l_name = gt_bam_get_int32(buffer+buffer_pos);
+    if (l_name<1) return false;
+    buffer_pos += sizeof(int32_t);
+    if (buffer_pos+l_name+sizeof(int32_t) > buffer_size) return false;
+    if (bam_headers!=NULL) {
+      const uint32_t seq_name_id = gt_seq_name_intern((char*)buffer+buffer_pos,l_name-1);
+      gt_vector_insert(bam_headers->reference_ids,seq_name_id,uint32_t);
+    }
+    buffer_pos += l_name+sizeof(int32_t);
+  }
+  *characters_read = buffer_pos;
+  return true;
+}
+GT_INLINE bool gt_input_file_test_bam(
+    gt_input_file* const input_file,gt_bam_headers* const bam_headers,const bool show_errors) {
+  GT_INPUT_FILE_CHECK(input_file);
+  GT_NULL_CHECK(bam_headers);
+  const uint8_t* const buffer = input_file->file_buffer;
+  const uint64_t buffer_size = input_file->buffer_size;
+  if (buffer_size<GT_BAM_MAGIC_LENGTH || memcmp(buffer,GT_BAM_MAGIC,GT_BAM_MAGIC_LENGTH)!=0) return false;
+  // Check the header is complete (otherwise the prefix has to be extended)
+  uint64_t characters_read;
+  if (!gt_input_bam_parser_read_headers(buffer,buffer_size,NULL,&characters_read)) return false;
+  // Read it
+  gt_bam_headers_init(bam_headers);
+  gt_input_bam_parser_read_headers(buffer,buffer_size,bam_headers,&characters_read);
+  input_file->buffer_begin = characters_read;
+  input_file->buffer_pos = characters_read;
+  input_file->processed_lines = 0;
+  return true;
+}
+
+/*
+ * BAM File basics
+ */
+/* Error handler */
+GT_INLINE void gt_input_bam_parser_prompt_error(
+    gt_buffered_input_file* const buffered_bam_input,const uint64_t record_num,const gt_status error_code) {
+  // Display textual error msg
+  const char* const file_name = buffered_bam_input->input_file->file_name;
+  switch (error_code) {
+    case 0: /* No error */ break;
+    case GT_IBP_PE_WRONG_FILE_FORMAT: gt_error(PARSE_BAM_BAD_FILE_FORMAT,file_name,record_num); break;
+    case GT_IBP_PE_TRUNCATED_RECORD: gt_error(PARSE_BAM_TRUNCATED_RECORD,file_name,record_num); break;
+    case GT_IBP_PE_CORRUPTED_RECORD: gt_error(PARSE_BAM_CORRUPTED_RECORD,file_name,record_num); break;
+    case GT_IBP_PE_BAD_REFERENCE: gt_error(PARSE_BAM_BAD_REFERENCE,file_name,record_num); break;
+    case GT_IBP_PE_BAD_CIGAR: gt_error(PARSE_BAM_BAD_CIGAR,file_name,record_num); break;
+    case GT_IBP_PE_UNMAPPED_XA: gt_error(PARSE_BAM_UNMAPPED_XA,file_name,record_num); break;
+    case GT_IBP_PE_UNSOLVED_PENDING_MAPS: gt_error(PARSE_BAM_UNSOLVED_PENDING_MAPS,file_name,record_num); break;
+    default:
+      gt_error(PARSE_BAM,file_name,record_num);
+      break;
+  }
+}
+/* BAM file. Skip record */
+GT_INLINE void gt_input_bam_parser_next_record(gt_buffered_input_file* const buffered_bam_input) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_bam_input);
+  if (!gt_buffered_input_file_eob(buffered_bam_input)) {
+    buffered_bam_input->cursor += gt_bam_record_size((uint8_t*)buffered_bam_input->cursor);
+    ++buffered_bam_input->current_line_num;
+  }
+}
+/* Length of the tag without the pair info (/1,/2,/3), as gt_input_parse_tag_chomp_pairend_info() */
+GT_INLINE uint64_t gt_ibp_chomp_pairend_info(const char* const tag,const uint64_t tag_length) {
+  if (tag_length>2 && tag[tag_length-2]==SLASH &&
+      (tag[tag_length-1]=='1' || tag[tag_length-1]=='2' || tag[tag_length-1]=='3')) return tag_length-2;
+  return tag_length;
+}
+
+/*
+ * BAM file. Reload internal buffer
+ */
+/* BAM file. Read one record (appended to @buffer_dst) */
+GT_INLINE gt_status gt_input_bam_parser_read_record(gt_input_file* const input_file,gt_vector* const buffer_dst) {
+  const uint64_t record_offset = gt_vector_get_used(buffer_dst);
+  const uint64_t bytes_read = gt_input_file_add_bytes(input_file,buffer_dst,sizeof(uint32_t));
+  if (bytes_read==0) return GT_IBP_EOF;
+  if (bytes_read<sizeof(uint32_t)) return GT_IBP_PE_TRUNCATED_RECORD;
+  const uint32_t block_size = gt_bam_get_uint32(gt_vector_get_mem(buffer_dst,uint8_t)+record_offset);
+  if (block_size<GT_BAM_RECORD_MIN_SIZE) return GT_IBP_PE_CORRUPTED_RECORD;
+  if (gt_input_file_add_bytes(input_file,buffer_dst,block_size)<block_size) return GT_IBP_PE_TRUNCATED_RECORD;
+  // The read name has to be there (records are compared by QNAME as soon as read)
+  const uint8_t* const record = gt_vector_get_mem(buffer_dst,uint8_t)+record_offset;
+  if (record[GT_BAM_L_READ_NAME]==0 || GT_BAM_READ_NAME+record[GT_BAM_L_READ_NAME]>gt_bam_record_size(record)) {
+    return GT_IBP_PE_CORRUPTED_RECORD;
+  }
+  return GT_IBP_OK;
+}
+/* BAM file. Synchronized get block wrt to BAM records (records of the same QNAME go to the same block) */
+GT_INLINE gt_status gt_input_bam_parser_get_block(
+    gt_buffered_input_file* const buffered_bam_input,const uint64_t num_records) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_bam_input);
+  gt_input_file* const input_file = buffered_bam_input->input_file;
+  gt_bam_headers* const bam_headers = &input_file->bam_headers;
+  gt_vector* const block_buffer = buffered_bam_input->block_buffer;
+  gt_input_file_lock(input_file);
+  if (input_file->eof && gt_vector_is_empty(bam_headers->next_record)) {
+    gt_input_file_unlock(input_file);
+    return GT_IBP_EOF;
+  }
+  buffered_bam_input->current_line_num = input_file->processed_lines+1;
+  gt_vector_clear(block_buffer); // Clear dst buffer
+  // Record read ahead by the previous block
+  uint64_t records_read = 0, last_record_offset = 0;
+  if (!gt_vector_is_empty(bam_headers->next_record)) {
+    const uint64_t record_size = gt_vector_get_used(bam_headers->next_record);
+    gt_vector_reserve(block_buffer,record_size,false);
+    memcpy(gt_vector_get_mem(block_buffer,uint8_t),gt_vector_get_mem(bam_headers->next_record,uint8_t),record_size);
+    gt_vector_set_used(block_buffer,record_size);
+    gt_vector_clear(bam_headers->next_record);
+    ++records_read;
+  }
+  // Read records
+  const uint64_t block_records = gt_buffered_input_file_block_lines(buffered_bam_input,num_records);
+  gt_status error_code = GT_IBP_OK;
+  while (records_read<block_records) {
+    last_record_offset = gt_vector_get_used(block_buffer);
+    if ((error_code=gt_input_bam_parser_read_record(input_file,block_buffer))!=GT_IBP_OK) break;
+    ++records_read;
+  }
+  // Synch wrt to the QNAME (Read ahead until the QNAME changes)
+  if (error_code==GT_IBP_OK && records_read>0) {
+    while (true) {
+      const uint64_t next_record_offset = gt_vector_get_used(block_buffer);
+      if ((error_code=gt_input_bam_parser_read_record(input_file,block_buffer))!=GT_IBP_OK) break;
+      const uint8_t* const last_record = gt_vector_get_mem(block_buffer,uint8_t)+last_record_offset;
+      const uint8_t* const next_record = gt_vector_get_mem(block_buffer,uint8_t)+next_record_offset;
+      const uint64_t last_tag_length = gt_ibp_chomp_pairend_info(
+          gt_bam_record_read_name(last_record),gt_bam_record_read_name_length(last_record));
+      const uint64_t next_tag_length = gt_ibp_chomp_pairend_info(
+          gt_bam_record_read_name(next_record),gt_bam_record_read_name_length(next_record));
+      if (last_tag_length!=next_tag_length ||
+          memcmp(gt_bam_record_read_name(last_record),gt_bam_record_read_name(next_record),last_tag_length)!=0) {
+        // Keep it for the next block
+        const uint64_t record_size = gt_vector_get_used(block_buffer)-next_record_offset;
+        gt_vector_reserve(bam_headers->next_record,record_size,false);
+        memcpy(gt_vector_get_mem(bam_headers->next_record,uint8_t),next_record,record_size);
+        gt_vector_set_used(bam_headers->next_record,record_size);
+        gt_vector_set_used(block_buffer,next_record_offset);
+        break;
+      }
+      last_record_offset = next_record_offset;
+      ++records_read;
+    }
+  }
+  if (error_code!=GT_IBP_OK && error_code!=GT_IBP_EOF) {
+    // Broken record framing. Nothing else can be read
+    gt_input_bam_parser_prompt_error(buffered_bam_input,input_file->processed_lines+records_read+1,error_code);
+    gt_vector_set_used(block_buffer,last_record_offset);
+    input_file->eof = true;
+  }
+  input_file->processed_lines+=records_read;
+  buffered_bam_input->lines_in_buffer = records_read;
+  if (records_read>0) buffered_bam_input->block_id = gt_input_file_next_id(input_file) % UINT32_MAX;
+  gt_input_file_unlock(input_file);
+
+  // Setup the block
+  buffered_bam_input->cursor = gt_vector_get_mem(block_buffer,char);
+  gt_buffered_input_file_block_read(buffered_bam_input);
+  return buffered_bam_input->lines_in_buffer;
+}
+/* BAM file. Reload internal buffer */
+GT_INLINE gt_status gt_input_bam_parser_reload_buffer(gt_buffered_input_file* const buffered_bam_input) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_bam_input);
+  // Dump buffer if BOF it attached to BAM-input, and get new out block (always FIRST)
+  gt_buffered_input_file_dump_attached_buffers(buffered_bam_input->attached_buffered_output_file);
+  // Read new input block (from the next file of the set, if any, once exhausted)
+  uint64_t read_records;
+  do {
+    read_records = gt_input_bam_parser_get_block(buffered_bam_input,GT_IBP_NUM_RECORDS);
+  } while (read_records==0 && gt_buffered_input_file_next_input(buffered_bam_input));
+  if (gt_expect_false(read_records==0)) return GT_IBP_EOF;
+  // Assign block ID
+  gt_buffered_input_file_set_id_attached_buffers(buffered_bam_input->attached_buffered_output_file,buffered_bam_input->block_id);
+  return GT_IBP_OK;
+}
+
+/*
+ * BAM format. Basic building blocks for parsing
+ */
+GT_INLINE void gt_ibp_read_tag(const uint8_t* const record,gt_string* const tag) {
+  char* const tag_begin = gt_bam_record_read_name(record);
+  const uint64_t tag_length = gt_bam_record_read_name_length(record);
+  // Set tag (up to the first SPACE, if any)
+  char* const tag_end = memchr(tag_begin,SPACE,tag_length);
+  gt_string_set_nstring(tag,tag_begin,(tag_end!=NULL) ? tag_end-tag_begin : tag_length);
+}
+GT_INLINE gt_status gt_ibp_get_reference(
+    gt_bam_headers* const bam_headers,const int32_t ref_id,uint32_t* const seq_name_id) {
+  if (gt_expect_false(ref_id<0 || (uint64_t)ref_id>=gt_vector_get_used(bam_headers->reference_ids))) {
+    return GT_IBP_PE_BAD_REFERENCE;
+  }
+  *seq_name_id = *gt_vector_get_elm(bam_headers->reference_ids,ref_id,uint32_t);
+  return 0;
+}
+/*
+ * BAM CIGAR ::
+ *   uint32_t[n_cigar_op] := {op_len<<4|op}, op indexing "MIDNSHP=X"
+ */
+GT_INLINE gt_status gt_ibp_parse_bam_cigar(
+    const uint8_t* const cigar,const uint64_t num_cigar_ops,gt_map** _map,const bool reverse_strand) {
+  gt_map* map = *_map;
+  // Clear mismatches
+  gt_map_clear_misms(map);
+  if (num_cigar_ops==0) return 0; // No CIGAR available
+  // Aux variables as to track the position in the read and the genome span
+  uint64_t i, position = 0, reference_span=0;
+  for (i=0;i<num_cigar_ops;++i) {
+    const uint32_t cigar_op = gt_bam_get_uint32(cigar+i*sizeof(uint32_t));
+    const uint32_t op = cigar_op&0xF;
+    if (gt_expect_false(op>=sizeof(GT_BAM_CIGAR_OPS)-1)) return GT_IBP_PE_BAD_CIGAR;
+    if (gt_isp_cigar_add_op(&map,GT_BAM_CIGAR_OPS[op],cigar_op>>4,&position,&reference_span,reverse_strand)) {
+      return GT_IBP_PE_BAD_CIGAR;
+    }
+  }
+  gt_isp_cigar_close(_map,map,position,reverse_strand);
+  return 0;
+}
+/*
+ * BAM SEQ/QUAL
+ *   Bases are packed two per byte (high nibble first), codes indexing "=ACMGRSVTWYHKDBN"
+ *   Qualities are raw phred values (0xFF if missing)
+ */
+GT_INLINE void gt_ibp_parse_bam_seq(gt_string* const read,const uint8_t* const seq,const uint64_t length) {
+  if (gt_string_is_static(read)) gt_string_cast_dynamic(read,length+1);
+  gt_string_resize(read,length+1);
+  char* const buffer = gt_string_get_string(read);
+  uint64_t i;
+  for (i=0;i<length;++i) {
+    const uint8_t code = (i&1) ? (seq[i>>1]&0xF) : (seq[i>>1]>>4);
+    buffer[i] = gt_get_dna_normalized(GT_BAM_SEQ_CODES[code]);
+  }
+  buffer[length] = EOS;
+  gt_string_set_length(read,length);
+}
+GT_INLINE void gt_ibp_parse_bam_qual(gt_string* const qualities,const uint8_t* const qual,const uint64_t length) {
+  if (gt_string_is_static(qualities)) gt_string_cast_dynamic(qualities,length+1);
+  gt_string_resize(qualities,length+1);
+  char* const buffer = gt_string_get_string(qualities);
+  uint64_t i;
+  for (i=0;i<length;++i) buffer[i] = qual[i]+33;
+  buffer[length] = EOS;
+  gt_string_set_length(qualities,length);
+}
+/*
+ * BAM optional fields (tag[2] | type | value)
+ *   Returns the XA:Z value (NULL if none). Fails if a field runs past the record
+ */
+GT_INLINE gt_status gt_ibp_parse_bam_optional_fields(
+    const uint8_t* const opt_fields,const uint8_t* const record_end,char** const xa_value) {
+  const uint8_t* field = opt_fields;
+  *xa_value = NULL;
+  while (field<record_end) {
+    if (field+3>record_end) return GT_IBP_PE_CORRUPTED_RECORD;
+    const char type = field[2];
+    const uint8_t* const value = field+3;
+    uint64_t value_size;
+    switch (type) {
+      case 'A': case 'c': case 'C': value_size = 1; break;
+      case 's': case 'S': value_size = 2; break;
+      case 'i': case 'I': case 'f': value_size = 4; break;
+      case 'Z': case 'H': {
+        const uint8_t* const value_end = memchr(value,EOS,record_end-value);
+        if (value_end==NULL) return GT_IBP_PE_CORRUPTED_RECORD;
+        if (field[0]=='X' && field[1]=='A' && type=='Z') *xa_value = (char*)value;
+        value_size = (value_end-value)+1;
+        break;
+      }
+      case 'B': {
+        if (value+1+sizeof(uint32_t)>record_end) return GT_IBP_PE_CORRUPTED_RECORD;
+        const uint64_t num_elements = gt_bam_get_uint32(value+1);
+        switch (value[0]) {
+          case 'c': case 'C': value_size = 1; break;
+          case 's': case 'S': value_size = 2; break;
+          case 'i': case 'I': case 'f': value_size = 4; break;
+          default: return GT_IBP_PE_CORRUPTED_RECORD;
+        }
+        value_size = 1+sizeof(uint32_t)+num_elements*value_size;
+        break;
+      }
+      default:
+        return GT_IBP_PE_CORRUPTED_RECORD;
+    }
+    if (value+value_size>record_end) return GT_IBP_PE_CORRUPTED_RECORD;
+    field = value+value_size;
+  }
+  return 0;
+}
+
+/*
+ * BAM record (same semantics as the SAM record, see gt_input_sam_parser.c)
+ */
+GT_INLINE gt_status gt_ibp_parse_bam_alignment(
+    gt_bam_headers* const bam_headers,const uint8_t* const record,
+    gt_template* const _template,gt_alignment* const _alignment,
+    uint64_t* const alignment_flag,gt_sam_pending_end* const pending,const bool override_pairing) {
+  gt_status error_code;
+  bool is_mapped = true, is_single_segment;
+  /*
+   * Locate the variable-length fields
+   */
+  const uint8_t* const record_end = record+gt_bam_record_size(record);
+  const uint64_t l_read_name = record[GT_BAM_L_READ_NAME];
+  const uint64_t num_cigar_ops = gt_bam_get_uint16(record+GT_BAM_N_CIGAR_OP);
+  const int32_t l_seq = gt_bam_get_int32(record+GT_BAM_L_SEQ);
+  if (l_seq<0) return GT_IBP_PE_CORRUPTED_RECORD;
+  const uint8_t* const cigar = record+GT_BAM_READ_NAME+l_read_name;
+  const uint8_t* const seq = cigar+num_cigar_ops*sizeof(uint32_t);
+  const uint8_t* const qual = seq+(l_seq+1)/2;
+  const uint8_t* const opt_fields = qual+l_seq;
+  if (opt_fields>record_end) return GT_IBP_PE_CORRUPTED_RECORD;
+  char* xa_value;
+  if ((error_code=gt_ibp_parse_bam_optional_fields(opt_fields,record_end,&xa_value))) return error_code;
+  gt_map* map = gt_map_new();
+  /*
+   * FLAG
+   */
+  *alignment_flag = gt_bam_get_uint16(record+GT_BAM_FLAG);
+  // Process flags
+  const bool reverse_strand = (*alignment_flag&GT_SAM_FLAG_REVERSE_COMPLEMENT);
+  is_mapped = !(*alignment_flag&GT_SAM_FLAG_UNMAPPED);
+  is_single_segment = override_pairing || !(*alignment_flag&GT_SAM_FLAG_MULTIPLE_SEGMENTS);
+  pending->end_position = (is_single_segment) ? 0 : ((*alignment_flag&GT_SAM_FLAG_FIRST_SEGMENT)?0:1);
+  if (reverse_strand)  {
+    gt_map_set_strand(map,REVERSE);
+  } else {
+    gt_map_set_strand(map,FORWARD);
+  }
+  // Allocate template/alignment handlers
+  gt_alignment* alignment;
+  if (_template) {
+    alignment = gt_template_get_block_dyn(_template,0);
+    if (pending->end_position==1) {
+      alignment = gt_template_get_block_dyn(_template,1);
+    }
+  } else {
+    GT_NULL_CHECK(_alignment);
+    alignment = _alignment;
+  }
+  if (!gt_attributes_get(alignment->attributes,GT_ATTR_ID_SAM_FLAGS)) {
+    gt_attributes_add(alignment->attributes,GT_ATTR_ID_SAM_FLAGS,alignment_flag,uint64_t);
+  }
+  /*
+   * refID (Sequence-name/Chromosome)
+   */
+  const int32_t ref_id = gt_bam_get_int32(record+GT_BAM_REF_ID);
+  uint32_t seq_name_id = GT_SEQ_NAME_NULL_ID;
+  if (ref_id<0) {
+    is_mapped=false; /* Unmapped */
+  } else {
+    if ((error_code=gt_ibp_get_reference(bam_headers,ref_id,&seq_name_id))) {
+      gt_map_delete(map); return error_code;
+    }
+    gt_map_set_seq_name_id(map,seq_name_id);
+  }
+  /*
+   * POS (0-based, -1 if none)
+   */
+  const int32_t pos = gt_bam_get_int32(record+GT_BAM_POS);
+  map->position = (pos<0) ? 0 : pos+1;
+  if (map->position==0) is_mapped=false; /* Unmapped */
+  /*
+   * MAPQ (Score)
+   */
+  map->phred_score = record[GT_BAM_MAPQ];
+  /*
+   * CIGAR
+   */
+  if ((error_code=gt_ibp_parse_bam_cigar(cigar,num_cigar_ops,&map,reverse_strand))) {
+    gt_map_delete(map); return error_code;
+  }
+  /*
+   * next_refID/next_pos (Sequence-name & Position of the next segment)
+   */
+  const int32_t next_ref_id = gt_bam_get_int32(record+GT_BAM_NEXT_REF_ID);
+  if (next_ref_id<0 || is_single_segment || !is_mapped ||
+      (*alignment_flag&GT_SAM_FLAG_NEXT_UNMAPPED)) {
+    gt_string_clear(&pending->next_seq_name);
+  } else {
+    uint32_t next_seq_name_id;
+    if ((error_code=gt_ibp_get_reference(bam_headers,next_ref_id,&next_seq_name_id))) {
+      gt_map_delete(map); return error_code;
+    }
+    gt_string* const next_seq_name = gt_seq_name_get_string(next_seq_name_id);
+    gt_string_set_nstring(&pending->next_seq_name,next_seq_name->buffer,next_seq_name->length);
+    const int32_t next_pos = gt_bam_get_int32(record+GT_BAM_NEXT_POS);
+    pending->next_position = (next_pos<0) ? 0 : next_pos+1;
+    if (pending->next_position==0) {
+      gt_string_clear(&pending->next_seq_name);
+    } else {
+      gt_string* const map_seq_name = gt_seq_name_get_string(seq_name_id);
+      gt_string_set_nstring(&pending->map_seq_name,map_seq_name->buffer,map_seq_name->length);
+      pending->num_maps = 1;
+      pending->map_position = gt_map_get_global_coordinate(map);
+    }
+  }
+  /*
+   * SEQ (READ)
+   */
+  if (gt_expect_true(l_seq>0)) {
+    if (gt_string_is_null(alignment->read)) {
+      gt_ibp_parse_bam_seq(alignment->read,seq,l_seq);
+      if (reverse_strand) {
+        gt_dna_string_reverse_complement(alignment->read);
+      }
+    }
+    if (gt_map_get_base_length(map)==0) gt_map_set_base_length(map,gt_alignment_get_read_length(alignment));
+    /*
+     * QUAL (QUALITY STRING)
+     */
+    if (gt_expect_true(qual[0]!=GT_BAM_QUAL_MISSING)) {
+      if (gt_string_is_null(alignment->qualities)) {
+        gt_ibp_parse_bam_qual(alignment->qualities,qual,l_seq);
+        if (reverse_strand) {
+          gt_string_reverse(alignment->qualities);
+        }
+      }
+    }
+  }
+  if (!gt_string_is_null(alignment->read) && !gt_string_is_null(alignment->qualities)) {
+    gt_fatal_check(gt_string_get_length(alignment->read)!=gt_string_get_length(alignment->qualities),ALIGNMENT_READ_QUAL_LENGTH);
+  }
+  // Build a list of alignments
+  gt_vector *maps_vector = NULL;
+  if (is_mapped) {
+    maps_vector = gt_vector_new(10,sizeof(gt_map*));
+    gt_vector_insert(maps_vector,map,gt_map*);
+  } else {
+    gt_map_delete(map);
+  }
+  /*
+   * OPTIONAL FIELDS (XA:Z BWA alternative hits)
+   */
+  if (xa_value!=NULL) {
+    if (!is_mapped) return GT_IBP_PE_UNMAPPED_XA;
+    gt_isp_parse_sam_opt_xa_bwa(&xa_value,alignment,maps_vector,pending);
+  }
+  // Add the main map
+  if (is_mapped) {
+    pending->map_displacement = gt_alignment_get_num_maps(alignment);
+    if (override_pairing) {
+      gt_alignment_insert_map_gt_vector(alignment,maps_vector);
+    } else {
+      GT_VECTOR_ITERATE(maps_vector,map_elm,map_pos,gt_map*) {
+        gt_alignment_inc_counter(alignment,gt_map_get_global_distance(*map_elm));
+        gt_alignment_add_map(alignment,*map_elm);
+      }
+    }
+    gt_vector_delete(maps_vector);
+  }
+  return 0;
+}
+
+GT_INLINE bool gt_ibp_fetch_next_record(
+    gt_buffered_input_file* const buffered_bam_input,gt_string* const expected_tag,const bool chomp_tag) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_bam_input);
+  GT_NULL_CHECK(expected_tag);
+  // Check next record
+  gt_input_bam_parser_next_record(buffered_bam_input);
+  if (gt_buffered_input_file_eob(buffered_bam_input)) return false;
+  // Compare its tag
+  const uint8_t* const record = (uint8_t*)buffered_bam_input->cursor;
+  char* const next_tag = gt_bam_record_read_name(record);
+  uint64_t next_tag_length = gt_bam_record_read_name_length(record);
+  char* const next_tag_end = memchr(next_tag,SPACE,next_tag_length);
+  if (next_tag_end!=NULL) next_tag_length = next_tag_end-next_tag;
+  if (chomp_tag) next_tag_length = gt_ibp_chomp_pairend_info(next_tag,next_tag_length);
+  return gt_string_get_length(expected_tag)==next_tag_length &&
+      memcmp(gt_string_get_string(expected_tag),next_tag,next_tag_length)==0;
+}
+// Leaves the cursor at the first record of the next QNAME
+#define gt_ibp_skip_remaining_records(buffered_bam_input,tag,chomp_tag) while (gt_ibp_fetch_next_record(buffered_bam_input,tag,chomp_tag))
+
+/* BAM general */
+GT_INLINE gt_status gt_input_bam_parser_parse_template(
+    gt_buffered_input_file* const buffered_bam_input,gt_template* const template) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_bam_input);
+  GT_TEMPLATE_CHECK(template);
+  gt_bam_headers* const bam_headers = &buffered_bam_input->input_file->bam_headers;
+  gt_status error_code;
+  // Read initial TAG (QNAME := Query template)
+  gt_ibp_read_tag((uint8_t*)buffered_bam_input->cursor,template->tag);
+  gt_input_parse_tag_chomp_pairend_info(template->tag);
+  // Read all maps related to this TAG
+  gt_vector* pending_v = gt_vector_new(GT_IBP_NUM_INITIAL_MAPS,sizeof(gt_sam_pending_end));
+  do {
+    // Parse BAM Alignment
+    gt_sam_pending_end pending = GT_SAM_INIT_PENDING;
+    uint64_t alignment_flag;
+    if (gt_expect_false(error_code=gt_ibp_parse_bam_alignment(bam_headers,
+          (uint8_t*)buffered_bam_input->cursor,template,NULL,&alignment_flag,&pending,false))) {
+      gt_vector_delete(pending_v);
+      gt_ibp_skip_remaining_records(buffered_bam_input,template->tag,true);
+      return error_code;
+    }
+    // Solve pending ends
+    if (!gt_string_is_null(&pending.next_seq_name)) gt_isp_solve_pending_maps(pending_v,&pending,template);
+  } while (gt_ibp_fetch_next_record(buffered_bam_input,template->tag,true));
+  // Check for unsolved pending maps (try to solve them)
+  error_code = gt_isp_solve_remaining_maps(pending_v,template);
+  gt_vector_delete(pending_v);
+  if (error_code) return GT_IBP_PE_UNSOLVED_PENDING_MAPS;
+  // Setup alignment's tag info
+  gt_template_setup_pair_attributes_to_alignments(template,true);
+  return 0;
+}
+/* SE-BAM */
+GT_INLINE gt_status gt_input_bam_parser_parse_alignment(
+    gt_buffered_input_file* const buffered_bam_input,gt_alignment* alignment) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_bam_input);
+  GT_ALIGNMENT_CHECK(alignment);
+  gt_bam_headers* const bam_headers = &buffered_bam_input->input_file->bam_headers;
+  gt_status error_code;
+  // Read initial TAG (QNAME := Query template)
+  gt_ibp_read_tag((uint8_t*)buffered_bam_input->cursor,alignment->tag);
+  // Read all maps related to this TAG
+  do {
+    // Parse BAM Alignment
+    gt_sam_pending_end pending = GT_SAM_INIT_PENDING;
+    uint64_t alignment_flag;
+    if (gt_expect_false((error_code=gt_ibp_parse_bam_alignment(bam_headers,
+        (uint8_t*)buffered_bam_input->cursor,NULL,alignment,&alignment_flag,&pending,true))!=0)) {
+      gt_ibp_skip_remaining_records(buffered_bam_input,alignment->tag,false);
+      return error_code;
+    }
+  } while (gt_ibp_fetch_next_record(buffered_bam_input,alignment->tag,false));
+  // Chomp /1/2 and add the pair info
+  int64_t pair = gt_input_parse_tag_chomp_pairend_info(alignment->tag);
+  if (pair) gt_attributes_add(alignment->attributes,GT_ATTR_ID_TAG_PAIR,&pair,int64_t);
+  return 0;
+}
+
+/*
+ * High Level Parsers
+ */
+GT_INLINE gt_status gt_input_bam_parser_get_template(
+    gt_buffered_input_file* const buffered_bam_input,gt_template* const template) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_bam_input);
+  GT_TEMPLATE_CHECK(template);
+  gt_status error_code;
+  // Check file format
+  gt_input_file* const input_file = buffered_bam_input->input_file;
+  if (gt_expect_false(input_file->file_format!=BAM)) {
+    gt_error(PARSE_BAM_BAD_FILE_FORMAT,input_file->file_name,buffered_bam_input->current_line_num);
+    return GT_IBP_FAIL;
+  }
+  // Check the end_of_block. Reload buffer if needed
+  if (gt_buffered_input_file_eob(buffered_bam_input)) {
+    if ((error_code=gt_input_bam_parser_reload_buffer(buffered_bam_input))!=GT_IBP_OK) return error_code;
+  }
+  // Prepare the template
+  const uint64_t record_num = buffered_bam_input->current_line_num;
+  gt_template_clear(template,true);
+  template->template_id = record_num;
+  // Parse template
+  if ((error_code=gt_input_bam_parser_parse_template(buffered_bam_input,template))) {
+    gt_input_bam_parser_prompt_error(buffered_bam_input,record_num,error_code);
+    return GT_IBP_FAIL;
+  }
+  return GT_IBP_OK;
+}
+GT_INLINE gt_status gt_input_bam_parser_get_alignment(
+    gt_buffered_input_file* const buffered_bam_input,gt_alignment* const alignment) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_bam_input);
+  GT_ALIGNMENT_CHECK(alignment);
+  gt_status error_code;
+  // Check file format
+  gt_input_file* const input_file = buffered_bam_input->input_file;
+  if (gt_expect_false(input_file->file_format!=BAM)) {
+    gt_error(PARSE_BAM_BAD_FILE_FORMAT,input_file->file_name,buffered_bam_input->current_line_num);
+    return GT_IBP_FAIL;
+  }
+  // Check the end_of_block. Reload buffer if needed
+  if (gt_buffered_input_file_eob(buffered_bam_input)) {
+    if ((error_code=gt_input_bam_parser_reload_buffer(buffered_bam_input))!=GT_IBP_OK) return error_code;
+  }
+  // Allocate memory for the alignment
+  const uint64_t record_num = buffered_bam_input->current_line_num;
+  gt_alignment_clear(alignment);
+  alignment->alignment_id = record_num;
+  // Parse alignment
+  if ((error_code=gt_input_bam_parser_parse_alignment(buffered_bam_input,alignment))) {
+    gt_input_bam_parser_prompt_error(buffered_bam_input,record_num,error_code);
+    return GT_IBP_FAIL;
+  }
+  return GT_IBP_OK;
+}
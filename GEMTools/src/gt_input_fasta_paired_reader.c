@@ -0,0 +1,227 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_input_fasta_paired_reader.c
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Paired FASTA/FASTQ reader for ends split in two files (R1/R2)
+ */
+
+#include "gt_input_fasta_paired_reader.h"
+
+#define GT_IFP_PAIRED_END1 0
+#define GT_IFP_PAIRED_END2 1
+
+/*
+ * I/O threads
+ *   Thread @end fills the @end side of the slot holding its next block, as long as
+ *   the slot has been released by the readers (less than GT_IFP_PAIRED_NUM_SLOTS blocks ahead)
+ */
+GT_INLINE void gt_ifp_paired_io_loop(gt_input_fasta_paired_reader* const paired_reader,const uint64_t end) {
+  gt_input_file* const input_file = paired_reader->input_file[end];
+  GT_BEGIN_MUTEX_SECTION(paired_reader->reader_mutex) {
+    while (!paired_reader->io_exit) {
+      // Wait for a free slot
+      const uint64_t io_block_num = paired_reader->io_block_num[end];
+      if (io_block_num >= paired_reader->block_num+GT_IFP_PAIRED_NUM_SLOTS) {
+        GT_CV_WAIT(paired_reader->slot_free_cond,paired_reader->reader_mutex);
+        continue;
+      }
+      gt_ifp_paired_slot* const slot = paired_reader->slots + (io_block_num%GT_IFP_PAIRED_NUM_SLOTS);
+      // Fill it (outside the critical section)
+      GT_END_MUTEX_SECTION(paired_reader->reader_mutex);
+      gt_input_file_lock(input_file);
+      slot->first_line_num[end] = input_file->processed_lines+1;
+      const uint64_t lines_read = gt_input_file_get_lines(input_file,slot->block_buffer[end],paired_reader->lines_per_block);
+      gt_input_file_unlock(input_file);
+      GT_BEGIN_MUTEX_SECTION(paired_reader->reader_mutex);
+      // Hand it to the readers
+      if (lines_read==0) {
+        paired_reader->io_eof[end] = true;
+        GT_CV_BROADCAST(paired_reader->block_filled_cond);
+        break;
+      }
+      slot->lines_in_buffer[end] = lines_read;
+      slot->filled[end] = true;
+      ++(paired_reader->io_block_num[end]);
+      GT_CV_BROADCAST(paired_reader->block_filled_cond);
+    }
+  } GT_END_MUTEX_SECTION(paired_reader->reader_mutex);
+}
+static void* gt_ifp_paired_io_thread_end1(void* const paired_reader) {
+  gt_ifp_paired_io_loop((gt_input_fasta_paired_reader*)paired_reader,GT_IFP_PAIRED_END1);
+  return NULL;
+}
+static void* gt_ifp_paired_io_thread_end2(void* const paired_reader) {
+  gt_ifp_paired_io_loop((gt_input_fasta_paired_reader*)paired_reader,GT_IFP_PAIRED_END2);
+  return NULL;
+}
+
+/*
+ * Setup
+ */
+gt_input_fasta_paired_reader* gt_input_fasta_paired_reader_new(gt_input_file* const input_file_end1,gt_input_file* const input_file_end2) {
+  GT_INPUT_FILE_CHECK(input_file_end1);
+  GT_INPUT_FILE_CHECK(input_file_end2);
+  gt_cond_fatal_error(input_file_end1->file_format!=FASTA || gt_input_fasta_is_multifasta(input_file_end1),
+      FASTA_PAIRED_READER_FORMAT,input_file_end1->file_name);
+  gt_cond_fatal_error(input_file_end2->file_format!=FASTA || gt_input_fasta_is_multifasta(input_file_end2),
+      FASTA_PAIRED_READER_FORMAT,input_file_end2->file_name);
+  gt_input_fasta_paired_reader* const paired_reader = gt_alloc(gt_input_fasta_paired_reader);
+  // Input files
+  paired_reader->input_file[GT_IFP_PAIRED_END1] = input_file_end1;
+  paired_reader->input_file[GT_IFP_PAIRED_END2] = input_file_end2;
+  paired_reader->lines_per_record = gt_input_fasta_is_fastq(input_file_end1) ? 4 : 2;
+  paired_reader->lines_per_block = paired_reader->lines_per_record*GT_IFP_PAIRED_RECORDS_PER_BLOCK;
+  // Ring of paired blocks
+  uint64_t i;
+  for (i=0;i<GT_IFP_PAIRED_NUM_SLOTS;++i) {
+    gt_ifp_paired_slot* const slot = paired_reader->slots+i;
+    slot->block_buffer[GT_IFP_PAIRED_END1] = gt_vector_new(GT_BUFFER_SIZE_1M,sizeof(char));
+    slot->block_buffer[GT_IFP_PAIRED_END2] = gt_vector_new(GT_BUFFER_SIZE_1M,sizeof(char));
+    slot->filled[GT_IFP_PAIRED_END1] = false;
+    slot->filled[GT_IFP_PAIRED_END2] = false;
+  }
+  paired_reader->block_num = 0;
+  // Mutexes
+  gt_cond_fatal_error(pthread_mutex_init(&paired_reader->reader_mutex,NULL),SYS_MUTEX_INIT);
+  gt_cond_fatal_error(pthread_cond_init(&paired_reader->block_filled_cond,NULL),SYS_COND_VAR_INIT);
+  gt_cond_fatal_error(pthread_cond_init(&paired_reader->slot_free_cond,NULL),SYS_COND_VAR_INIT);
+  // Launch I/O threads
+  paired_reader->io_exit = false;
+  for (i=0;i<2;++i) {
+    paired_reader->io_block_num[i] = 0;
+    paired_reader->io_eof[i] = false;
+  }
+  gt_cond_fatal_error(pthread_create(paired_reader->io_thread+GT_IFP_PAIRED_END1,NULL,
+      gt_ifp_paired_io_thread_end1,paired_reader),SYS_THREAD);
+  gt_cond_fatal_error(pthread_create(paired_reader->io_thread+GT_IFP_PAIRED_END2,NULL,
+      gt_ifp_paired_io_thread_end2,paired_reader),SYS_THREAD);
+  return paired_reader;
+}
+void gt_input_fasta_paired_reader_delete(gt_input_fasta_paired_reader* const paired_reader) {
+  GT_INPUT_FASTA_PAIRED_READER_CHECK(paired_reader);
+  // Stop the I/O threads
+  GT_BEGIN_MUTEX_SECTION(paired_reader->reader_mutex) {
+    paired_reader->io_exit = true;
+    GT_CV_BROADCAST(paired_reader->slot_free_cond);
+  } GT_END_MUTEX_SECTION(paired_reader->reader_mutex);
+  gt_cond_fatal_error(pthread_join(paired_reader->io_thread[GT_IFP_PAIRED_END1],NULL),SYS_THREAD);
+  gt_cond_fatal_error(pthread_join(paired_reader->io_thread[GT_IFP_PAIRED_END2],NULL),SYS_THREAD);
+  // Free
+  uint64_t i;
+  for (i=0;i<GT_IFP_PAIRED_NUM_SLOTS;++i) {
+    gt_vector_delete(paired_reader->slots[i].block_buffer[GT_IFP_PAIRED_END1]);
+    gt_vector_delete(paired_reader->slots[i].block_buffer[GT_IFP_PAIRED_END2]);
+  }
+  gt_cond_error(pthread_cond_destroy(&paired_reader->block_filled_cond),SYS_COND_VAR_DESTROY);
+  gt_cond_error(pthread_cond_destroy(&paired_reader->slot_free_cond),SYS_COND_VAR_DESTROY);
+  gt_cond_error(pthread_mutex_destroy(&paired_reader->reader_mutex),SYS_MUTEX_DESTROY);
+  gt_free(paired_reader);
+}
+
+/*
+ * Tag agreement
+ *   Tags are compared up to the first blank, without the pair information ("/1","/2")
+ */
+GT_INLINE uint64_t gt_ifp_paired_tag_length(const char* const tag) {
+  uint64_t length = 0;
+  while (tag[length]!=SPACE && tag[length]!=TAB && tag[length]!=EOL) ++length;
+  if (length>=2 && tag[length-2]==SLASH && (tag[length-1]=='1' || tag[length-1]=='2')) length-=2;
+  return length;
+}
+GT_INLINE const char* gt_ifp_paired_skip_lines(const char* text,const uint64_t num_lines) {
+  uint64_t i;
+  for (i=0;i<num_lines;++i) text = (const char*)rawmemchr(text,EOL)+1;
+  return text;
+}
+GT_INLINE bool gt_ifp_paired_check_tags(
+    gt_input_fasta_paired_reader* const paired_reader,
+    gt_buffered_input_file* const buffered_input_end1,gt_buffered_input_file* const buffered_input_end2,
+    uint64_t* const mismatch_line) {
+  const uint64_t lines_per_record = paired_reader->lines_per_record;
+  const uint64_t num_records = buffered_input_end1->lines_in_buffer/lines_per_record;
+  const char* tag_end1 = gt_vector_get_mem(buffered_input_end1->block_buffer,char);
+  const char* tag_end2 = gt_vector_get_mem(buffered_input_end2->block_buffer,char);
+  uint64_t i;
+  for (i=0;i<num_records;++i) {
+    const uint64_t length_end1 = gt_ifp_paired_tag_length(tag_end1+1);
+    const uint64_t length_end2 = gt_ifp_paired_tag_length(tag_end2+1);
+    if (length_end1!=length_end2 || memcmp(tag_end1+1,tag_end2+1,length_end1)!=0) {
+      *mismatch_line = buffered_input_end1->current_line_num+i*lines_per_record;
+      return false;
+    }
+    tag_end1 = gt_ifp_paired_skip_lines(tag_end1,lines_per_record);
+    tag_end2 = gt_ifp_paired_skip_lines(tag_end2,lines_per_record);
+  }
+  return true;
+}
+
+/*
+ * Synch read of blocks
+ */
+GT_INLINE void gt_ifp_paired_setup_block(
+    gt_buffered_input_file* const buffered_input,gt_ifp_paired_slot* const slot,const uint64_t end,const uint64_t block_num) {
+  // Swap the buffers (the old one is recycled by the I/O thread)
+  gt_vector* const block_buffer = slot->block_buffer[end];
+  slot->block_buffer[end] = buffered_input->block_buffer;
+  buffered_input->block_buffer = block_buffer;
+  if (*gt_vector_get_last_elm(block_buffer,char)!=EOL) gt_vector_insert(block_buffer,EOL,char);
+  buffered_input->block_id = block_num % UINT32_MAX;
+  buffered_input->lines_in_buffer = slot->lines_in_buffer[end];
+  buffered_input->current_line_num = slot->first_line_num[end];
+  buffered_input->cursor = gt_vector_get_mem(block_buffer,char);
+  slot->filled[end] = false;
+}
+GT_INLINE gt_status gt_input_fasta_paired_reader_synch_blocks(
+    gt_input_fasta_paired_reader* const paired_reader,
+    gt_buffered_input_file* const buffered_input_end1,gt_buffered_input_file* const buffered_input_end2) {
+  GT_INPUT_FASTA_PAIRED_READER_CHECK(paired_reader);
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_input_end1);
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_input_end2);
+  // Check the end_of_block. Reload buffer if needed (synch)
+  if (!gt_buffered_input_file_eob(buffered_input_end1)) return GT_IFP_OK;
+  // Dump buffer if BOF it attached to the input, and get new out block (always FIRST)
+  gt_buffered_input_file_dump_attached_buffers(buffered_input_end1->attached_buffered_output_file);
+  // Take the next pair of blocks
+  gt_status error_code = GT_IFP_OK;
+  uint64_t error_line = 0;
+  GT_BEGIN_MUTEX_SECTION(paired_reader->reader_mutex) {
+    uint64_t block_num;
+    gt_ifp_paired_slot* slot;
+    while (true) {
+      // Next block (other readers might have taken blocks while waiting)
+      block_num = paired_reader->block_num;
+      slot = paired_reader->slots + (block_num%GT_IFP_PAIRED_NUM_SLOTS);
+      const bool end1_eof = !slot->filled[GT_IFP_PAIRED_END1] && paired_reader->io_eof[GT_IFP_PAIRED_END1];
+      const bool end2_eof = !slot->filled[GT_IFP_PAIRED_END2] && paired_reader->io_eof[GT_IFP_PAIRED_END2];
+      if (end1_eof && end2_eof) { error_code = GT_IFP_EOF; break; }
+      if (end1_eof || end2_eof) { error_code = GT_IFP_PE_PAIRED_NUM_RECORDS; break; }
+      if (slot->filled[GT_IFP_PAIRED_END1] && slot->filled[GT_IFP_PAIRED_END2]) break;
+      GT_CV_WAIT(paired_reader->block_filled_cond,paired_reader->reader_mutex);
+    }
+    error_line = block_num*paired_reader->lines_per_block+1; // First line of the unpaired block
+    if (error_code==GT_IFP_OK) {
+      if (slot->lines_in_buffer[GT_IFP_PAIRED_END1]!=slot->lines_in_buffer[GT_IFP_PAIRED_END2]) {
+        error_code = GT_IFP_PE_PAIRED_NUM_RECORDS;
+      } else {
+        gt_ifp_paired_setup_block(buffered_input_end1,slot,GT_IFP_PAIRED_END1,block_num);
+        gt_ifp_paired_setup_block(buffered_input_end2,slot,GT_IFP_PAIRED_END2,block_num);
+        ++(paired_reader->block_num);
+        GT_CV_BROADCAST(paired_reader->slot_free_cond);
+      }
+    }
+  } GT_END_MUTEX_SECTION(paired_reader->reader_mutex);
+  if (error_code==GT_IFP_PE_PAIRED_NUM_RECORDS) {
+    gt_input_fasta_parser_prompt_error(buffered_input_end1,error_line,0,error_code);
+  }
+  if (error_code!=GT_IFP_OK) return error_code;
+  // Check the mates (outside the critical section)
+  uint64_t mismatch_line;
+  if (!gt_ifp_paired_check_tags(paired_reader,buffered_input_end1,buffered_input_end2,&mismatch_line)) {
+    gt_input_fasta_parser_prompt_error(buffered_input_end1,mismatch_line,0,GT_IFP_PE_PAIRED_TAGS_MISMATCH);
+    return GT_IFP_PE_PAIRED_TAGS_MISMATCH;
+  }
+  // Assign block ID
+  gt_buffered_input_file_set_id_attached_buffers(buffered_input_end1->attached_buffered_output_file,buffered_input_end1->block_id);
+  return GT_IFP_OK;
+}
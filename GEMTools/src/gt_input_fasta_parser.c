@@ -124,6 +124,8 @@ GT_INLINE void gt_input_fasta_parser_prompt_error(
   switch (error_code) {
     case 0: /* No error */ break; // TODO
     // case GT_IMP_PE_WRONG_FILE_FORMAT: gt_error(PARSE_MAP_BAD_FILE_FORMAT,file_name,line_num); break;
+    case GT_IFP_PE_PAIRED_TAGS_MISMATCH: gt_error(PARSE_FASTA_PAIRED_TAGS_MISMATCH,file_name,line_num); break;
+    case GT_IFP_PE_PAIRED_NUM_RECORDS: gt_error(PARSE_FASTA_PAIRED_NUM_RECORDS,file_name,line_num); break;
     default:
       gt_error(PARSE_FASTA,file_name,line_num,column_pos);
       break;
@@ -176,9 +178,11 @@ GT_INLINE gt_status gt_input_fasta_parser_reload_buffer(gt_buffered_input_file*
   GT_BUFFERED_INPUT_FILE_CHECK(buffered_fasta_input);
   // Dump buffer if BOF it attached to input, and get new out block (always FIRST)
   gt_buffered_input_file_dump_attached_buffers(buffered_fasta_input->attached_buffered_output_file);
-  // Read new input block
-  const uint64_t read_lines =
-      gt_buffered_input_file_get_block(buffered_fasta_input,GT_IFP_NUM_LINES);
+  // Read new input block (from the next file of the set, if any, once exhausted)
+  uint64_t read_lines;
+  do {
+    read_lines = gt_buffered_input_file_get_block(buffered_fasta_input,GT_IFP_NUM_LINES);
+  } while (read_lines==0 && gt_buffered_input_file_next_input(buffered_fasta_input));
   if (gt_expect_false(read_lines==0)) return GT_IFP_EOF;
   // Assign block ID
   gt_buffered_input_file_set_id_attached_buffers(buffered_fasta_input->attached_buffered_output_file,buffered_fasta_input->block_id);
@@ -271,12 +275,12 @@ GT_INLINE gt_status gt_ifp_parse_fasta_fastq_read(
   /*
    * Check input file
    */
-  gt_input_file* const input_file = buffered_fasta_input->input_file;
   gt_status error_code;
   // Check the end_of_block. Reload buffer if needed
   if (gt_buffered_input_file_eob(buffered_fasta_input)) {
     if ((error_code=gt_input_fasta_parser_reload_buffer(buffered_fasta_input))!=GT_IFP_OK) return error_code;
   }
+  gt_input_file* const input_file = buffered_fasta_input->input_file; // The reload may move to the next file of the set
   // Check file format
   if (gt_input_fasta_parser_check_fastq_file_format(buffered_fasta_input)) {
     gt_fatal_error(PARSE_MAP_BAD_FILE_FORMAT,input_file->file_name,buffered_fasta_input->current_line_num);
@@ -356,6 +360,7 @@ GT_INLINE gt_status gt_input_fasta_parser_get_template(
 }
 
 #define GT_INPUT_MULTIFASTA_RETURN_ERROR(error_code) \
+  gt_mm_numa_interleave_thread(false); \
   gt_string_delete(buffer);  \
   gt_segmented_sequence_delete(seg_seq); \
   return GT_IFP_PE_TAG_BAD_BEGINNING
@@ -369,7 +374,8 @@ GT_INLINE gt_status gt_input_multifasta_parser_get_archive(
   // Check the file. Reload buffer if needed
   if (input_multifasta_file->eof) return GT_IFP_OK;
   GT_INPUT_FILE_CHECK(input_multifasta_file);
-  // Read all sequences
+  // Read all sequences (interleaving the archive across NUMA nodes, as all threads will read it)
+  gt_mm_numa_interleave_thread(true);
   gt_string* const buffer = gt_string_new(200); // TODO: Should be done in terms of dna_string
   while (!input_multifasta_file->eof) {
     gt_segmented_sequence* seg_seq = gt_segmented_sequence_new();
@@ -408,6 +414,7 @@ GT_INLINE gt_status gt_input_multifasta_parser_get_archive(
     gt_sequence_archive_add_segmented_sequence(sequence_archive,seg_seq);
   }
   gt_string_delete(buffer);
+  gt_mm_numa_interleave_thread(false);
   return GT_IFP_OK;
 }
 /*
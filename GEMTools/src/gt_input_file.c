@@ -16,6 +16,15 @@
 
 // Internal constants
 #define GT_INPUT_BUFFER_SIZE GT_BUFFER_SIZE_64M
+#define GT_INPUT_FILE_PREFIX_SIZE (1<<18) // Format detection (first buffer). Multiple of GT_DIO_ALIGNMENT
+#define GT_INPUT_FILE_MAGIC_SIZE 18 // Enough to tell BGZF from plain gzip
+
+// Internal functions
+GT_INLINE size_t gt_input_file_read_chunk(gt_input_file* const input_file,uint8_t* const buffer,const uint64_t buffer_size);
+void gt_input_file_readahead_delete(gt_input_file* const input_file);
+GT_INLINE void gt_input_file_index_delete(gt_input_file_index* const index);
+GT_INLINE void gt_input_file_resize_buffer(
+    gt_input_file* const input_file,const uint64_t buffer_allocated,const bool keep_content);
 
 /*
  * Basic I/O functions
@@ -29,19 +38,30 @@ gt_input_file* gt_input_stream_open(FILE* stream) {
   input_file->file_type = STREAM;
   input_file->file = stream;
   input_file->fildes = -1;
+  input_file->dio_reader = NULL;
+#ifdef HAVE_ZLIB
+  input_file->bgzf_reader = NULL;
+#endif
   input_file->eof = feof(stream);
   input_file->file_size = UINT64_MAX;
   input_file->file_format = FILE_FORMAT_UNKNOWN;
   gt_cond_fatal_error(pthread_mutex_init(&input_file->input_mutex, NULL),SYS_MUTEX_INIT);
   // Auxiliary Buffer (for synch purposes)
-  input_file->file_buffer = gt_malloc(GT_INPUT_BUFFER_SIZE);
+  input_file->file_buffer = gt_malloc(GT_INPUT_FILE_PREFIX_SIZE);
+  input_file->buffer_allocated = GT_INPUT_FILE_PREFIX_SIZE;
+  gt_mm_acc_add(GT_MM_ACC_INPUT_BUFFERS,GT_INPUT_FILE_PREFIX_SIZE);
   input_file->buffer_size = 0;
   input_file->buffer_begin = 0;
   input_file->buffer_pos = 0;
   input_file->global_pos = 0;
   input_file->processed_lines = 0;
+  input_file->readahead = NULL;
+  input_file->ranges = NULL;
+  input_file->index = NULL;
   // ID generator
   input_file->processed_id = 0;
+  input_file->shared_processed_id = NULL;
+  input_file->shared_mutex = NULL;
   // Detect file format
   gt_input_file_detect_file_format(input_file);
   return input_file;
@@ -52,21 +72,28 @@ gt_input_file* gt_input_file_open(char* const file_name,const bool mmap_file) {
   gt_input_file* input_file = gt_alloc(gt_input_file);
   // Input file
   struct stat stat_info;
-  unsigned char tbuf[4];
+  unsigned char tbuf[GT_INPUT_FILE_MAGIC_SIZE];
   int i;
   gt_cond_fatal_error(stat(file_name,&stat_info)==-1,FILE_STAT,file_name);
   input_file->file_name = file_name;
   input_file->file_size = stat_info.st_size;
   input_file->eof = (input_file->file_size==0);
   input_file->file_format = FILE_FORMAT_UNKNOWN;
+  input_file->dio_reader = NULL;
+#ifdef HAVE_ZLIB
+  input_file->bgzf_reader = NULL;
+#endif
   gt_cond_fatal_error(pthread_mutex_init(&input_file->input_mutex,NULL),SYS_MUTEX_INIT);
   if (mmap_file) {
     input_file->file = NULL;
     input_file->fildes = open(file_name,O_RDONLY,0); // TODO: O_NOATIME condCompl (Thanks Jordi Camps)
     gt_cond_fatal_error(input_file->fildes==-1,FILE_OPEN,file_name);
+    // Read-only mapping. Blocks are handed out as views and parsed in place (never written),
+    // so the pages stay in the page cache instead of becoming private copies
     input_file->file_buffer =
       (uint8_t*) mmap(0,input_file->file_size,PROT_READ,MAP_PRIVATE,input_file->fildes,0);
     gt_cond_fatal_error(input_file->file_buffer==MAP_FAILED,SYS_MMAP_FILE,file_name);
+    madvise(input_file->file_buffer,input_file->file_size,MADV_SEQUENTIAL);
     input_file->file_type = MAPPED_FILE;
   } else {
     input_file->fildes = -1;
@@ -74,8 +101,16 @@ gt_input_file* gt_input_file_open(char* const file_name,const bool mmap_file) {
     input_file->file_type = REGULAR_FILE;
     if(S_ISREG(stat_info.st_mode)) {
       // Regular file - check if gzip or bzip compressed
-      i=(int)fread(tbuf,(size_t)1,(size_t)4,input_file->file);
-      if(tbuf[0]==0x1f && tbuf[1]==0x8b && tbuf[2]==0x08) {
+      i=(int)fread(tbuf,(size_t)1,(size_t)GT_INPUT_FILE_MAGIC_SIZE,input_file->file);
+#ifdef HAVE_ZLIB
+      if(gt_bgzf_is_bgzf_header(tbuf,i)) {
+        // BGZF (blocked gzip) - inflate blocks in parallel
+        fseek(input_file->file,0L,SEEK_SET);
+        input_file->file_type=BGZIPPED_FILE;
+        input_file->bgzf_reader=gt_bgzf_reader_new(input_file->file);
+      } else
+#endif
+      if(i>=3 && tbuf[0]==0x1f && tbuf[1]==0x8b && tbuf[2]==0x08) {
         input_file->file_type=GZIPPED_FILE;
         fclose(input_file->file);
 #ifdef HAVE_ZLIB
@@ -83,12 +118,13 @@ gt_input_file* gt_input_file_open(char* const file_name,const bool mmap_file) {
 #else
         gt_fatal_error(FILE_GZIP_NO_ZLIB,file_name);
 #endif
-      } else if(tbuf[0]=='B' && tbuf[1]=='Z' && tbuf[2]=='h' && tbuf[3]>='0' && tbuf[3]<='9') {
+      } else if(i>=4 && tbuf[0]=='B' && tbuf[1]=='Z' && tbuf[2]=='h' && tbuf[3]>='0' && tbuf[3]<='9') {
         fseek(input_file->file,0L,SEEK_SET);
         input_file->file_type=BZIPPED_FILE;
 #ifdef HAVE_BZLIB
         input_file->file=BZ2_bzReadOpen(&i,input_file->file,0,0,NULL,0);
         gt_cond_fatal_error(i!=BZ_OK,FILE_BZIP2_OPEN,file_name);
+        input_file->bz_stream_end=false;
 #else
         gt_fatal_error(FILE_BZIP2_NO_BZLIB,file_name);
 #endif
@@ -98,18 +134,65 @@ gt_input_file* gt_input_file_open(char* const file_name,const bool mmap_file) {
     } else {
       input_file->eof=0;
     }
-    input_file->file_buffer = gt_malloc(GT_INPUT_BUFFER_SIZE);
+    input_file->file_buffer = gt_malloc(GT_INPUT_FILE_PREFIX_SIZE);
   }
   // Auxiliary Buffer (for synch purposes)
+  input_file->buffer_allocated = (input_file->file_type==MAPPED_FILE) ? input_file->file_size : GT_INPUT_FILE_PREFIX_SIZE;
+  if (input_file->file_type!=MAPPED_FILE) gt_mm_acc_add(GT_MM_ACC_INPUT_BUFFERS,GT_INPUT_FILE_PREFIX_SIZE); // Page cache otherwise
+  input_file->buffer_size = 0;
+  input_file->buffer_begin = 0;
+  input_file->buffer_pos = 0;
+  input_file->global_pos = 0;
+  input_file->processed_lines = 0;
+  input_file->readahead = NULL;
+  input_file->ranges = NULL;
+  input_file->index = NULL;
+  // ID generator
+  input_file->processed_id = 0;
+  input_file->shared_processed_id = NULL;
+  input_file->shared_mutex = NULL;
+  // Detect file format
+  gt_input_file_detect_file_format(input_file);
+  return input_file;
+}
+gt_input_file* gt_input_file_open_direct(char* const file_name) {
+  GT_NULL_CHECK(file_name);
+  // Allocate handler
+  gt_input_file* input_file = gt_alloc(gt_input_file);
+  // Input file
+  input_file->file_name = file_name;
+  input_file->file_type = DIRECT_FILE;
+  input_file->file = NULL;
+  input_file->fildes = -1;
+  input_file->dio_reader = gt_dio_reader_open(file_name);
+#ifdef HAVE_ZLIB
+  input_file->bgzf_reader = NULL;
+#endif
+  input_file->file_size = input_file->dio_reader->file_size;
+  input_file->eof = (input_file->file_size==0);
+  input_file->file_format = FILE_FORMAT_UNKNOWN;
+  gt_cond_fatal_error(pthread_mutex_init(&input_file->input_mutex,NULL),SYS_MUTEX_INIT);
+  // Auxiliary Buffer (aligned for direct I/O)
+  input_file->file_buffer = gt_dio_buffer_new(GT_INPUT_FILE_PREFIX_SIZE);
+  input_file->buffer_allocated = GT_INPUT_FILE_PREFIX_SIZE;
+  gt_mm_acc_add(GT_MM_ACC_INPUT_BUFFERS,GT_INPUT_FILE_PREFIX_SIZE);
   input_file->buffer_size = 0;
   input_file->buffer_begin = 0;
   input_file->buffer_pos = 0;
   input_file->global_pos = 0;
   input_file->processed_lines = 0;
+  input_file->readahead = NULL;
+  input_file->ranges = NULL;
+  input_file->index = NULL;
   // ID generator
   input_file->processed_id = 0;
+  input_file->shared_processed_id = NULL;
+  input_file->shared_mutex = NULL;
   // Detect file format
   gt_input_file_detect_file_format(input_file);
+  gt_cond_fatal_error(input_file->buffer_size>=2 &&
+      ((input_file->file_buffer[0]==0x1f && input_file->file_buffer[1]==0x8b) ||
+       (input_file->file_buffer[0]=='B' && input_file->file_buffer[1]=='Z')),FILE_DIRECT_COMPRESSED,file_name);
   return input_file;
 }
 /*
@@ -122,6 +205,12 @@ gt_status gt_input_file_close(gt_input_file* const input_file) {
 #ifdef HAVE_BZLIB
   int bzerr;
 #endif
+  // Stop the read-ahead (if any) before closing the file underneath
+  if (input_file->readahead!=NULL) gt_input_file_readahead_delete(input_file);
+  if (input_file->ranges!=NULL) gt_free(input_file->ranges);
+  if (input_file->index!=NULL) gt_input_file_index_delete(input_file->index);
+  if (input_file->file_type!=MAPPED_FILE) gt_mm_acc_sub(GT_MM_ACC_INPUT_BUFFERS,input_file->buffer_allocated);
+  if (input_file->file_format==BAM) gt_bam_headers_destroy(&input_file->bam_headers);
   switch (input_file->file_type) {
     case REGULAR_FILE:
       gt_free(input_file->file_buffer);
@@ -133,6 +222,13 @@ gt_status gt_input_file_close(gt_input_file* const input_file) {
       if (gzclose((gzFile)input_file->file)) status = GT_INPUT_FILE_CLOSE_ERR;
 #endif
       break;
+    case BGZIPPED_FILE:
+      gt_free(input_file->file_buffer);
+#ifdef HAVE_ZLIB
+      gt_bgzf_reader_delete(input_file->bgzf_reader);
+#endif
+      if (fclose(input_file->file)) status = GT_INPUT_FILE_CLOSE_ERR;
+      break;
     case BZIPPED_FILE:
       gt_free(input_file->file_buffer);
 #ifdef HAVE_BZLIB
@@ -140,8 +236,12 @@ gt_status gt_input_file_close(gt_input_file* const input_file) {
       if (bzerr!=BZ_OK) status = GT_INPUT_FILE_CLOSE_ERR;
 #endif
       break;
+    case DIRECT_FILE:
+      gt_free(input_file->file_buffer);
+      if (gt_dio_reader_close(input_file->dio_reader)) status = GT_INPUT_FILE_CLOSE_ERR;
+      break;
     case MAPPED_FILE:
-      gt_cond_error(munmap(input_file->file,input_file->file_size)==-1,SYS_UNMAP);
+      gt_cond_error(munmap(input_file->file_buffer,input_file->file_size)==-1,SYS_UNMAP);
       if (close(input_file->fildes)) status = GT_INPUT_FILE_CLOSE_ERR;
       break;
     case STREAM:
@@ -157,74 +257,364 @@ gt_status gt_input_file_close(gt_input_file* const input_file) {
  */
 GT_INLINE void gt_input_file_lock(gt_input_file* const input_file) {
   GT_INPUT_FILE_CHECK(input_file);
-  gt_cond_fatal_error(pthread_mutex_lock(&input_file->input_mutex),SYS_MUTEX);
+  pthread_mutex_t* const input_mutex = (input_file->shared_mutex!=NULL) ? input_file->shared_mutex : &input_file->input_mutex;
+  gt_cond_fatal_error(pthread_mutex_lock(input_mutex),SYS_MUTEX);
 }
 GT_INLINE void gt_input_file_unlock(gt_input_file* const input_file) {
   GT_INPUT_FILE_CHECK(input_file);
-  gt_cond_fatal_error(pthread_mutex_unlock(&input_file->input_mutex),SYS_MUTEX);
+  pthread_mutex_t* const input_mutex = (input_file->shared_mutex!=NULL) ? input_file->shared_mutex : &input_file->input_mutex;
+  gt_cond_fatal_error(pthread_mutex_unlock(input_mutex),SYS_MUTEX);
 }
 GT_INLINE uint64_t gt_input_file_next_id(gt_input_file* const input_file) {
   GT_INPUT_FILE_CHECK(input_file);
+  if (input_file->shared_processed_id!=NULL) return __sync_fetch_and_add(input_file->shared_processed_id,1);
   return (input_file->processed_id)++;
 }
 
+/*
+ * Read-ahead
+ *   The consumer (readers, holding the input_mutex) owns buffers[consumer_idx]. The next
+ *   @num_filled buffers in the ring are ready to be consumed and the rest are free for the producer.
+ */
+static void* gt_input_file_readahead_producer(void* const input_file_ptr) {
+  gt_input_file* const input_file = (gt_input_file*) input_file_ptr;
+  gt_input_file_readahead* const readahead = input_file->readahead;
+  GT_BEGIN_MUTEX_SECTION(readahead->readahead_mutex) {
+    while (!readahead->producer_exit) {
+      // Wait for a free buffer
+      if (readahead->num_filled+1 >= readahead->num_buffers) {
+        GT_CV_WAIT(readahead->buffer_free_cond,readahead->readahead_mutex);
+        continue;
+      }
+      const uint64_t buffer_idx = (readahead->consumer_idx+1+readahead->num_filled)%readahead->num_buffers;
+      // Fill it (outside the critical section)
+      GT_END_MUTEX_SECTION(readahead->readahead_mutex);
+      const uint64_t buffer_size = gt_input_file_read_chunk(input_file,readahead->buffers[buffer_idx],GT_INPUT_BUFFER_SIZE);
+      GT_BEGIN_MUTEX_SECTION(readahead->readahead_mutex);
+      // Hand it to the consumer
+      if (buffer_size==0) {
+        readahead->producer_eof = true;
+        GT_CV_BROADCAST(readahead->buffer_filled_cond);
+        break;
+      }
+      readahead->buffers_size[buffer_idx] = buffer_size;
+      ++(readahead->num_filled);
+      GT_CV_SIGNAL(readahead->buffer_filled_cond);
+    }
+  } GT_END_MUTEX_SECTION(readahead->readahead_mutex);
+  return NULL;
+}
+void gt_input_file_enable_readahead(gt_input_file* const input_file,const uint64_t num_buffers) {
+  GT_INPUT_FILE_CHECK(input_file);
+  gt_cond_fatal_error(num_buffers<GT_INPUT_FILE_READAHEAD_MIN_BUFFERS ||
+      num_buffers>GT_INPUT_FILE_READAHEAD_MAX_BUFFERS,FILE_READAHEAD_NUM_BUFFERS,num_buffers,(uint64_t)GT_INPUT_FILE_READAHEAD_MIN_BUFFERS,(uint64_t)GT_INPUT_FILE_READAHEAD_MAX_BUFFERS);
+  // Nothing to read ahead for memory-mapped files (or already enabled)
+  if (input_file->file_type==MAPPED_FILE || input_file->readahead!=NULL) return;
+  // Full-size buffers (the current one might still be the detection prefix)
+  if (input_file->buffer_allocated < GT_INPUT_BUFFER_SIZE) gt_input_file_resize_buffer(input_file,GT_INPUT_BUFFER_SIZE,true);
+  // Allocate the ring (the current buffer becomes the consumer one)
+  gt_input_file_readahead* const readahead = gt_alloc(gt_input_file_readahead);
+  readahead->producer_eof = false;
+  readahead->producer_exit = false;
+  readahead->num_buffers = num_buffers;
+  readahead->consumer_idx = 0;
+  readahead->num_filled = 0;
+  readahead->buffers[0] = input_file->file_buffer;
+  readahead->buffers_size[0] = input_file->buffer_size;
+  uint64_t i;
+  for (i=1;i<num_buffers;++i) {
+    readahead->buffers[i] = (input_file->file_type==DIRECT_FILE) ?
+        gt_dio_buffer_new(GT_INPUT_BUFFER_SIZE) : gt_malloc(GT_INPUT_BUFFER_SIZE);
+    readahead->buffers_size[i] = 0;
+  }
+  gt_mm_acc_add(GT_MM_ACC_INPUT_BUFFERS,(num_buffers-1)*GT_INPUT_BUFFER_SIZE);
+  gt_cond_fatal_error(pthread_mutex_init(&readahead->readahead_mutex,NULL),SYS_MUTEX_INIT);
+  gt_cond_fatal_error(pthread_cond_init(&readahead->buffer_filled_cond,NULL),SYS_COND_VAR_INIT);
+  gt_cond_fatal_error(pthread_cond_init(&readahead->buffer_free_cond,NULL),SYS_COND_VAR_INIT);
+  input_file->readahead = readahead;
+  // Launch producer
+  gt_cond_fatal_error(pthread_create(&readahead->producer_thread,NULL,
+      gt_input_file_readahead_producer,input_file),SYS_THREAD);
+}
+void gt_input_file_readahead_delete(gt_input_file* const input_file) {
+  gt_input_file_readahead* const readahead = input_file->readahead;
+  // Stop the producer
+  GT_BEGIN_MUTEX_SECTION(readahead->readahead_mutex) {
+    readahead->producer_exit = true;
+    GT_CV_SIGNAL(readahead->buffer_free_cond);
+  } GT_END_MUTEX_SECTION(readahead->readahead_mutex);
+  gt_cond_fatal_error(pthread_join(readahead->producer_thread,NULL),SYS_THREAD);
+  // Free the ring (including the buffer handed to the readers)
+  uint64_t i;
+  for (i=0;i<readahead->num_buffers;++i) gt_free(readahead->buffers[i]);
+  gt_mm_acc_sub(GT_MM_ACC_INPUT_BUFFERS,(readahead->num_buffers-1)*GT_INPUT_BUFFER_SIZE);
+  input_file->file_buffer = NULL;
+  gt_cond_error(pthread_cond_destroy(&readahead->buffer_filled_cond),SYS_COND_VAR_DESTROY);
+  gt_cond_error(pthread_cond_destroy(&readahead->buffer_free_cond),SYS_COND_VAR_DESTROY);
+  gt_cond_error(pthread_mutex_destroy(&readahead->readahead_mutex),SYS_MUTEX_DESTROY);
+  gt_free(readahead);
+  input_file->readahead = NULL;
+}
+GT_INLINE void gt_input_file_readahead_next_buffer(gt_input_file* const input_file) {
+  gt_input_file_readahead* const readahead = input_file->readahead;
+  GT_BEGIN_MUTEX_SECTION(readahead->readahead_mutex) {
+    while (readahead->num_filled==0 && !readahead->producer_eof) {
+      GT_CV_WAIT(readahead->buffer_filled_cond,readahead->readahead_mutex);
+    }
+    if (readahead->num_filled==0) {
+      input_file->buffer_size = 0;
+      input_file->eof = true;
+    } else {
+      // Release the current buffer & take the next one
+      readahead->consumer_idx = (readahead->consumer_idx+1)%readahead->num_buffers;
+      --(readahead->num_filled);
+      input_file->file_buffer = readahead->buffers[readahead->consumer_idx];
+      input_file->buffer_size = readahead->buffers_size[readahead->consumer_idx];
+      GT_CV_SIGNAL(readahead->buffer_free_cond);
+    }
+  } GT_END_MUTEX_SECTION(readahead->readahead_mutex);
+}
+
+/*
+ * Byte ranges
+ *   Ranges are cut on the raw file (pread). MAPPED_FILE blocks are views into the mmap
+ */
+void gt_input_file_enable_ranges(gt_input_file* const input_file,const uint64_t range_size) {
+  GT_INPUT_FILE_CHECK(input_file);
+  gt_cond_fatal_error(range_size==0,FILE_RANGES_SIZE);
+  gt_cond_fatal_error(input_file->file_format!=MAP && input_file->file_format!=SAM,
+      FILE_RANGES_FORMAT,input_file->file_name);
+  // Only plain seekable files (no pipes, compression or read-ahead)
+  gt_cond_fatal_error((input_file->file_type!=REGULAR_FILE && input_file->file_type!=MAPPED_FILE) ||
+      input_file->readahead!=NULL,FILE_RANGES_NOT_SEEKABLE,input_file->file_name);
+  if (input_file->file_type==REGULAR_FILE) {
+    gt_cond_fatal_error(lseek(fileno(input_file->file),0,SEEK_CUR)==-1,FILE_RANGES_NOT_SEEKABLE,input_file->file_name);
+  }
+  if (input_file->ranges!=NULL) return; // Already enabled
+  // Ranges start at the first record (headers consumed by the format detection)
+  gt_input_file_ranges* const ranges = gt_alloc(gt_input_file_ranges);
+  ranges->data_begin = input_file->global_pos+input_file->buffer_pos;
+  ranges->range_size = range_size;
+  ranges->next_range = 0;
+  ranges->num_ranges = (input_file->file_size>ranges->data_begin) ?
+      (input_file->file_size-ranges->data_begin+range_size-1)/range_size : 0;
+  input_file->ranges = ranges;
+  input_file->eof = (ranges->num_ranges==0);
+}
+GT_INLINE bool gt_input_file_next_range(
+    gt_input_file* const input_file,uint64_t* const block_id,uint64_t* const range_begin,uint64_t* const range_end) {
+  GT_INPUT_FILE_CHECK(input_file);
+  GT_NULL_CHECK(input_file->ranges);
+  gt_input_file_ranges* const ranges = input_file->ranges;
+  uint64_t range_id = 0;
+  bool range_available = false;
+  GT_BEGIN_MUTEX_SECTION(input_file->input_mutex) {
+    if (!input_file->eof) {
+      range_id = (ranges->next_range)++;
+      *block_id = gt_input_file_next_id(input_file);
+      if (range_id+1 >= ranges->num_ranges) input_file->eof = true;
+      range_available = true;
+    }
+  } GT_END_MUTEX_SECTION(input_file->input_mutex);
+  if (!range_available) return false;
+  *range_begin = ranges->data_begin+range_id*ranges->range_size;
+  *range_end = GT_MIN(*range_begin+ranges->range_size,input_file->file_size);
+  return true;
+}
+GT_INLINE uint64_t gt_input_file_pread(
+    gt_input_file* const input_file,const uint64_t offset,const uint64_t length,gt_vector* const buffer_dst) {
+  GT_INPUT_FILE_CHECK(input_file);
+  GT_VECTOR_CHECK(buffer_dst);
+  const int fd = (input_file->file_type==MAPPED_FILE) ? input_file->fildes : fileno(input_file->file);
+  gt_vector_clear(buffer_dst);
+  gt_vector_reserve(buffer_dst,length,false);
+  uint8_t* const mem = gt_vector_get_mem(buffer_dst,uint8_t);
+  uint64_t bytes_read = 0;
+  while (bytes_read < length) {
+    const ssize_t pread_bytes = pread(fd,mem+bytes_read,length-bytes_read,offset+bytes_read);
+    gt_cond_fatal_error__perror(pread_bytes==-1,FILE_READ,input_file->file_name);
+    if (pread_bytes==0) break; // EOF
+    bytes_read += pread_bytes;
+  }
+  gt_vector_set_used(buffer_dst,bytes_read);
+  return bytes_read;
+}
+GT_INLINE uint64_t gt_input_file_read_range(
+    gt_input_file* const input_file,const uint64_t offset,const uint64_t length,gt_vector* const buffer_dst) {
+  GT_INPUT_FILE_CHECK(input_file);
+  GT_VECTOR_CHECK(buffer_dst);
+  if (input_file->file_type==MAPPED_FILE) {
+    // Zero-copy (read-only view)
+    gt_vector_set_view(buffer_dst,input_file->file_buffer+offset,length);
+    return length;
+  }
+  return gt_input_file_pread(input_file,offset,length,buffer_dst);
+}
+
+/*
+ * Random access
+ */
+GT_INLINE void gt_input_file_seek(
+    gt_input_file* const input_file,const uint64_t offset,const uint64_t virtual_offset,const uint64_t processed_lines) {
+  GT_INPUT_FILE_CHECK(input_file);
+  gt_cond_fatal_error(input_file->readahead!=NULL || input_file->ranges!=NULL,FILE_INDEX_NOT_SEEKABLE,input_file->file_name);
+  // Full-size buffer (the detection prefix might not hold a whole BGZF block)
+  if (input_file->file_type!=MAPPED_FILE && input_file->buffer_allocated < GT_INPUT_BUFFER_SIZE) {
+    gt_input_file_resize_buffer(input_file,GT_INPUT_BUFFER_SIZE,false);
+  }
+  input_file->eof = false;
+  input_file->buffer_size = 0;
+  input_file->buffer_begin = 0;
+  input_file->buffer_pos = 0;
+  input_file->processed_lines = processed_lines;
+  switch (input_file->file_type) {
+    case MAPPED_FILE: // The whole file is the buffer
+      input_file->global_pos = 0;
+      input_file->buffer_size = input_file->file_size;
+      input_file->buffer_begin = GT_MIN(offset,input_file->file_size);
+      input_file->buffer_pos = input_file->buffer_begin;
+      input_file->eof = (offset >= input_file->file_size);
+      break;
+    case REGULAR_FILE:
+      gt_cond_fatal_error(fseek(input_file->file,offset,SEEK_SET)==-1,FILE_SEEK,input_file->file_name,offset);
+      input_file->global_pos = offset;
+      gt_input_file_fill_buffer(input_file);
+      break;
+#ifdef HAVE_ZLIB
+    case BGZIPPED_FILE: {
+      const uint64_t block_offset = GT_BGZF_VIRTUAL_OFFSET_BLOCK(virtual_offset);
+      const uint64_t offset_in_block = GT_BGZF_VIRTUAL_OFFSET_IN_BLOCK(virtual_offset);
+      gt_cond_fatal_error(!gt_bgzf_reader_seek(input_file->bgzf_reader,block_offset),
+          FILE_SEEK,input_file->file_name,block_offset);
+      input_file->global_pos = offset-offset_in_block;
+      gt_input_file_fill_buffer(input_file);
+      input_file->buffer_begin = GT_MIN(offset_in_block,input_file->buffer_size);
+      input_file->buffer_pos = input_file->buffer_begin;
+      if (input_file->buffer_pos >= input_file->buffer_size) gt_input_file_fill_buffer(input_file);
+      break;
+    }
+#endif
+    default:
+      gt_fatal_error(FILE_INDEX_NOT_SEEKABLE,input_file->file_name);
+      break;
+  }
+}
+
 /*
  * Basic line functions
  */
-GT_INLINE size_t gt_input_file_dump_to_buffer(gt_input_file* const input_file,gt_vector* const buffer_dst) { // FIXME: If mmap file, internal buffer is just pointers to mem
+GT_INLINE size_t gt_input_file_dump_to_buffer(gt_input_file* const input_file,gt_vector* const buffer_dst) {
   GT_INPUT_FILE_CHECK(input_file);
-  // Copy internal file buffer to buffer_dst
   const uint64_t chunk_size = input_file->buffer_pos-input_file->buffer_begin;
   if (gt_expect_false(chunk_size==0)) return 0;
+  uint8_t* const chunk = input_file->file_buffer+input_file->buffer_begin;
+  if (input_file->file_type==MAPPED_FILE) {
+    // Zero-copy. Hand out [begin,end) views into the mmap as long as the chunks are contiguous
+    if (gt_vector_is_empty(buffer_dst)) {
+      gt_vector_set_view(buffer_dst,chunk,chunk_size);
+      input_file->buffer_begin=input_file->buffer_pos;
+      return chunk_size;
+    } else if (gt_vector_is_view(buffer_dst) && gt_vector_get_free_elm(buffer_dst,uint8_t)==chunk) {
+      gt_vector_set_view(buffer_dst,gt_vector_get_mem(buffer_dst,uint8_t),gt_vector_get_used(buffer_dst)+chunk_size);
+      input_file->buffer_begin=input_file->buffer_pos;
+      return chunk_size;
+    }
+  }
+  // Copy internal file buffer to buffer_dst
   gt_vector_reserve_additional(buffer_dst,chunk_size);
-  memcpy(gt_vector_get_mem(buffer_dst,uint8_t)+gt_vector_get_used(buffer_dst),
-      input_file->file_buffer+input_file->buffer_begin,chunk_size);
+  memcpy(gt_vector_get_mem(buffer_dst,uint8_t)+gt_vector_get_used(buffer_dst),chunk,chunk_size);
   gt_vector_add_used(buffer_dst,chunk_size);
   // Update position
   input_file->buffer_begin=input_file->buffer_pos;
   // Return number of written bytes
   return chunk_size;
 }
-GT_INLINE size_t gt_input_file_fill_buffer(gt_input_file* const input_file) {
+GT_INLINE size_t gt_input_file_read_chunk(gt_input_file* const input_file,uint8_t* const buffer,const uint64_t buffer_size) {
 #ifdef HAVE_BZLIB
   int bzerr;
 #endif
-  GT_INPUT_FILE_CHECK(input_file);
-  input_file->global_pos += input_file->buffer_size;
-  input_file->buffer_pos = 0;
-  input_file->buffer_begin = 0;
-  if (gt_expect_true(
-      (input_file->file_type==STREAM && !feof(input_file->file)) ||
-      (input_file->file_type==REGULAR_FILE && !feof(input_file->file)))) {
-    input_file->buffer_size =
-        fread(input_file->file_buffer,sizeof(uint8_t),GT_INPUT_BUFFER_SIZE,input_file->file);
-    if (input_file->buffer_size==0) {
-      input_file->eof = true;
+  switch (input_file->file_type) {
+    case STREAM:
+    case REGULAR_FILE: {
+      if (feof(input_file->file)) return 0;
+      const size_t bytes_read = fread(buffer,sizeof(uint8_t),buffer_size,input_file->file);
+      gt_cond_fatal_error(ferror(input_file->file),FILE_READ,input_file->file_name);
+      return bytes_read;
     }
-    return input_file->buffer_size;
-  } else if (input_file->file_type==MAPPED_FILE && input_file->global_pos < input_file->file_size) {
-    input_file->buffer_size = input_file->file_size-input_file->global_pos;
-    return input_file->buffer_size;
+    case DIRECT_FILE:
+      return gt_dio_reader_read_chunk(input_file->dio_reader,buffer,buffer_size);
 #ifdef HAVE_ZLIB
-  } else if (input_file->file_type==GZIPPED_FILE && !gzeof((gzFile)input_file->file)) {
-    input_file->buffer_size = gzread((gzFile)input_file->file,input_file->file_buffer,GT_INPUT_BUFFER_SIZE);
-    if (input_file->buffer_size==0) {
-      input_file->eof = true;
+    case GZIPPED_FILE: {
+      if (gzeof((gzFile)input_file->file)) return 0;
+      const int gz_read = gzread((gzFile)input_file->file,buffer,buffer_size);
+      int gz_errnum;
+      gzerror((gzFile)input_file->file,&gz_errnum); // Z_BUF_ERROR on a truncated stream
+      gt_cond_fatal_error(gz_read<0 || gz_errnum!=Z_OK,FILE_READ,input_file->file_name);
+      return gz_read;
     }
-    return input_file->buffer_size;
+    case BGZIPPED_FILE:
+      return gt_bgzf_reader_read_chunk(input_file->bgzf_reader,buffer,buffer_size);
 #endif
 #ifdef HAVE_BZLIB
-  } else if (input_file->file_type==BZIPPED_FILE) {
-    input_file->buffer_size = BZ2_bzRead(&bzerr,input_file->file,input_file->file_buffer,GT_INPUT_BUFFER_SIZE);
-    if(input_file->buffer_size==0) {
-      input_file->eof=true;
+    case BZIPPED_FILE: {
+      if (input_file->bz_stream_end) return 0;
+      const int bz_read = BZ2_bzRead(&bzerr,input_file->file,buffer,buffer_size);
+      gt_cond_fatal_error(bzerr!=BZ_OK && bzerr!=BZ_STREAM_END,FILE_READ,input_file->file_name); // Corrupted/truncated stream
+      input_file->bz_stream_end = (bzerr==BZ_STREAM_END);
+      return bz_read;
     }
-    return input_file->buffer_size;
 #endif
+    default:
+      return 0;
+  }
+}
+GT_INLINE size_t gt_input_file_fill_buffer(gt_input_file* const input_file) {
+  GT_INPUT_FILE_CHECK(input_file);
+  input_file->global_pos += input_file->buffer_size;
+  input_file->buffer_pos = 0;
+  input_file->buffer_begin = 0;
+  if (input_file->file_type==MAPPED_FILE) {
+    if (input_file->global_pos < input_file->file_size) {
+      input_file->buffer_size = input_file->file_size-input_file->global_pos;
+    } else {
+      input_file->buffer_size = 0;
+      input_file->eof = true;
+    }
+  } else if (input_file->readahead!=NULL) {
+    gt_input_file_readahead_next_buffer(input_file);
   } else {
-    input_file->eof = true;
-    return 0;
+    // Past the detection prefix, switch to the full-size buffer (its content has been consumed)
+    if (input_file->buffer_allocated < GT_INPUT_BUFFER_SIZE && input_file->global_pos > 0) {
+      gt_input_file_resize_buffer(input_file,GT_INPUT_BUFFER_SIZE,false);
+    }
+    input_file->buffer_size = gt_input_file_read_chunk(input_file,input_file->file_buffer,input_file->buffer_allocated);
+    if (input_file->buffer_size==0) input_file->eof = true;
   }
+  return input_file->buffer_size;
+}
+GT_INLINE void gt_input_file_resize_buffer(
+    gt_input_file* const input_file,const uint64_t buffer_allocated,const bool keep_content) {
+  uint8_t* const file_buffer = (input_file->file_type==DIRECT_FILE) ?
+      gt_dio_buffer_new(buffer_allocated) : gt_malloc(buffer_allocated);
+  if (buffer_allocated>=GT_MM_HUGE_PAGE_THRESHOLD) gt_mm_advise_huge_pages(file_buffer,buffer_allocated);
+  if (keep_content) memcpy(file_buffer,input_file->file_buffer,input_file->buffer_size);
+  gt_free(input_file->file_buffer);
+  input_file->file_buffer = file_buffer;
+  gt_mm_acc_resize(GT_MM_ACC_INPUT_BUFFERS,input_file->buffer_allocated,buffer_allocated);
+  input_file->buffer_allocated = buffer_allocated;
+}
+GT_INLINE bool gt_input_file_extend_prefix(gt_input_file* const input_file) {
+  // Already the whole file (or a full-size buffer) in memory
+  if (input_file->eof || input_file->file_type==MAPPED_FILE || input_file->readahead!=NULL) return false;
+  if (input_file->buffer_allocated >= GT_INPUT_BUFFER_SIZE) return false;
+  // Short read, nothing else to read (BGZF only reads whole blocks)
+  if (input_file->buffer_size < input_file->buffer_allocated && input_file->file_type!=BGZIPPED_FILE) return false;
+  // Append the rest of the first chunk
+  gt_input_file_resize_buffer(input_file,GT_INPUT_BUFFER_SIZE,true);
+  const uint64_t bytes_read = gt_input_file_read_chunk(input_file,
+      input_file->file_buffer+input_file->buffer_size,input_file->buffer_allocated-input_file->buffer_size);
+  input_file->buffer_size += bytes_read;
+  return bytes_read > 0;
 }
 GT_INLINE size_t gt_input_file_next_line(gt_input_file* const input_file,gt_vector* const buffer_dst) {
   GT_INPUT_FILE_CHECK(input_file);
@@ -241,6 +631,21 @@ GT_INLINE size_t gt_input_file_next_line(gt_input_file* const input_file,gt_vect
   GT_INPUT_FILE_HANDLE_EOL(input_file,buffer_dst);
   return GT_INPUT_FILE_LINE_READ;
 }
+GT_INLINE uint64_t gt_input_file_add_bytes(
+    gt_input_file* const input_file,gt_vector* const buffer_dst,const uint64_t num_bytes) {
+  GT_INPUT_FILE_CHECK(input_file);
+  GT_VECTOR_CHECK(buffer_dst);
+  uint64_t bytes_added = 0;
+  while (bytes_added<num_bytes) {
+    GT_INPUT_FILE_CHECK_BUFFER__DUMP(input_file,buffer_dst);
+    if (input_file->eof) break;
+    const uint64_t chunk_size = GT_MIN(num_bytes-bytes_added,input_file->buffer_size-input_file->buffer_pos);
+    input_file->buffer_pos += chunk_size;
+    bytes_added += chunk_size;
+  }
+  gt_input_file_dump_to_buffer(input_file,buffer_dst);
+  return bytes_added;
+}
 GT_INLINE size_t gt_input_file_next_record(
     gt_input_file* const input_file,gt_vector* const buffer_dst,gt_string* const first_field,
     uint64_t* const num_blocks,uint64_t* const num_tabs) {
@@ -328,32 +733,92 @@ GT_INLINE bool gt_input_file_test_map(
     gt_input_file* const input_file,gt_map_file_format* const map_file_format,const bool show_errors);
 GT_INLINE bool gt_input_file_test_sam(
     gt_input_file* const input_file,gt_sam_headers* const sam_headers,const bool show_errors);
+GT_INLINE bool gt_input_file_test_bam(
+    gt_input_file* const input_file,gt_bam_headers* const bam_headers,const bool show_errors);
+GT_INLINE bool gt_input_file_test_gtb(gt_input_file* const input_file,const bool show_errors);
 /* */
 gt_file_format gt_input_file_detect_file_format(gt_input_file* const input_file) {
   GT_INPUT_FILE_CHECK(input_file);
   if (input_file->file_format != FILE_FORMAT_UNKNOWN) return input_file->file_format;
-  // Try to determine the file format
+  // Try to determine the file format (on a prefix of the file, extended to the whole
+  // first chunk if it is not enough; e.g. long SAM headers or lines)
   gt_input_file_fill_buffer(input_file);
-  // MAP test
-  if (gt_input_file_test_map(input_file,&(input_file->map_type),false)) {
-    input_file->file_format = MAP;
-    return MAP;
-  }
-  // FASTA test
-  if (gt_input_file_test_fasta(input_file,&(input_file->fasta_type),false)) {
-    input_file->file_format = FASTA;
-    return FASTA;
-  }
-  // SAM test
-  if (gt_input_file_test_sam(input_file,&(input_file->sam_headers),false)) {
-    input_file->file_format = SAM;
-    return SAM;
-  }
+  do {
+    // BAM test (binary, checked first)
+    if (gt_input_file_test_bam(input_file,&(input_file->bam_headers),false)) {
+      input_file->file_format = BAM;
+      return BAM;
+    }
+    // GTB test (binary)
+    if (gt_input_file_test_gtb(input_file,false)) {
+      input_file->file_format = GTB;
+      return GTB;
+    }
+    // MAP test
+    if (gt_input_file_test_map(input_file,&(input_file->map_type),false)) {
+      input_file->file_format = MAP;
+      return MAP;
+    }
+    // FASTA test
+    if (gt_input_file_test_fasta(input_file,&(input_file->fasta_type),false)) {
+      input_file->file_format = FASTA;
+      return FASTA;
+    }
+    // SAM test
+    if (gt_input_file_test_sam(input_file,&(input_file->sam_headers),false)) {
+      input_file->file_format = SAM;
+      return SAM;
+    }
+  } while (gt_input_file_extend_prefix(input_file));
   // gt_error(FILE_FORMAT);
   return FILE_FORMAT_UNKNOWN;
 }
 
 
+/*
+ * Line scanning
+ */
+GT_INLINE uint64_t gt_input_file_scan_eols(
+    const uint8_t* const buffer,const uint64_t length,const uint64_t num_eols,
+    uint64_t* const num_eols_found,bool* const dos_eol) {
+  GT_NULL_CHECK(buffer); GT_NULL_CHECK(num_eols_found); GT_NULL_CHECK(dos_eol);
+  uint64_t pos = 0, eols_found = 0;
+  *dos_eol = false;
+  if (gt_expect_false(num_eols==0)) { *num_eols_found = 0; return 0; }
+#ifdef GT_SCAN_WORD_LENGTH
+  // Vectorized scan (word by word)
+  bool dos_found = false;
+  while (pos+GT_SCAN_WORD_LENGTH <= length) {
+    uint64_t eol_mask = GT_SCAN_WORD_MASK(buffer+pos,EOL);
+    const uint64_t dos_mask = GT_SCAN_WORD_MASK(buffer+pos,DOS_EOL);
+    const uint64_t eols_in_word = GT_POPCOUNT_64(eol_mask);
+    if (eols_found+eols_in_word >= num_eols) {
+      // Locate the EOL within the word (clear the lower ones)
+      uint64_t i;
+      for (i=eols_found+1;i<num_eols;++i) eol_mask &= eol_mask-1;
+      const uint64_t offset = __builtin_ctzll(eol_mask)+1;
+      *dos_eol = dos_found || (dos_mask & (((uint64_t)1<<offset)-1))!=0;
+      *num_eols_found = num_eols;
+      return pos+offset;
+    }
+    dos_found |= (dos_mask!=0);
+    eols_found += eols_in_word;
+    pos += GT_SCAN_WORD_LENGTH;
+  }
+  *dos_eol = dos_found;
+#endif
+  // Scan the remainder
+  for (;pos<length;++pos) {
+    if (buffer[pos]==DOS_EOL) *dos_eol = true;
+    if (buffer[pos]==EOL && ++eols_found==num_eols) {
+      *num_eols_found = eols_found;
+      return pos+1;
+    }
+  }
+  *num_eols_found = eols_found;
+  return length;
+}
+
 /*
  * Line Readers (thread-unsafe, must call mutex functions before)
  */
@@ -361,8 +826,28 @@ GT_INLINE uint64_t gt_input_file_add_lines(
     gt_input_file* const input_file,gt_vector* buffer_dst,const uint64_t num_lines) {
   GT_INPUT_FILE_CHECK(input_file);
   GT_VECTOR_CHECK(buffer_dst);
-  // Read lines
+  // Read lines (cutting the block with a single scan per input buffer)
   uint64_t lines_read = 0;
+  bool partial_line = false;
+  while (lines_read<num_lines) {
+    GT_INPUT_FILE_CHECK_BUFFER__DUMP(input_file,buffer_dst);
+    if (input_file->eof) {
+      if (partial_line) ++lines_read; // Last line (without EOL)
+      break;
+    }
+    uint64_t eols_found;
+    bool dos_eol;
+    const uint64_t bytes_scanned = gt_input_file_scan_eols(
+        input_file->file_buffer+input_file->buffer_pos,input_file->buffer_size-input_file->buffer_pos,
+        num_lines-lines_read,&eols_found,&dos_eol);
+    if (gt_expect_false(dos_eol)) break; // DOS_EOLs are normalized line by line (below)
+    input_file->buffer_pos += bytes_scanned;
+    lines_read += eols_found;
+    partial_line = (input_file->file_buffer[input_file->buffer_pos-1]!=EOL);
+  }
+  if (!input_file->eof) {
+    GT_INPUT_FILE_CHECK_BUFFER__DUMP(input_file,buffer_dst);
+  }
   while (lines_read<num_lines && gt_input_file_next_line(input_file,buffer_dst)) {
     ++lines_read;
   }
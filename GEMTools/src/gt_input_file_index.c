@@ -0,0 +1,358 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_input_file_index.c
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Random-access index for MAP/FASTA/FASTQ files (".gti" sidecar)
+ */
+
+#include "gt_input_file_index.h"
+#include "gt_input_file.h"
+
+#define GT_INPUT_FILE_INDEX_NUM_INITIAL_SAMPLES 1000
+#define GT_INPUT_FILE_INDEX_NUM_INITIAL_RECORDS (1000*GT_INPUT_FILE_INDEX_SAMPLING_RATE)
+#define GT_INPUT_FILE_INDEX_TAG_LENGTH 100
+
+// Tag state (builder)
+#define GT_IFI_TAG_NONE    0
+#define GT_IFI_TAG_BEGIN   1
+#define GT_IFI_TAG_READING 2
+
+#define GT_IFI_FASTA_TAG_BEGIN '>'
+#define GT_IFI_FASTQ_TAG_BEGIN '@'
+
+/*
+ * Setup
+ */
+GT_INLINE gt_input_file_index* gt_input_file_index_new(
+    const uint64_t sampling_rate,const uint64_t lines_per_record,const bool bgzf) {
+  gt_cond_fatal_error(sampling_rate==0,FILE_INDEX_SAMPLING_RATE);
+  GT_ZERO_CHECK(lines_per_record);
+  gt_input_file_index* const index = gt_alloc(gt_input_file_index);
+  /* Layout */
+  index->sampling_rate = sampling_rate;
+  index->lines_per_record = lines_per_record;
+  index->bgzf = bgzf;
+  /* Source file */
+  index->source_size = 0;
+  index->source_mtime = 0;
+  /* Index */
+  index->num_records = 0;
+  index->samples = gt_vector_new(GT_INPUT_FILE_INDEX_NUM_INITIAL_SAMPLES,sizeof(gt_input_file_index_sample));
+  index->tag_hashes = gt_vector_new(GT_INPUT_FILE_INDEX_NUM_INITIAL_RECORDS,sizeof(uint32_t));
+  /* Builder */
+  index->scan_offset = 0;
+  index->record_line = 0;
+  index->line_begin = true;
+  index->tag_state = GT_IFI_TAG_NONE;
+  index->tag = gt_string_new(GT_INPUT_FILE_INDEX_TAG_LENGTH);
+  return index;
+}
+GT_INLINE void gt_input_file_index_delete(gt_input_file_index* const index) {
+  GT_INPUT_FILE_INDEX_CHECK(index);
+  gt_vector_delete(index->samples);
+  gt_vector_delete(index->tag_hashes);
+  gt_string_delete(index->tag);
+  gt_free(index);
+}
+GT_INLINE uint64_t gt_input_file_index_get_lines_per_record(gt_input_file* const input_file) {
+  GT_INPUT_FILE_CHECK(input_file);
+  switch (input_file->file_format) {
+    case MAP: return GT_INPUT_FILE_INDEX_LINES_MAP;
+    case FASTA:
+      switch (input_file->fasta_type.fasta_format) {
+        case F_FASTA: return GT_INPUT_FILE_INDEX_LINES_FASTA;
+        case F_FASTQ: return GT_INPUT_FILE_INDEX_LINES_FASTQ;
+        default: return 0; // MULTI-FASTA records span a variable number of lines
+      }
+      break;
+    default: return 0;
+  }
+}
+GT_INLINE char* gt_input_file_index_get_file_name(const char* const file_name) {
+  GT_NULL_CHECK(file_name);
+  const uint64_t file_name_length = strlen(file_name);
+  const uint64_t extension_length = strlen(GT_INPUT_FILE_INDEX_EXTENSION);
+  char* const index_file_name = gt_malloc(file_name_length+extension_length+1);
+  memcpy(index_file_name,file_name,file_name_length);
+  memcpy(index_file_name+file_name_length,GT_INPUT_FILE_INDEX_EXTENSION,extension_length+1);
+  return index_file_name;
+}
+
+/*
+ * Tags (up to the first SPACE/TAB, without the pair info "/1","/2")
+ */
+#define gt_input_file_index_is_tag_end(character) \
+  ((character)==TAB || (character)==SPACE || (character)==EOL || (character)==DOS_EOL)
+GT_INLINE uint64_t gt_input_file_index_tag_length(const char* const tag,const uint64_t tag_length) {
+  return (tag_length>2 && tag[tag_length-2]==SLASH) ? tag_length-2 : tag_length;
+}
+GT_INLINE uint32_t gt_input_file_index_hash_tag(const char* const tag,const uint64_t tag_length) {
+  // FNV-1a (folded)
+  uint64_t hash = 0xcbf29ce484222325ull, i;
+  for (i=0;i<tag_length;++i) {
+    hash ^= (uint8_t)tag[i];
+    hash *= 0x100000001b3ull;
+  }
+  return (uint32_t)(hash ^ (hash>>32));
+}
+
+/*
+ * Building
+ */
+GT_INLINE void gt_input_file_index_add_record(gt_input_file_index* const index,const uint64_t offset) {
+  if (index->num_records%index->sampling_rate==0) {
+    gt_vector_reserve_additional(index->samples,1);
+    gt_input_file_index_sample* const sample = gt_vector_get_free_elm(index->samples,gt_input_file_index_sample);
+    sample->offset = offset;
+    sample->virtual_offset = offset;
+    gt_vector_inc_used(index->samples);
+  }
+  ++index->num_records;
+}
+GT_INLINE void gt_input_file_index_add_tag(gt_input_file_index* const index) {
+  const char* const tag = gt_string_get_string(index->tag);
+  const uint32_t tag_hash = gt_input_file_index_hash_tag(tag,
+      gt_input_file_index_tag_length(tag,gt_string_get_length(index->tag)));
+  gt_vector_insert(index->tag_hashes,tag_hash,uint32_t);
+  index->tag_state = GT_IFI_TAG_NONE;
+}
+GT_INLINE void gt_input_file_index_scan(gt_input_file_index* const index,const uint8_t* const data,const uint64_t length) {
+  GT_INPUT_FILE_INDEX_CHECK(index);
+  uint64_t pos = 0;
+  while (pos < length) {
+    // Beginning of a record
+    if (index->line_begin) {
+      index->line_begin = false;
+      if (index->record_line==0) {
+        gt_input_file_index_add_record(index,index->scan_offset+pos);
+        gt_string_clear(index->tag);
+        index->tag_state = GT_IFI_TAG_BEGIN;
+      }
+    }
+    // Tag (it might continue in the next chunk)
+    if (index->tag_state!=GT_IFI_TAG_NONE) {
+      if (index->tag_state==GT_IFI_TAG_BEGIN) {
+        index->tag_state = GT_IFI_TAG_READING;
+        if (index->lines_per_record>1 && (data[pos]==GT_IFI_FASTQ_TAG_BEGIN || data[pos]==GT_IFI_FASTA_TAG_BEGIN)) {
+          ++pos; continue;
+        }
+      }
+      const uint64_t tag_begin = pos;
+      while (pos<length && !gt_input_file_index_is_tag_end(data[pos])) ++pos;
+      gt_string_right_append_string(index->tag,(const char*)data+tag_begin,pos-tag_begin);
+      if (pos==length) break;
+      gt_input_file_index_add_tag(index);
+    }
+    // Skip to the next line
+    uint64_t eols_found;
+    bool dos_eol;
+    pos += gt_input_file_scan_eols(data+pos,length-pos,1,&eols_found,&dos_eol);
+    if (eols_found>0) {
+      index->line_begin = true;
+      index->record_line = (index->record_line+1)%index->lines_per_record;
+    }
+  }
+  index->scan_offset += length;
+}
+GT_INLINE void gt_input_file_index_scan_end(gt_input_file_index* const index) {
+  // Last tag (at EOF, without EOL)
+  if (index->tag_state!=GT_IFI_TAG_NONE) gt_input_file_index_add_tag(index);
+}
+GT_INLINE gt_input_file_index* gt_input_file_index_build(gt_input_file* const input_file,const uint64_t sampling_rate) {
+  GT_INPUT_FILE_CHECK(input_file);
+  const uint64_t lines_per_record = gt_input_file_index_get_lines_per_record(input_file);
+  gt_cond_fatal_error(lines_per_record==0,FILE_INDEX_FORMAT,input_file->file_name);
+  const bool bgzf = (input_file->file_type==BGZIPPED_FILE);
+  gt_input_file_index* const index = gt_input_file_index_new(sampling_rate,lines_per_record,bgzf);
+  // Scan the whole file from the beginning (chunk by chunk, as read by the input file)
+  gt_input_file_seek(input_file,0,0,0);
+  while (!input_file->eof) {
+    const uint64_t chunk_offset = input_file->buffer_pos;
+    const uint64_t first_sample = gt_vector_get_used(index->samples);
+    gt_input_file_index_scan(index,input_file->file_buffer+chunk_offset,input_file->buffer_size-chunk_offset);
+#ifdef HAVE_ZLIB
+    if (bgzf) { // Translate the offsets of the new samples into virtual offsets
+      GT_VECTOR_ITERATE_OFFSET(index->samples,sample,sample_num,first_sample,gt_input_file_index_sample) {
+        sample->virtual_offset = gt_bgzf_reader_get_virtual_offset(input_file->bgzf_reader,sample->offset-input_file->global_pos);
+      }
+    }
+#endif
+    input_file->buffer_pos = input_file->buffer_size;
+    gt_input_file_fill_buffer(input_file);
+  }
+  gt_input_file_index_scan_end(index);
+  return index;
+}
+
+/*
+ * Index I/O
+ */
+typedef struct {
+  char magic[GT_INPUT_FILE_INDEX_MAGIC_LENGTH];
+  uint8_t version;
+  uint32_t lines_per_record;
+  uint32_t bgzf;
+  uint64_t source_size;
+  uint64_t source_mtime;
+  uint64_t sampling_rate;
+  uint64_t num_records;
+  uint64_t num_samples;
+} gt_input_file_index_header;
+GT_INLINE void gt_input_file_index_stat_source(
+    const char* const source_file_name,uint64_t* const source_size,uint64_t* const source_mtime) {
+  struct stat stat_info;
+  gt_cond_fatal_error(stat(source_file_name,&stat_info)==-1,FILE_STAT,source_file_name);
+  *source_size = stat_info.st_size;
+  *source_mtime = stat_info.st_mtime;
+}
+GT_INLINE void gt_input_file_index_save(gt_input_file_index* const index,const char* const source_file_name) {
+  GT_INPUT_FILE_INDEX_CHECK(index);
+  GT_NULL_CHECK(source_file_name);
+  gt_input_file_index_scan_end(index);
+  gt_input_file_index_stat_source(source_file_name,&index->source_size,&index->source_mtime);
+  char* const file_name = gt_input_file_index_get_file_name(source_file_name);
+  FILE* const file = fopen(file_name,"w");
+  gt_cond_fatal_error(file==NULL,FILE_OPEN,file_name);
+  // Header
+  gt_input_file_index_header header;
+  memset(&header,0,sizeof(header));
+  memcpy(header.magic,GT_INPUT_FILE_INDEX_MAGIC,GT_INPUT_FILE_INDEX_MAGIC_LENGTH);
+  header.version = GT_INPUT_FILE_INDEX_VERSION;
+  header.lines_per_record = index->lines_per_record;
+  header.bgzf = index->bgzf;
+  header.source_size = index->source_size;
+  header.source_mtime = index->source_mtime;
+  header.sampling_rate = index->sampling_rate;
+  header.num_records = index->num_records;
+  header.num_samples = gt_vector_get_used(index->samples);
+  bool write_error = fwrite(&header,sizeof(header),1,file)!=1;
+  // Samples & tags
+  write_error |= fwrite(gt_vector_get_mem(index->samples,gt_input_file_index_sample),
+      sizeof(gt_input_file_index_sample),header.num_samples,file)!=header.num_samples;
+  write_error |= fwrite(gt_vector_get_mem(index->tag_hashes,uint32_t),
+      sizeof(uint32_t),header.num_records,file)!=header.num_records;
+  gt_cond_fatal_error(write_error,FILE_WRITE,file_name);
+  gt_cond_fatal_error(fclose(file),FILE_CLOSE,file_name);
+  gt_free(file_name);
+}
+GT_INLINE gt_input_file_index* gt_input_file_index_load(const char* const file_name) {
+  GT_NULL_CHECK(file_name);
+  FILE* const file = fopen(file_name,"r");
+  gt_cond_fatal_error(file==NULL,FILE_OPEN,file_name);
+  // Header
+  gt_input_file_index_header header;
+  gt_cond_fatal_error(fread(&header,sizeof(header),1,file)!=1 ||
+      memcmp(header.magic,GT_INPUT_FILE_INDEX_MAGIC,GT_INPUT_FILE_INDEX_MAGIC_LENGTH)!=0 ||
+      header.sampling_rate==0 || header.lines_per_record==0 ||
+      header.num_samples!=(header.num_records+header.sampling_rate-1)/header.sampling_rate,FILE_INDEX_CORRUPTED,file_name);
+  gt_cond_fatal_error(header.version!=GT_INPUT_FILE_INDEX_VERSION,FILE_INDEX_VERSION,file_name);
+  gt_input_file_index* const index = gt_input_file_index_new(header.sampling_rate,header.lines_per_record,header.bgzf);
+  index->source_size = header.source_size;
+  index->source_mtime = header.source_mtime;
+  index->num_records = header.num_records;
+  // Samples & tags
+  gt_vector_reserve(index->samples,header.num_samples,false);
+  gt_vector_reserve(index->tag_hashes,header.num_records,false);
+  gt_cond_fatal_error(
+      fread(gt_vector_get_mem(index->samples,gt_input_file_index_sample),
+          sizeof(gt_input_file_index_sample),header.num_samples,file)!=header.num_samples ||
+      fread(gt_vector_get_mem(index->tag_hashes,uint32_t),
+          sizeof(uint32_t),header.num_records,file)!=header.num_records,FILE_INDEX_CORRUPTED,file_name);
+  gt_vector_set_used(index->samples,header.num_samples);
+  gt_vector_set_used(index->tag_hashes,header.num_records);
+  fclose(file);
+  return index;
+}
+
+/*
+ * Random access
+ */
+GT_INLINE bool gt_input_file_load_index(gt_input_file* const input_file) {
+  GT_INPUT_FILE_CHECK(input_file);
+  char* const index_file_name = gt_input_file_index_get_file_name(input_file->file_name);
+  if (access(index_file_name,R_OK)!=0) {
+    gt_free(index_file_name);
+    return false;
+  }
+  gt_input_file_index* const index = gt_input_file_index_load(index_file_name);
+  gt_cond_fatal_error(index->bgzf!=(input_file->file_type==BGZIPPED_FILE) ||
+      index->lines_per_record!=gt_input_file_index_get_lines_per_record(input_file),FILE_INDEX_MISMATCH,index_file_name);
+  uint64_t source_size, source_mtime;
+  gt_input_file_index_stat_source(input_file->file_name,&source_size,&source_mtime);
+  gt_cond_fatal_error(index->source_size!=source_size ||
+      index->source_mtime!=source_mtime,FILE_INDEX_STALE,index_file_name);
+  gt_free(index_file_name);
+  if (input_file->index!=NULL) gt_input_file_index_delete(input_file->index);
+  input_file->index = index;
+  return true;
+}
+GT_INLINE void gt_input_file_index_skip_lines(gt_input_file* const input_file,uint64_t num_lines) {
+  while (num_lines>0) {
+    GT_INPUT_FILE_CHECK_BUFFER(input_file);
+    if (input_file->eof) break;
+    uint64_t eols_found;
+    bool dos_eol;
+    input_file->buffer_pos += gt_input_file_scan_eols(input_file->file_buffer+input_file->buffer_pos,
+        input_file->buffer_size-input_file->buffer_pos,num_lines,&eols_found,&dos_eol);
+    input_file->processed_lines += eols_found;
+    num_lines -= eols_found;
+  }
+  input_file->buffer_begin = input_file->buffer_pos; // Nothing to dump
+  GT_INPUT_FILE_CHECK_BUFFER(input_file);
+}
+GT_INLINE bool gt_input_file_seek_template(gt_input_file* const input_file,const uint64_t template_num) {
+  GT_INPUT_FILE_CHECK(input_file);
+  gt_input_file_index* const index = input_file->index;
+  gt_cond_fatal_error(index==NULL,FILE_INDEX_NOT_LOADED,input_file->file_name);
+  if (template_num >= index->num_records) return false;
+  // Closest sample (before) & skip the records in between
+  const uint64_t sample_num = template_num/index->sampling_rate;
+  gt_input_file_index_sample* const sample = gt_vector_get_elm(index->samples,sample_num,gt_input_file_index_sample);
+  gt_input_file_lock(input_file);
+  gt_input_file_seek(input_file,sample->offset,sample->virtual_offset,
+      sample_num*index->sampling_rate*index->lines_per_record);
+  gt_input_file_index_skip_lines(input_file,(template_num%index->sampling_rate)*index->lines_per_record);
+  gt_input_file_unlock(input_file);
+  return true;
+}
+GT_INLINE bool gt_input_file_index_cmp_tag(
+    gt_input_file* const input_file,gt_input_file_index* const index,const char* const tag,const uint64_t tag_length) {
+  // Read the tag of the record at the current position (consumed)
+  gt_string* const record_tag = index->tag;
+  gt_string_clear(record_tag);
+  if (input_file->eof) return false;
+  if (index->lines_per_record>1 && (GT_INPUT_FILE_CURRENT_CHAR(input_file)==GT_IFI_FASTQ_TAG_BEGIN ||
+                                    GT_INPUT_FILE_CURRENT_CHAR(input_file)==GT_IFI_FASTA_TAG_BEGIN)) {
+    GT_INPUT_FILE_NEXT_CHAR(input_file);
+  }
+  while (!input_file->eof && !gt_input_file_index_is_tag_end(GT_INPUT_FILE_CURRENT_CHAR(input_file))) {
+    gt_string_append_char(record_tag,GT_INPUT_FILE_CURRENT_CHAR(input_file));
+    GT_INPUT_FILE_NEXT_CHAR(input_file);
+  }
+  const uint64_t record_tag_length =
+      gt_input_file_index_tag_length(gt_string_get_string(record_tag),gt_string_get_length(record_tag));
+  return record_tag_length==tag_length && gt_strneq(gt_string_get_string(record_tag),tag,tag_length);
+}
+GT_INLINE bool gt_input_file_seek_tag(
+    gt_input_file* const input_file,const char* const tag,const uint64_t tag_length,uint64_t* const template_num) {
+  GT_INPUT_FILE_CHECK(input_file);
+  GT_NULL_CHECK(tag);
+  gt_input_file_index* const index = input_file->index;
+  gt_cond_fatal_error(index==NULL,FILE_INDEX_NOT_LOADED,input_file->file_name);
+  const uint64_t length = gt_input_file_index_tag_length(tag,tag_length);
+  const uint32_t tag_hash = gt_input_file_index_hash_tag(tag,length);
+  // Check every record with the same hash (first match)
+  const uint32_t* const tag_hashes = gt_vector_get_mem(index->tag_hashes,uint32_t);
+  uint64_t i;
+  for (i=0;i<index->num_records;++i) {
+    if (gt_expect_true(tag_hashes[i]!=tag_hash)) continue;
+    gt_input_file_seek_template(input_file,i);
+    if (gt_input_file_index_cmp_tag(input_file,index,tag,length)) {
+      gt_input_file_seek_template(input_file,i); // Back to the beginning of the record
+      if (template_num!=NULL) *template_num = i;
+      return true;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,221 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_input_file_set.c
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Set of input files (shards) read as a single logical input
+ */
+
+#include <glob.h>
+#include "gt_input_file_set.h"
+
+#define GT_INPUT_FILE_SET_NUM_INITIAL_FILES 16
+#define GT_INPUT_FILE_SET_SEPARATOR ','
+
+/*
+ * Setup
+ */
+GT_INLINE void gt_input_file_set_attach_file(gt_input_file_set* const input_file_set,gt_input_file* const input_file) {
+  input_file->shared_processed_id = &input_file_set->processed_id;
+  if (!input_file_set->sharded) input_file->shared_mutex = &input_file_set->read_mutex;
+}
+GT_INLINE void gt_input_file_set_add_file(
+    gt_input_file_set* const input_file_set,char* const file_name,gt_input_file* const input_file) {
+  gt_vector_reserve_additional(input_file_set->shards,1);
+  gt_input_file_shard* const shard = gt_vector_get_free_elm(input_file_set->shards,gt_input_file_shard);
+  shard->file_name = file_name;
+  shard->input_file = input_file;
+  shard->num_readers = 0;
+  shard->exhausted = false;
+  if (input_file!=NULL) gt_input_file_set_attach_file(input_file_set,input_file);
+  gt_vector_inc_used(input_file_set->shards);
+}
+GT_INLINE gt_input_file_set* gt_input_file_set_allocate(const bool mmap_files,const bool sharded,const bool owned_files) {
+  gt_input_file_set* const input_file_set = gt_alloc(gt_input_file_set);
+  input_file_set->shards = gt_vector_new(GT_INPUT_FILE_SET_NUM_INITIAL_FILES,sizeof(gt_input_file_shard));
+  input_file_set->mmap_files = mmap_files;
+  input_file_set->sharded = sharded;
+  input_file_set->owned_files = owned_files;
+  input_file_set->file_format = FILE_FORMAT_UNKNOWN;
+  input_file_set->processed_id = 0;
+  gt_cond_fatal_error(pthread_mutex_init(&input_file_set->read_mutex,NULL),SYS_MUTEX_INIT);
+  gt_cond_fatal_error(pthread_mutex_init(&input_file_set->set_mutex,NULL),SYS_MUTEX_INIT);
+  return input_file_set;
+}
+GT_INLINE void gt_input_file_set_open_first(gt_input_file_set* const input_file_set) {
+  gt_cond_fatal_error(gt_vector_is_empty(input_file_set->shards),FILE_SET_EMPTY);
+  gt_input_file_shard* const first_shard = gt_vector_get_elm(input_file_set->shards,0,gt_input_file_shard);
+  first_shard->input_file = gt_input_file_open(first_shard->file_name,input_file_set->mmap_files);
+  gt_input_file_set_attach_file(input_file_set,first_shard->input_file);
+  input_file_set->file_format = first_shard->input_file->file_format;
+}
+gt_input_file_set* gt_input_file_set_open(
+    char** const file_names,const uint64_t num_files,const bool mmap_files,const bool sharded) {
+  GT_NULL_CHECK(file_names);
+  gt_input_file_set* const input_file_set = gt_input_file_set_allocate(mmap_files,sharded,true);
+  uint64_t i;
+  for (i=0;i<num_files;++i) {
+    GT_NULL_CHECK(file_names[i]);
+    char* const file_name = gt_malloc(strlen(file_names[i])+1);
+    strcpy(file_name,file_names[i]);
+    gt_input_file_set_add_file(input_file_set,file_name,NULL);
+  }
+  gt_input_file_set_open_first(input_file_set);
+  return input_file_set;
+}
+gt_input_file_set* gt_input_file_set_open_glob(char* const pattern,const bool mmap_files,const bool sharded) {
+  GT_NULL_CHECK(pattern);
+  gt_input_file_set* const input_file_set = gt_input_file_set_allocate(mmap_files,sharded,true);
+  // Expand each comma-separated pattern (names matching nothing are kept, so they fail on open)
+  const uint64_t pattern_length = strlen(pattern);
+  char* const patterns = gt_malloc(pattern_length+1);
+  strcpy(patterns,pattern);
+  char* current_pattern = patterns;
+  while (current_pattern < patterns+pattern_length) {
+    char* const separator = strchr(current_pattern,GT_INPUT_FILE_SET_SEPARATOR);
+    if (separator!=NULL) *separator = EOS;
+    if (*current_pattern!=EOS) {
+      glob_t glob_result;
+      gt_cond_fatal_error(glob(current_pattern,GLOB_NOCHECK,NULL,&glob_result)!=0,FILE_SET_GLOB,current_pattern);
+      uint64_t i;
+      for (i=0;i<glob_result.gl_pathc;++i) {
+        char* const file_name = gt_malloc(strlen(glob_result.gl_pathv[i])+1);
+        strcpy(file_name,glob_result.gl_pathv[i]);
+        gt_input_file_set_add_file(input_file_set,file_name,NULL);
+      }
+      globfree(&glob_result);
+    }
+    if (separator==NULL) break;
+    current_pattern = separator+1;
+  }
+  gt_free(patterns);
+  gt_input_file_set_open_first(input_file_set);
+  return input_file_set;
+}
+gt_input_file_set* gt_input_file_set_new(
+    gt_input_file** const input_files,const uint64_t num_files,const bool sharded) {
+  GT_NULL_CHECK(input_files);
+  gt_input_file_set* const input_file_set = gt_input_file_set_allocate(false,sharded,false);
+  uint64_t i;
+  for (i=0;i<num_files;++i) {
+    GT_INPUT_FILE_CHECK(input_files[i]);
+    gt_input_file_set_add_file(input_file_set,input_files[i]->file_name,input_files[i]);
+  }
+  gt_cond_fatal_error(num_files==0,FILE_SET_EMPTY);
+  input_file_set->file_format = input_files[0]->file_format;
+  return input_file_set;
+}
+void gt_input_file_set_close(gt_input_file_set* const input_file_set) {
+  GT_INPUT_FILE_SET_CHECK(input_file_set);
+  if (input_file_set->owned_files) {
+    GT_VECTOR_ITERATE(input_file_set->shards,shard,shard_num,gt_input_file_shard) {
+      if (shard->input_file!=NULL) gt_input_file_close(shard->input_file);
+      gt_free(shard->file_name);
+    }
+  } else {
+    GT_VECTOR_ITERATE(input_file_set->shards,shard,shard_num,gt_input_file_shard) {
+      shard->input_file->shared_processed_id = NULL;
+      shard->input_file->shared_mutex = NULL;
+    }
+  }
+  gt_vector_delete(input_file_set->shards);
+  gt_cond_error(pthread_mutex_destroy(&input_file_set->read_mutex),SYS_MUTEX_DESTROY);
+  gt_cond_error(pthread_mutex_destroy(&input_file_set->set_mutex),SYS_MUTEX_DESTROY);
+  gt_free(input_file_set);
+}
+
+/*
+ * Accessors
+ */
+GT_INLINE uint64_t gt_input_file_set_get_num_files(gt_input_file_set* const input_file_set) {
+  GT_INPUT_FILE_SET_CHECK(input_file_set);
+  return gt_vector_get_used(input_file_set->shards);
+}
+GT_INLINE gt_input_file* gt_input_file_set_get_file(gt_input_file_set* const input_file_set) {
+  GT_INPUT_FILE_SET_CHECK(input_file_set);
+  return gt_vector_get_elm(input_file_set->shards,0,gt_input_file_shard)->input_file;
+}
+GT_INLINE bool gt_input_file_set_is_pattern(char* const file_name) {
+  GT_NULL_CHECK(file_name);
+  return strpbrk(file_name,",*?[")!=NULL;
+}
+
+/*
+ * Readers (all with the set mutex held)
+ */
+GT_INLINE bool gt_input_file_set_shard_is_exhausted(gt_input_file_shard* const shard) {
+  if (!shard->exhausted && shard->input_file!=NULL && shard->input_file->eof) shard->exhausted = true;
+  return shard->exhausted;
+}
+GT_INLINE gt_input_file_shard* gt_input_file_set_select_shard(gt_input_file_set* const input_file_set) {
+  gt_input_file_shard* selected_shard = NULL;
+  GT_VECTOR_ITERATE(input_file_set->shards,shard,shard_num,gt_input_file_shard) {
+    if (gt_input_file_set_shard_is_exhausted(shard)) continue;
+    // Concatenated. First file not exhausted
+    if (!input_file_set->sharded) return shard;
+    // Sharded. First file with no readers (otherwise, the one with less readers)
+    if (shard->num_readers==0) return shard;
+    if (selected_shard==NULL || shard->num_readers < selected_shard->num_readers) selected_shard = shard;
+  }
+  return selected_shard;
+}
+GT_INLINE gt_input_file_shard* gt_input_file_set_get_shard(
+    gt_input_file_set* const input_file_set,gt_input_file* const input_file) {
+  GT_VECTOR_ITERATE(input_file_set->shards,shard,shard_num,gt_input_file_shard) {
+    if (shard->input_file==input_file) return shard;
+  }
+  gt_fatal_error(SELECTION_NOT_VALID);
+  return NULL;
+}
+GT_INLINE void gt_input_file_set_join_shard(gt_input_file_set* const input_file_set,gt_input_file_shard* const shard) {
+  if (shard->input_file==NULL) {
+    shard->input_file = gt_input_file_open(shard->file_name,input_file_set->mmap_files);
+    gt_input_file_set_attach_file(input_file_set,shard->input_file);
+    gt_cond_fatal_error(shard->input_file->file_format!=input_file_set->file_format,
+        FILE_SET_FORMAT,shard->file_name,gt_vector_get_elm(input_file_set->shards,0,gt_input_file_shard)->file_name);
+  }
+  ++(shard->num_readers);
+}
+GT_INLINE void gt_input_file_set_leave_shard(gt_input_file_set* const input_file_set,gt_input_file_shard* const shard) {
+  --(shard->num_readers);
+  // Close exhausted files as soon as possible (but the first one, which describes the set)
+  if (input_file_set->owned_files && shard->num_readers==0 &&
+      gt_input_file_set_shard_is_exhausted(shard) &&
+      shard!=gt_vector_get_elm(input_file_set->shards,0,gt_input_file_shard)) {
+    gt_input_file_close(shard->input_file);
+    shard->input_file = NULL;
+  }
+}
+GT_INLINE gt_input_file* gt_input_file_set_acquire(gt_input_file_set* const input_file_set) {
+  GT_INPUT_FILE_SET_CHECK(input_file_set);
+  gt_input_file* input_file;
+  GT_BEGIN_MUTEX_SECTION(input_file_set->set_mutex) {
+    gt_input_file_shard* shard = gt_input_file_set_select_shard(input_file_set);
+    if (shard==NULL) shard = gt_vector_get_elm(input_file_set->shards,0,gt_input_file_shard); // All exhausted
+    gt_input_file_set_join_shard(input_file_set,shard);
+    input_file = shard->input_file;
+  } GT_END_MUTEX_SECTION(input_file_set->set_mutex);
+  return input_file;
+}
+GT_INLINE gt_input_file* gt_input_file_set_next(gt_input_file_set* const input_file_set,gt_input_file* const input_file) {
+  GT_INPUT_FILE_SET_CHECK(input_file_set);
+  GT_INPUT_FILE_CHECK(input_file);
+  gt_input_file* next_input_file = NULL;
+  GT_BEGIN_MUTEX_SECTION(input_file_set->set_mutex) {
+    gt_input_file_shard* const current_shard = gt_input_file_set_get_shard(input_file_set,input_file);
+    gt_input_file_shard* const next_shard = gt_input_file_set_select_shard(input_file_set);
+    if (next_shard!=NULL && next_shard!=current_shard) {
+      gt_input_file_set_join_shard(input_file_set,next_shard);
+      gt_input_file_set_leave_shard(input_file_set,current_shard);
+      next_input_file = next_shard->input_file;
+    }
+  } GT_END_MUTEX_SECTION(input_file_set->set_mutex);
+  return next_input_file;
+}
+GT_INLINE void gt_input_file_set_release(gt_input_file_set* const input_file_set,gt_input_file* const input_file) {
+  GT_INPUT_FILE_SET_CHECK(input_file_set);
+  GT_INPUT_FILE_CHECK(input_file);
+  GT_BEGIN_MUTEX_SECTION(input_file_set->set_mutex) {
+    gt_input_file_set_leave_shard(input_file_set,gt_input_file_set_get_shard(input_file_set,input_file));
+  } GT_END_MUTEX_SECTION(input_file_set->set_mutex);
+}
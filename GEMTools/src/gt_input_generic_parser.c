@@ -3,7 +3,7 @@
  * FILE: gt_input_generic_parser.c
  * DATE: 28/01/2013
  * AUTHOR(S): Santiago Marco-Sola <santiagomsola@gmail.com>
- * DESCRIPTION: Generic parser for {MAP,SAM,FASTQ}
+ * DESCRIPTION: Generic parser for {MAP,SAM,BAM,GTB,FASTQ}
  */
 
 #include "gt_input_generic_parser.h"
@@ -53,6 +53,12 @@ GT_INLINE gt_status gt_input_generic_parser_get_alignment(
     case SAM:
       return gt_input_sam_parser_get_alignment(buffered_input,alignment,attributes->sam_parser_attributes);
       break;
+    case BAM:
+      return gt_input_bam_parser_get_alignment(buffered_input,alignment);
+      break;
+    case GTB:
+      return gt_input_gtb_parser_get_alignment(buffered_input,alignment,attributes->map_parser_attributes);
+      break;
     case FASTA:
       return gt_input_fasta_parser_get_alignment(buffered_input,alignment);
       break;
@@ -78,6 +84,19 @@ GT_INLINE gt_status gt_input_generic_parser_get_template(
             buffered_input,gt_template_get_block_dyn(template,0),attributes->sam_parser_attributes);
       }
       break;
+    case BAM:
+      if (gt_input_generic_parser_attributes_is_paired(attributes)) {
+        error_code = gt_input_bam_parser_get_template(buffered_input,template);
+        gt_template_get_block_dyn(template,0);
+        gt_template_get_block_dyn(template,1); // Make sure is a template
+        return error_code;
+      } else {
+        return gt_input_bam_parser_get_alignment(buffered_input,gt_template_get_block_dyn(template,0));
+      }
+      break;
+    case GTB:
+      return gt_input_gtb_parser_get_template(buffered_input,template,attributes->map_parser_attributes);
+      break;
     case FASTA:
       return gt_input_fasta_parser_get_template(buffered_input,template,gt_input_generic_parser_attributes_is_paired(attributes));
       break;
@@ -102,6 +121,8 @@ GT_INLINE gt_status gt_input_generic_parser_synch_blocks_v(
       return gt_input_map_parser_synch_blocks_v(input_mutex,attributes->map_parser_attributes,num_inputs,buffered_input,v_args);
       break;
     case SAM:
+    case BAM:
+    case GTB:
       gt_fatal_error(SELECTION_NOT_IMPLEMENTED);
       break;
     case FASTA:
@@ -135,6 +156,8 @@ GT_INLINE gt_status gt_input_generic_parser_synch_blocks_a(
       return gt_input_map_parser_synch_blocks_a(input_mutex,buffered_input,num_inputs,attributes->map_parser_attributes);
       break;
     case SAM:
+    case BAM:
+    case GTB:
       gt_fatal_error(SELECTION_NOT_IMPLEMENTED);
       break;
     case FASTA:
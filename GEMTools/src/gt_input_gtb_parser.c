@@ -0,0 +1,498 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_input_gtb_parser.c
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Input parser for GTB format
+ */
+
+#include "gt_input_gtb_parser.h"
+
+#define GT_IGTB_NUM_INITIAL_CONTIGS 100
+
+/*
+ * Map allocation (from the arena of the parser, if any)
+ */
+#define gt_igtb_map_new(map_parser_attr) \
+  (((map_parser_attr)->map_arena!=NULL) ? gt_map_arena_alloc((map_parser_attr)->map_arena) : gt_map_new())
+
+/*
+ * Decoding building blocks (fail on data running past @end)
+ */
+#define gt_igtb_unzigzag(value) ((int64_t)((value)>>1) ^ -(int64_t)((value)&1))
+GT_INLINE uint32_t gt_igtb_get_uint32(const uint8_t* const mem) {
+  return (uint32_t)mem[0] | ((uint32_t)mem[1]<<8) | ((uint32_t)mem[2]<<16) | ((uint32_t)mem[3]<<24);
+}
+GT_INLINE bool gt_igtb_read_varint(const uint8_t** const data,const uint8_t* const end,uint64_t* const value) {
+  const uint8_t* mem = *data;
+  uint64_t result = 0, shift = 0;
+  while (mem<end && shift<64) {
+    const uint8_t byte = *(mem++);
+    result |= (uint64_t)(byte&0x7F)<<shift;
+    if (!(byte&0x80)) {
+      *data = mem;
+      *value = result;
+      return true;
+    }
+    shift += 7;
+  }
+  return false;
+}
+#define GT_IGTB_READ_VARINT(data,end,value) \
+  if (gt_expect_false(!gt_igtb_read_varint(data,end,&(value)))) return GT_IGTB_PE_CORRUPTED_RECORD
+#define GT_IGTB_READ_BYTE(data,end,value) \
+  if (gt_expect_false(*(data)>=(end))) return GT_IGTB_PE_CORRUPTED_RECORD; \
+  value = *((*(data))++)
+#define GT_IGTB_CHECK_LENGTH(data,end,length) \
+  if (gt_expect_false((uint64_t)((end)-*(data))<(length))) return GT_IGTB_PE_CORRUPTED_RECORD
+
+/*
+ * GTB File Format test
+ */
+GT_INLINE bool gt_input_file_test_gtb(gt_input_file* const input_file,const bool show_errors) {
+  GT_INPUT_FILE_CHECK(input_file);
+  const uint8_t* const buffer = input_file->file_buffer;
+  const uint64_t buffer_size = input_file->buffer_size;
+  // The version is checked as blocks are read
+  return buffer_size>=GT_GTB_BLOCK_HEADER_SIZE && memcmp(buffer,GT_GTB_MAGIC,GT_GTB_MAGIC_LENGTH)==0;
+}
+
+/*
+ * GTB File basics
+ */
+/* Error handler */
+GT_INLINE void gt_input_gtb_parser_prompt_error(
+    gt_buffered_input_file* const buffered_gtb_input,const uint64_t record_num,const gt_status error_code) {
+  // Display textual error msg
+  const char* const file_name = buffered_gtb_input->input_file->file_name;
+  switch (error_code) {
+    case 0: /* No error */ break;
+    case GT_IGTB_PE_WRONG_FILE_FORMAT: gt_error(PARSE_GTB_BAD_FILE_FORMAT,file_name,record_num); break;
+    case GT_IGTB_PE_BAD_VERSION: gt_error(PARSE_GTB_BAD_VERSION,file_name,record_num); break;
+    case GT_IGTB_PE_TRUNCATED_BLOCK: gt_error(PARSE_GTB_TRUNCATED_BLOCK,file_name,record_num); break;
+    case GT_IGTB_PE_CORRUPTED_BLOCK: gt_error(PARSE_GTB_CORRUPTED_BLOCK,file_name,record_num); break;
+    case GT_IGTB_PE_CORRUPTED_RECORD: gt_error(PARSE_GTB_CORRUPTED_RECORD,file_name,record_num); break;
+    case GT_IGTB_PE_BAD_CONTIG: gt_error(PARSE_GTB_BAD_CONTIG,file_name,record_num); break;
+    case GT_IGTB_PE_NOT_SE: gt_error(PARSE_GTB_NOT_SE,file_name,record_num); break;
+    default:
+      gt_error(PARSE_GTB,file_name,record_num);
+      break;
+  }
+}
+/* GTB file. Locate the next template record (skipping contig definitions; the block is already validated) */
+GT_INLINE void gt_igtb_next_entry(
+    gt_buffered_input_file* const buffered_gtb_input,const uint8_t** const record,const uint8_t** const record_end) {
+  const uint8_t* data = (const uint8_t*)buffered_gtb_input->cursor;
+  const uint8_t* const end = gt_vector_get_mem(buffered_gtb_input->block_buffer,uint8_t)+
+      gt_vector_get_used(buffered_gtb_input->block_buffer);
+  uint64_t entry;
+  while (gt_igtb_read_varint(&data,end,&entry)) {
+    if ((entry&1)==GT_GTB_ENTRY_TEMPLATE) {
+      *record = data;
+      *record_end = data+(entry>>1);
+      return;
+    }
+    data += entry>>1;
+  }
+  *record = end;
+  *record_end = end;
+}
+/* GTB file. Skip record */
+GT_INLINE void gt_input_gtb_parser_next_record(gt_buffered_input_file* const buffered_gtb_input) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_gtb_input);
+  if (!gt_buffered_input_file_eob(buffered_gtb_input)) {
+    const uint8_t *record, *record_end;
+    gt_igtb_next_entry(buffered_gtb_input,&record,&record_end);
+    buffered_gtb_input->cursor = (char*)record_end;
+    ++buffered_gtb_input->current_line_num;
+  }
+}
+
+/*
+ * GTB file. Reload internal buffer
+ */
+/* GTB file. Check the framing of the block and intern the contigs it defines */
+GT_INLINE gt_status gt_input_gtb_parser_setup_block(
+    gt_buffered_input_file* const buffered_gtb_input,const uint64_t num_templates) {
+  if (buffered_gtb_input->block_seq_name_ids==NULL) {
+    buffered_gtb_input->block_seq_name_ids = gt_vector_new(GT_IGTB_NUM_INITIAL_CONTIGS,sizeof(uint32_t));
+  }
+  gt_vector* const seq_name_ids = buffered_gtb_input->block_seq_name_ids;
+  gt_vector_clear(seq_name_ids);
+  const uint8_t* data = gt_vector_get_mem(buffered_gtb_input->block_buffer,uint8_t)+GT_GTB_BLOCK_HEADER_SIZE;
+  const uint8_t* const end = gt_vector_get_mem(buffered_gtb_input->block_buffer,uint8_t)+
+      gt_vector_get_used(buffered_gtb_input->block_buffer);
+  uint64_t entry, templates_found = 0;
+  while (data<end) {
+    if (!gt_igtb_read_varint(&data,end,&entry)) return GT_IGTB_PE_CORRUPTED_BLOCK;
+    const uint64_t entry_length = entry>>1;
+    if (entry_length>(uint64_t)(end-data)) return GT_IGTB_PE_CORRUPTED_BLOCK;
+    if ((entry&1)==GT_GTB_ENTRY_CONTIG) {
+      const uint32_t seq_name_id = gt_seq_name_intern((const char*)data,entry_length);
+      gt_vector_insert(seq_name_ids,seq_name_id,uint32_t);
+    } else {
+      ++templates_found;
+    }
+    data += entry_length;
+  }
+  return (templates_found==num_templates) ? GT_IGTB_OK : GT_IGTB_PE_CORRUPTED_BLOCK;
+}
+/* GTB file. Get block (one GTB block) */
+GT_INLINE gt_status gt_input_gtb_parser_get_block(gt_buffered_input_file* const buffered_gtb_input) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_gtb_input);
+  gt_input_file* const input_file = buffered_gtb_input->input_file;
+  gt_vector* const block_buffer = buffered_gtb_input->block_buffer;
+  gt_input_file_lock(input_file);
+  if (input_file->eof) {
+    gt_input_file_unlock(input_file);
+    return GT_IGTB_EOF;
+  }
+  buffered_gtb_input->current_line_num = input_file->processed_lines+1;
+  gt_vector_clear(block_buffer); // Clear dst buffer
+  // Read the header & the payload
+  gt_status error_code = GT_IGTB_OK;
+  uint64_t num_templates = 0;
+  const uint64_t header_bytes = gt_input_file_add_bytes(input_file,block_buffer,GT_GTB_BLOCK_HEADER_SIZE);
+  if (header_bytes==0) {
+    error_code = GT_IGTB_EOF;
+  } else if (header_bytes<GT_GTB_BLOCK_HEADER_SIZE) {
+    error_code = GT_IGTB_PE_TRUNCATED_BLOCK;
+  } else {
+    const uint8_t* const header = gt_vector_get_mem(block_buffer,uint8_t);
+    if (memcmp(header,GT_GTB_MAGIC,GT_GTB_MAGIC_LENGTH)!=0) {
+      error_code = GT_IGTB_PE_WRONG_FILE_FORMAT;
+    } else if (header[GT_GTB_MAGIC_LENGTH]!=GT_GTB_VERSION) {
+      error_code = GT_IGTB_PE_BAD_VERSION;
+    } else {
+      const uint32_t payload_size = gt_igtb_get_uint32(header+GT_GTB_BLOCK_PAYLOAD_SIZE);
+      num_templates = gt_igtb_get_uint32(header+GT_GTB_BLOCK_NUM_TEMPLATES);
+      if (gt_input_file_add_bytes(input_file,block_buffer,payload_size)<payload_size) {
+        error_code = GT_IGTB_PE_TRUNCATED_BLOCK;
+      }
+    }
+  }
+  if (error_code!=GT_IGTB_OK) {
+    // Broken block framing. Nothing else can be read
+    if (error_code!=GT_IGTB_EOF) gt_input_gtb_parser_prompt_error(buffered_gtb_input,input_file->processed_lines+1,error_code);
+    gt_vector_clear(block_buffer);
+    input_file->eof = true;
+    num_templates = 0;
+  }
+  input_file->processed_lines+=num_templates;
+  buffered_gtb_input->lines_in_buffer = num_templates;
+  if (num_templates>0) buffered_gtb_input->block_id = gt_input_file_next_id(input_file) % UINT32_MAX;
+  gt_input_file_unlock(input_file);
+
+  // Setup the block
+  if (error_code==GT_IGTB_OK) {
+    if ((error_code=gt_input_gtb_parser_setup_block(buffered_gtb_input,num_templates))!=GT_IGTB_OK) {
+      gt_input_gtb_parser_prompt_error(buffered_gtb_input,buffered_gtb_input->current_line_num,error_code);
+      gt_vector_clear(block_buffer); // Skip the block
+    }
+  }
+  buffered_gtb_input->cursor = gt_vector_get_mem(block_buffer,char)+
+      GT_MIN(gt_vector_get_used(block_buffer),GT_GTB_BLOCK_HEADER_SIZE);
+  gt_buffered_input_file_block_read(buffered_gtb_input);
+  return error_code;
+}
+/* GTB file. Reload internal buffer */
+GT_INLINE gt_status gt_input_gtb_parser_reload_buffer(gt_buffered_input_file* const buffered_gtb_input) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_gtb_input);
+  // Dump buffer if BOF it attached to GTB-input, and get new out block (always FIRST)
+  gt_buffered_input_file_dump_attached_buffers(buffered_gtb_input->attached_buffered_output_file);
+  // Read new input block (from the next file of the set, if any, once exhausted)
+  gt_status error_code;
+  do {
+    error_code = gt_input_gtb_parser_get_block(buffered_gtb_input);
+    if (error_code==GT_IGTB_EOF && !gt_buffered_input_file_next_input(buffered_gtb_input)) return GT_IGTB_EOF;
+  } while (gt_buffered_input_file_eob(buffered_gtb_input));
+  // Assign block ID
+  gt_buffered_input_file_set_id_attached_buffers(buffered_gtb_input->attached_buffered_output_file,buffered_gtb_input->block_id);
+  return GT_IGTB_OK;
+}
+
+/*
+ * GTB format. Basic building blocks for parsing
+ */
+GT_INLINE gt_status gt_igtb_parse_string(
+    const uint8_t** const data,const uint8_t* const end,gt_string* const string,const bool read_view) {
+  uint64_t length;
+  GT_IGTB_READ_VARINT(data,end,length);
+  GT_IGTB_CHECK_LENGTH(data,end,length);
+  // Copy string (or just reference it)
+  if (read_view) {
+    gt_string_set_view(string,(const char*)*data,length);
+  } else if (length>0) {
+    gt_string_set_nstring_static(string,(const char*)*data,length);
+  }
+  *data += length;
+  return 0;
+}
+GT_INLINE gt_status gt_igtb_parse_map(
+    const uint8_t** const data,const uint8_t* const end,gt_vector* const seq_name_ids,
+    uint64_t* const last_position,gt_map** const map,gt_map_parser_attributes* const map_parser_attr) {
+  gt_map *map_block = NULL;
+  gt_junction_t junction = NO_JUNCTION;
+  int64_t junction_size = 0;
+  *map = NULL;
+  while (true) {
+    // Allocate (chained right away, as to be deleted with the head on error)
+    gt_map* const next_map_block = gt_igtb_map_new(map_parser_attr);
+    if (map_block==NULL) {
+      *map = next_map_block;
+    } else {
+      gt_map_set_next_block(map_block,next_map_block,junction,junction_size);
+    }
+    map_block = next_map_block;
+    // Location
+    uint64_t contig_id, flags, position_delta, base_length, gt_score;
+    GT_IGTB_READ_VARINT(data,end,contig_id);
+    if (gt_expect_false(contig_id>=gt_vector_get_used(seq_name_ids))) return GT_IGTB_PE_BAD_CONTIG;
+    gt_map_set_seq_name_id(map_block,*gt_vector_get_elm(seq_name_ids,contig_id,uint32_t));
+    GT_IGTB_READ_BYTE(data,end,flags);
+    if (gt_expect_false((flags&GT_GTB_MAP_STRAND_MASK)>UNKNOWN)) return GT_IGTB_PE_CORRUPTED_RECORD;
+    gt_map_set_strand(map_block,flags&GT_GTB_MAP_STRAND_MASK);
+    GT_IGTB_READ_VARINT(data,end,position_delta);
+    *last_position += gt_igtb_unzigzag(position_delta);
+    gt_map_set_position(map_block,*last_position);
+    GT_IGTB_READ_VARINT(data,end,base_length);
+    gt_map_set_base_length(map_block,base_length);
+    // Scores
+    GT_IGTB_READ_VARINT(data,end,gt_score);
+    map_block->gt_score = (gt_score==GT_GTB_NONE) ? GT_MAP_NO_GT_SCORE : gt_score-1;
+    GT_IGTB_READ_BYTE(data,end,map_block->phred_score);
+    // Mismatches
+    uint64_t num_misms, i, last_misms_position = 0;
+    GT_IGTB_READ_VARINT(data,end,num_misms);
+    GT_IGTB_CHECK_LENGTH(data,end,2*num_misms);
+    for (i=0;i<num_misms;++i) {
+      uint64_t misms_code, misms_size;
+      gt_misms misms;
+      GT_IGTB_READ_VARINT(data,end,misms_code);
+      misms.misms_type = misms_code&3;
+      last_misms_position += gt_igtb_unzigzag(misms_code>>2);
+      misms.position = last_misms_position;
+      switch (misms.misms_type) {
+        case MISMS: GT_IGTB_READ_BYTE(data,end,misms.base); break;
+        case INS:
+        case DEL: GT_IGTB_READ_VARINT(data,end,misms_size); misms.size = misms_size; break;
+        default: return GT_IGTB_PE_CORRUPTED_RECORD;
+      }
+      gt_map_add_misms(map_block,&misms);
+    }
+    // Next block
+    if (!(flags&GT_GTB_MAP_HAS_NEXT)) return 0;
+    uint64_t junction_code;
+    junction = (flags>>GT_GTB_MAP_JUNCTION_SHIFT);
+    if (gt_expect_false(junction>QUIMERA)) return GT_IGTB_PE_CORRUPTED_RECORD;
+    GT_IGTB_READ_VARINT(data,end,junction_code);
+    junction_size = gt_igtb_unzigzag(junction_code);
+  }
+}
+#define GT_IGTB_PARSE_MAP(data,end,seq_name_ids,last_position,map,map_parser_attr) \
+  if (gt_expect_false((error_code=gt_igtb_parse_map(data,end,seq_name_ids,last_position,&(map),map_parser_attr)))) { \
+    if (map!=NULL) gt_map_delete(map); \
+    return error_code; \
+  }
+/*
+ * GTB record (see the layout in gt_input_gtb_parser.h)
+ *   Decoded into @template, or into @alignment (SE) if not NULL
+ */
+GT_INLINE gt_status gt_igtb_parse_record(
+    const uint8_t** const data,const uint8_t* const end,gt_vector* const seq_name_ids,
+    gt_template* const template,gt_alignment* const alignment,gt_map_parser_attributes* const map_parser_attr) {
+  gt_status error_code;
+  // Blocks
+  uint64_t num_blocks;
+  GT_IGTB_READ_VARINT(data,end,num_blocks);
+  if (alignment!=NULL && num_blocks!=1) return GT_IGTB_PE_NOT_SE;
+  if (num_blocks>2) return GT_IGTB_PE_CORRUPTED_RECORD;
+  #define gt_igtb_get_block(block_num) ((alignment!=NULL) ? alignment : gt_template_get_block_dyn(template,block_num))
+  // TAG
+  uint64_t tag_length, block_num;
+  GT_IGTB_READ_VARINT(data,end,tag_length);
+  GT_IGTB_CHECK_LENGTH(data,end,tag_length);
+  if (tag_length==0 || (*data)[tag_length-1]!=TAB) return GT_IGTB_PE_CORRUPTED_RECORD;
+  const char* tag = (const char*)*data;
+  if (alignment!=NULL) {
+    gt_input_parse_tag(&tag,alignment->tag,alignment->attributes);
+  } else {
+    gt_input_parse_tag(&tag,template->tag,template->attributes);
+  }
+  *data += tag_length;
+  // READ/QUALITIES
+  for (block_num=0;block_num<num_blocks;++block_num) {
+    gt_alignment* const block = gt_igtb_get_block(block_num);
+    if ((error_code=gt_igtb_parse_string(data,end,block->read,map_parser_attr->read_views))) return error_code;
+    if ((error_code=gt_igtb_parse_string(data,end,block->qualities,map_parser_attr->read_views))) return error_code;
+  }
+  // TAG Setup (Pair information based on template pair and num_blocks)
+  if (alignment==NULL && num_blocks>0) gt_template_setup_pair_attributes_to_alignments(template,true);
+  // COUNTERS
+  const bool is_template = (alignment==NULL && num_blocks!=1);
+  gt_alignment* const se_alignment = (is_template) ? NULL : gt_igtb_get_block(0);
+  gt_vector* const counters = (is_template) ?
+      gt_template_get_counters_vector(template) : gt_alignment_get_counters_vector(se_alignment);
+  uint64_t flags, mcs, num_counters, i;
+  GT_IGTB_READ_VARINT(data,end,flags);
+  GT_IGTB_READ_VARINT(data,end,mcs);
+  GT_IGTB_READ_VARINT(data,end,num_counters);
+  GT_IGTB_CHECK_LENGTH(data,end,num_counters);
+  gt_vector_clear(counters);
+  gt_vector_reserve(counters,num_counters,false);
+  for (i=0;i<num_counters;++i) {
+    uint64_t counter;
+    GT_IGTB_READ_VARINT(data,end,counter);
+    gt_vector_insert(counters,counter,uint64_t);
+  }
+  if (is_template) {
+    if (flags&GT_GTB_RECORD_NOT_UNIQUE) gt_template_set_not_unique_flag(template,true);
+    if (mcs!=GT_GTB_NONE) gt_template_set_mcs(template,mcs-1);
+  } else {
+    if (flags&GT_GTB_RECORD_NOT_UNIQUE) gt_alignment_set_not_unique_flag(se_alignment,true);
+    if (mcs!=GT_GTB_NONE) gt_alignment_set_mcs(se_alignment,mcs-1);
+  }
+  // MAPS
+  uint64_t last_position = 0;
+  for (block_num=0;block_num<num_blocks;++block_num) {
+    gt_alignment* const block = gt_igtb_get_block(block_num);
+    uint64_t num_maps;
+    GT_IGTB_READ_VARINT(data,end,num_maps);
+    GT_IGTB_CHECK_LENGTH(data,end,num_maps);
+    for (i=0;i<num_maps;++i) {
+      gt_map* map;
+      GT_IGTB_PARSE_MAP(data,end,seq_name_ids,&last_position,map,map_parser_attr);
+      gt_alignment_add_map(block,map);
+    }
+  }
+  // MMAPS
+  if (is_template && num_blocks>1) {
+    uint64_t num_mmaps;
+    GT_IGTB_READ_VARINT(data,end,num_mmaps);
+    GT_IGTB_CHECK_LENGTH(data,end,num_mmaps);
+    for (i=0;i<num_mmaps;++i) {
+      gt_map* mmap[2] = {NULL,NULL};
+      for (block_num=0;block_num<num_blocks;++block_num) {
+        gt_alignment* const block = gt_template_get_block(template,block_num);
+        uint64_t end_ref;
+        GT_IGTB_READ_VARINT(data,end,end_ref);
+        if (end_ref==GT_GTB_MMAP_END_INLINE) {
+          // Not listed among the maps of the end (added, as to keep one owner)
+          GT_IGTB_PARSE_MAP(data,end,seq_name_ids,&last_position,mmap[block_num],map_parser_attr);
+          gt_alignment_add_map(block,mmap[block_num]);
+        } else if (end_ref>=GT_GTB_MMAP_END_MAP) {
+          if (end_ref-GT_GTB_MMAP_END_MAP>=gt_alignment_get_num_maps(block)) return GT_IGTB_PE_CORRUPTED_RECORD;
+          mmap[block_num] = gt_alignment_get_map(block,end_ref-GT_GTB_MMAP_END_MAP);
+        }
+      }
+      gt_mmap_attributes mmap_attributes;
+      uint64_t distance, gt_score;
+      GT_IGTB_READ_VARINT(data,end,distance);
+      GT_IGTB_READ_VARINT(data,end,gt_score);
+      mmap_attributes.distance = distance;
+      mmap_attributes.gt_score = (gt_score==GT_GTB_NONE) ? GT_MAP_NO_GT_SCORE : gt_score-1;
+      GT_IGTB_READ_BYTE(data,end,mmap_attributes.phred_score);
+      gt_template_add_mmap_array(template,mmap,&mmap_attributes);
+    }
+  }
+  #undef gt_igtb_get_block
+  return (*data==end) ? 0 : GT_IGTB_PE_CORRUPTED_RECORD;
+}
+GT_INLINE gt_status gt_input_gtb_parser_parse_record(
+    gt_buffered_input_file* const buffered_gtb_input,
+    gt_template* const template,gt_alignment* const alignment,gt_map_parser_attributes* const map_parser_attr) {
+  // Locate the record & move to the next one (before decoding, as to skip it on error)
+  const uint8_t *record, *record_end;
+  gt_igtb_next_entry(buffered_gtb_input,&record,&record_end);
+  buffered_gtb_input->cursor = (char*)record_end;
+  ++buffered_gtb_input->current_line_num;
+  return gt_igtb_parse_record(&record,record_end,
+      buffered_gtb_input->block_seq_name_ids,template,alignment,map_parser_attr);
+}
+
+/*
+ * High Level Parsers
+ */
+GT_INLINE gt_status gt_igtb_get_template(
+    gt_buffered_input_file* const buffered_gtb_input,gt_template* const template,gt_map_parser_attributes* const map_parser_attr) {
+  gt_status error_code;
+  // Check the end_of_block. Reload buffer if needed
+  if (gt_buffered_input_file_eob(buffered_gtb_input)) {
+    if ((error_code=gt_input_gtb_parser_reload_buffer(buffered_gtb_input))!=GT_IGTB_OK) return error_code;
+  }
+  // Prepare the template
+  const uint64_t record_num = buffered_gtb_input->current_line_num;
+  gt_template_clear(template,true);
+  template->template_id = record_num;
+  // Parse template
+  if ((error_code=gt_input_gtb_parser_parse_record(buffered_gtb_input,template,NULL,map_parser_attr))) {
+    gt_input_gtb_parser_prompt_error(buffered_gtb_input,record_num,error_code);
+    return GT_IGTB_FAIL;
+  }
+  return GT_IGTB_OK;
+}
+GT_INLINE gt_status gt_igtb_get_alignment(
+    gt_buffered_input_file* const buffered_gtb_input,gt_alignment* const alignment,gt_map_parser_attributes* const map_parser_attr) {
+  gt_status error_code;
+  // Check the end_of_block. Reload buffer if needed
+  if (gt_buffered_input_file_eob(buffered_gtb_input)) {
+    if ((error_code=gt_input_gtb_parser_reload_buffer(buffered_gtb_input))!=GT_IGTB_OK) return error_code;
+  }
+  // Prepare the alignment
+  const uint64_t record_num = buffered_gtb_input->current_line_num;
+  gt_alignment_clear(alignment);
+  alignment->alignment_id = record_num;
+  // Parse alignment
+  if ((error_code=gt_input_gtb_parser_parse_record(buffered_gtb_input,NULL,alignment,map_parser_attr))) {
+    gt_input_gtb_parser_prompt_error(buffered_gtb_input,record_num,error_code);
+    return GT_IGTB_FAIL;
+  }
+  return GT_IGTB_OK;
+}
+GT_INLINE gt_status gt_input_gtb_parser_get_template(
+    gt_buffered_input_file* const buffered_gtb_input,gt_template* const template,gt_map_parser_attributes* map_parser_attr) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_gtb_input);
+  GT_TEMPLATE_CHECK(template);
+  GT_MAP_PARSER_CHECK_ATTRIBUTES(map_parser_attr);
+  gt_status error_code;
+  // Check file format
+  gt_input_file* const input_file = buffered_gtb_input->input_file;
+  if (gt_expect_false(input_file->file_format!=GTB)) {
+    gt_error(PARSE_GTB_BAD_FILE_FORMAT,input_file->file_name,buffered_gtb_input->current_line_num);
+    return GT_IGTB_FAIL;
+  }
+  // Recycle the maps of the previous record (the template is cleared before any map is taken)
+  if (map_parser_attr->map_arena!=NULL) gt_map_arena_clear(map_parser_attr->map_arena);
+  if ((error_code=gt_igtb_get_template(buffered_gtb_input,template,map_parser_attr))!=GT_IGTB_OK) return error_code;
+  if (gt_template_get_num_blocks(template)==1 && map_parser_attr->force_read_paired) {
+    if (map_parser_attr->read_views && gt_buffered_input_file_eob(buffered_gtb_input)) { // End/2 reloads the buffer
+      gt_alignment* const end1 = gt_template_get_block(template,0);
+      gt_string_unview(end1->read);
+      gt_string_unview(end1->qualities);
+    }
+    if ((error_code=gt_igtb_get_alignment(buffered_gtb_input,gt_template_get_block_dyn(template,1),map_parser_attr))!=GT_IGTB_OK) {
+      return GT_IGTB_FAIL;
+    }
+    // Check TAG consistency
+    gt_alignment* const end1 = gt_template_get_block(template,0);
+    gt_alignment* const end2 = gt_template_get_block(template,1);
+    if (!gt_string_equals(end1->tag,end2->tag)) return GT_IGTB_FAIL;
+    // TAG Setup
+    gt_template_setup_pair_attributes_to_alignments(template,false);
+  }
+  return GT_IGTB_OK;
+}
+GT_INLINE gt_status gt_input_gtb_parser_get_alignment(
+    gt_buffered_input_file* const buffered_gtb_input,gt_alignment* const alignment,gt_map_parser_attributes* map_parser_attr) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_gtb_input);
+  GT_ALIGNMENT_CHECK(alignment);
+  GT_MAP_PARSER_CHECK_ATTRIBUTES(map_parser_attr);
+  // Check file format
+  gt_input_file* const input_file = buffered_gtb_input->input_file;
+  if (gt_expect_false(input_file->file_format!=GTB)) {
+    gt_error(PARSE_GTB_BAD_FILE_FORMAT,input_file->file_name,buffered_gtb_input->current_line_num);
+    return GT_IGTB_FAIL;
+  }
+  if (map_parser_attr->map_arena!=NULL) gt_map_arena_clear(map_parser_attr->map_arena);
+  return gt_igtb_get_alignment(buffered_gtb_input,alignment,map_parser_attr);
+}
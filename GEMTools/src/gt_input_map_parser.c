@@ -21,6 +21,12 @@
 #define gt_is_valid_counter_separator(character) \
   (character=='+' || character==':' || character=='x')
 
+/*
+ * Map allocation (from the arena of the parser, if any)
+ */
+#define gt_imp_map_new(map_parser_attr) \
+  (((map_parser_attr)->map_arena!=NULL) ? gt_map_arena_alloc((map_parser_attr)->map_arena) : gt_map_new())
+
 /*
  * Map Parser Attributes
  */
@@ -41,6 +47,9 @@ GT_INLINE void gt_input_map_parser_attributes_reset_defaults(gt_map_parser_attri
   attributes->src_text = NULL;
   attributes->skip_based_model=false;
   attributes->remove_duplicates=false;
+  attributes->lazy_maps=false;
+  attributes->map_arena = NULL;
+  attributes->read_views = false;
 }
 GT_INLINE bool gt_input_map_parser_attributes_is_paired(gt_map_parser_attributes* const attributes) {
   GT_NULL_CHECK(attributes);
@@ -66,6 +75,18 @@ GT_INLINE void gt_input_map_parser_attributes_set_duplicates_removal(gt_map_pars
   GT_NULL_CHECK(attributes);
   attributes->remove_duplicates = remove_duplicates;
 }
+GT_INLINE void gt_input_map_parser_attributes_set_map_arena(gt_map_parser_attributes* const attributes,gt_map_arena* const map_arena) {
+  GT_NULL_CHECK(attributes);
+  attributes->map_arena = map_arena;
+}
+GT_INLINE void gt_input_map_parser_attributes_set_read_views(gt_map_parser_attributes* const attributes,const bool read_views) {
+  GT_NULL_CHECK(attributes);
+  attributes->read_views = read_views;
+}
+GT_INLINE void gt_input_map_parser_attributes_set_lazy_maps(gt_map_parser_attributes* const attributes,const bool lazy_maps) {
+  GT_NULL_CHECK(attributes);
+  attributes->lazy_maps = lazy_maps;
+}
 
 /*
  * MAP File Format test
@@ -183,13 +204,11 @@ GT_INLINE gt_status gt_input_map_parser_check_map_file_format(gt_buffered_input_
  * MAP File basics
  */
 /* Error handler */
-GT_INLINE void gt_input_map_parser_prompt_error(
-    gt_buffered_input_file* const buffered_map_input,
-    uint64_t line_num,uint64_t column_pos,const gt_status error_code) {
+GT_INLINE void gt_imp_prompt_error(
+    const char* file_name,uint64_t line_num,uint64_t column_pos,const gt_status error_code) {
   // Display textual error msg
-  const char* const file_name = (buffered_map_input != NULL) ?
-      buffered_map_input->input_file->file_name : "<<LazyParsing>>";
-  if ((buffered_map_input == NULL)) {
+  if (file_name == NULL) {
+    file_name = "<<LazyParsing>>";
     line_num = 0; column_pos = 0;
   }
   switch (error_code) {
@@ -219,6 +238,12 @@ GT_INLINE void gt_input_map_parser_prompt_error(
       break;
   }
 }
+GT_INLINE void gt_input_map_parser_prompt_error(
+    gt_buffered_input_file* const buffered_map_input,
+    uint64_t line_num,uint64_t column_pos,const gt_status error_code) {
+  gt_imp_prompt_error((buffered_map_input!=NULL) ? buffered_map_input->input_file->file_name : NULL,
+      line_num,column_pos,error_code);
+}
 /* MAP file. Skip record */
 GT_INLINE void gt_input_map_parser_next_record(gt_buffered_input_file* const buffered_map_input) {
   GT_BUFFERED_INPUT_FILE_CHECK(buffered_map_input);
@@ -299,6 +324,7 @@ GT_INLINE gt_status gt_imp_get_block(
     gt_buffered_input_file* const buffered_map_input,const uint64_t num_records) {
   GT_BUFFERED_INPUT_FILE_CHECK(buffered_map_input);
   gt_input_file* const input_file = buffered_map_input->input_file;
+  if (input_file->ranges!=NULL) return gt_buffered_input_file_get_range_block(buffered_map_input);
   // Read lines
   if (input_file->eof) return GT_BMI_EOF;
   gt_input_file_lock(input_file);
@@ -306,12 +332,12 @@ GT_INLINE gt_status gt_imp_get_block(
     gt_input_file_unlock(input_file);
     return GT_BMI_EOF;
   }
-  buffered_map_input->block_id = gt_input_file_next_id(input_file) % UINT32_MAX;
   buffered_map_input->current_line_num = input_file->processed_lines+1;
   gt_vector_clear(buffered_map_input->block_buffer); // Clear dst buffer
   // Read lines
+  const uint64_t block_records = gt_buffered_input_file_block_lines(buffered_map_input,num_records);
   uint64_t lines_read = 0, num_blocks = 0, num_tabs = 0;
-  while ( (lines_read<num_records || num_blocks%2!=0) &&
+  while ( (lines_read<block_records || num_blocks%2!=0) &&
       gt_input_file_next_record(input_file,buffered_map_input->block_buffer,NULL,&num_blocks,&num_tabs) ) ++lines_read;
   // Dump remaining content into the buffer
   gt_input_file_dump_to_buffer(input_file,buffered_map_input->block_buffer);
@@ -320,9 +346,11 @@ GT_INLINE gt_status gt_imp_get_block(
   }
   input_file->processed_lines+=lines_read;
   buffered_map_input->lines_in_buffer = lines_read;
+  if (lines_read>0) buffered_map_input->block_id = gt_input_file_next_id(input_file) % UINT32_MAX;
   gt_input_file_unlock(input_file);
   // Setup the block
   buffered_map_input->cursor = gt_vector_get_mem(buffered_map_input->block_buffer,char);
+  gt_buffered_input_file_block_read(buffered_map_input);
   return buffered_map_input->lines_in_buffer;
 }
 /* MAP file. Reload internal buffer */
@@ -331,10 +359,13 @@ GT_INLINE gt_status gt_input_map_parser_reload_buffer(
   GT_BUFFERED_INPUT_FILE_CHECK(buffered_map_input);
   // Dump buffer if BOF it attached to Map-input, and get new out block (always FIRST)
   gt_buffered_input_file_dump_attached_buffers(buffered_map_input->attached_buffered_output_file);
-  // Read new input block
-  const uint64_t read_lines = (synchronized_map) ?
-      gt_imp_get_block(buffered_map_input,num_lines):
-      gt_buffered_input_file_get_block(buffered_map_input,num_lines);
+  // Read new input block (from the next file of the set, if any, once exhausted)
+  uint64_t read_lines;
+  do {
+    read_lines = (synchronized_map) ?
+        gt_imp_get_block(buffered_map_input,num_lines):
+        gt_buffered_input_file_get_block(buffered_map_input,num_lines);
+  } while (read_lines==0 && gt_buffered_input_file_next_input(buffered_map_input));
   if (gt_expect_false(read_lines==0)) return GT_IMP_EOF;
   // Assign block ID
   gt_buffered_input_file_set_id_attached_buffers(buffered_map_input->attached_buffered_output_file,buffered_map_input->block_id);
@@ -350,7 +381,7 @@ GT_INLINE gt_status gt_imp_tag(const char** const text_line,gt_string* const tag
   if (GT_IS_EOL(text_line)) return GT_IMP_PE_PREMATURE_EOL;
   return 0;
 }
-GT_INLINE gt_status gt_imp_read_block(const char** const text_line,gt_string* const read_block) {
+GT_INLINE gt_status gt_imp_read_block(const char** const text_line,gt_string* const read_block,const bool read_view) {
   // Read READ_BLOCK
   const char* const read_block_begin = *text_line;
   while (gt_expect_true(**text_line!=TAB && !gt_is_valid_template_separator(**text_line) && !GT_IS_EOL(text_line))) {
@@ -358,8 +389,12 @@ GT_INLINE gt_status gt_imp_read_block(const char** const text_line,gt_string* co
     GT_NEXT_CHAR(text_line);
   }
   if (GT_IS_EOL(text_line)) return GT_IMP_PE_PREMATURE_EOL;
-  // Copy string
-  gt_string_set_nstring_static(read_block,read_block_begin,(*text_line-read_block_begin));
+  // Copy string (or just reference it)
+  if (read_view) {
+    gt_string_set_view(read_block,read_block_begin,(*text_line-read_block_begin));
+  } else {
+    gt_string_set_nstring_static(read_block,read_block_begin,(*text_line-read_block_begin));
+  }
   // Place cursor at beginning of the next field
   gt_status return_status;
   if (**text_line==TAB) {
@@ -373,7 +408,7 @@ GT_INLINE gt_status gt_imp_read_block(const char** const text_line,gt_string* co
   }
   return return_status;
 }
-GT_INLINE gt_status gt_imp_qualities_block(const char** const text_line,gt_string* const qualities_block) {
+GT_INLINE gt_status gt_imp_qualities_block(const char** const text_line,gt_string* const qualities_block,const bool read_view) {
   // Read QUAL_BLOCK
   const char* const qualities_block_begin = *text_line;
   while (gt_expect_true(**text_line!=TAB && !gt_is_valid_template_separator(**text_line) && !GT_IS_EOL(text_line))) {
@@ -381,8 +416,12 @@ GT_INLINE gt_status gt_imp_qualities_block(const char** const text_line,gt_strin
     GT_NEXT_CHAR(text_line);
   }
   if (GT_IS_EOL(text_line)) return GT_IMP_PE_PREMATURE_EOL;
-  // Copy string
-  gt_string_set_nstring_static(qualities_block,qualities_block_begin,(*text_line-qualities_block_begin));
+  // Copy string (or just reference it)
+  if (read_view) {
+    gt_string_set_view(qualities_block,qualities_block_begin,(*text_line-qualities_block_begin));
+  } else {
+    gt_string_set_nstring_static(qualities_block,qualities_block_begin,(*text_line-qualities_block_begin));
+  }
   // Place cursor at beginning of the next field
   gt_status return_status;
   if (**text_line==TAB) {
@@ -558,7 +597,7 @@ GT_INLINE gt_status gt_imp_parse_mismatch_string_v0(const char** const text_line
         gt_map_set_base_length(map,position-last_cut_point);
         last_cut_point = position;
         // Create a new map block
-        gt_map* next_map = gt_map_new();
+        gt_map* next_map = gt_imp_map_new(map_parser_attr);
         gt_map_set_seq_name(next_map,gt_map_get_seq_name(map),gt_map_get_seq_name_length(map));
         gt_map_set_strand(next_map,gt_map_get_strand(map));
         gt_map_set_base_length(next_map,global_length-position);
@@ -671,7 +710,7 @@ GT_INLINE gt_status gt_imp_parse_mismatch_string_v1(const char** const text_line
         }
         GT_NEXT_CHAR(text_line);
         // Create a new map block
-        gt_map* const next_map = gt_map_new();
+        gt_map* const next_map = gt_imp_map_new(map_parser_attr);
         gt_map_set_seq_name(next_map,gt_map_get_seq_name(map),gt_map_get_seq_name_length(map));
         gt_map_set_strand(next_map,gt_map_get_strand(map));
         // FIXME: gt_map_set_base_length(next_map,gt_map_get_base_length(map)-read_span);
@@ -756,7 +795,9 @@ GT_INLINE gt_status gt_imp_next_element(const char** const text_line) {
 #define GT_IMP_PARSE_SPLIT_MAP_CLEAN1__RETURN(error_code) { gt_map_delete(donor_map); return error_code; }
 #define GT_IMP_PARSE_SPLIT_MAP_CLEAN2__RETURN(error_code) { gt_map_delete(donor_map); gt_map_delete(acceptor_map); return error_code; }
 #define GT_IMP_PARSE_SPLITMAP_IS_SEP(text_line) ((**text_line)==GT_MAP_SPLITMAP_NEXT_GEMv0_0 || (**text_line)==GT_MAP_SPLITMAP_NEXT_GEMv0_1)
-GT_INLINE gt_status gt_imp_parse_split_map_v0(const char** const text_line,gt_map** const split_map,const uint64_t read_base_length) {
+GT_INLINE gt_status gt_imp_parse_split_map_v0(
+    const char** const text_line,gt_map** const split_map,
+    const uint64_t read_base_length,gt_map_parser_attributes* const map_parser_attr) {
   /*
    * ReturnValues = { GT_IMP_PE_MAP_BAD_CHARACTER, GT_IMP_PE_PREMATURE_EOL, OK=0 }
    */
@@ -778,7 +819,7 @@ GT_INLINE gt_status gt_imp_parse_split_map_v0(const char** const text_line,gt_ma
    */
   if (gt_expect_false((**text_line)!=GT_MAP_SPLITMAP_OPEN_GEMv0)) return GT_IMP_PE_MAP_BAD_CHARACTER;
   // Create the SM
-  gt_map* const donor_map = gt_map_new();
+  gt_map* const donor_map = gt_imp_map_new(map_parser_attr);
   // Read split-points
   uint64_t sm_position;
   bool sm_elm_parsed = false;
@@ -840,7 +881,7 @@ GT_INLINE gt_status gt_imp_parse_split_map_v0(const char** const text_line,gt_ma
    * Parse acceptor(s)
    */
   // Read acceptor's TAG
-  gt_map* const acceptor_map = gt_map_new();
+  gt_map* const acceptor_map = gt_imp_map_new(map_parser_attr);
   const char* const acceptor_name = *text_line;
   GT_READ_UNTIL(text_line,(**text_line)==GT_MAP_SEP);
   if (GT_IS_EOL(text_line)) GT_IMP_PARSE_SPLIT_MAP_CLEAN2__RETURN(GT_IMP_PE_PREMATURE_EOL);
@@ -932,12 +973,12 @@ GT_INLINE gt_status gt_imp_parse_map(
       return GT_IMP_PE_MMAP_ATTRIBUTE_SCORE;
     }
   } else if (gt_expect_false((**text_line)==GT_MAP_SPLITMAP_OPEN_GEMv0)) { // Parse Old Split-Maps
-    if ((error_code=gt_imp_parse_split_map_v0(text_line,return_map,read_base_length))) return error_code;
+    if ((error_code=gt_imp_parse_split_map_v0(text_line,return_map,read_base_length,map_parser_attr))) return error_code;
   } else {
     /*
      * Parse MAP (Regular Map... for whatever that means)
      */
-    gt_map* const map = gt_map_new();
+    gt_map* const map = gt_imp_map_new(map_parser_attr);
     gt_map_set_base_length(map,read_base_length); // Tentative base length (for GEMv0)
     // Read TAG
     const char* const seq_name_start = *text_line;
@@ -1019,22 +1060,9 @@ GT_INLINE gt_status gt_imp_parse_map(
       return error_code; \
       break; \
   }
-GT_INLINE gt_status gt_imp_parse_template_maps(
-    const char** const text_line,gt_template* const template,gt_map_parser_attributes* const map_parser_attr) {
-  GT_NULL_CHECK(text_line); GT_NULL_CHECK((*text_line));
-  GT_TEMPLATE_CHECK(template);
-  // Check null maps
-  if ((**text_line)==GT_MAP_NONE) {
-    GT_SKIP_LINE(text_line);
-    return 0;
-  }
-  // Check max_num_maps to parse (stratum-wise)
-  uint64_t max_num_maps = map_parser_attr->max_parsed_maps;
-  if (max_num_maps<GT_ALL) {
-    uint64_t strata;
-    gt_counters_calculate_num_maps(gt_template_get_counters_vector(template),
-        0,map_parser_attr->max_parsed_maps,&strata,&max_num_maps);
-  }
+GT_INLINE gt_status gt_imp_parse_template_maps_list(
+    const char** const text_line,gt_template* const template,
+    const uint64_t max_num_maps,gt_map_parser_attributes* const map_parser_attr) {
   // Parse MAPS. Formats allowed:
   //   OLD (v0): chr7:F127708134G27T88::chr7:R127708509<+3>20A88C89C99
   //   NEW (v1): chr11:-:51590050:(5)43T46A9>24*::chr11:-:51579823:33C9T30T24>1-(10)
@@ -1126,21 +1154,9 @@ GT_INLINE gt_status gt_imp_parse_template_maps(
   }
   return 0;
 }
-GT_INLINE gt_status gt_imp_parse_alignment_maps(const char** const text_line,gt_alignment* alignment,gt_map_parser_attributes* const map_parser_attr) {
-  GT_NULL_CHECK(text_line); GT_NULL_CHECK((*text_line));
-  GT_ALIGNMENT_CHECK(alignment);
-  // Check null maps
-  if ((**text_line)==GT_MAP_NONE) {
-    GT_SKIP_LINE(text_line);
-    return 0;
-  }
-  // Check max_num_maps to parse (stratum-wise)
-  uint64_t max_num_maps = map_parser_attr->max_parsed_maps;
-  if (max_num_maps<GT_ALL) {
-    uint64_t strata;
-    gt_counters_calculate_num_maps(gt_alignment_get_counters_vector(alignment),
-        0,map_parser_attr->max_parsed_maps,&strata,&max_num_maps);
-  }
+GT_INLINE gt_status gt_imp_parse_alignment_maps_list(
+    const char** const text_line,gt_alignment* alignment,
+    const uint64_t max_num_maps,gt_map_parser_attributes* const map_parser_attr) {
   // Parse MAPS. Formats allowed:
   //   OLD (v0): chr7:F127708134G27T88
   //   NEW (v1): chr11:-:51590050:(5)43T46A9>24*
@@ -1214,6 +1230,152 @@ GT_INLINE gt_status gt_imp_parse_alignment_maps(const char** const text_line,gt_
   }
   return 0;
 }
+/*
+ * Lazy maps
+ *   The map list is only scanned for map separators and kept as text.
+ *   Maps are decoded later on (gt_lazy_maps_decode), when the accessors reach them.
+ *   Malformed maps are reported then (as the parser does) and the list is cut before them
+ */
+GT_INLINE void gt_lazy_maps_set_pending(gt_lazy_maps* const lazy_maps,gt_lazy_maps* const pending_maps) {
+  if (lazy_maps->paired) {
+    gt_template* const template = (gt_template*)lazy_maps->owner;
+    template->pending_maps = pending_maps;
+    gt_template_get_end1(template)->pending_maps = pending_maps;
+    gt_template_get_end2(template)->pending_maps = pending_maps;
+  } else {
+    ((gt_alignment*)lazy_maps->owner)->pending_maps = pending_maps;
+  }
+}
+GT_INLINE void gt_imp_record_lazy_maps(
+    const char** const text_line,gt_lazy_maps** const lazy_maps_storage,
+    void* const owner,const bool paired,const uint64_t max_num_maps,gt_map_parser_attributes* const map_parser_attr) {
+  // Count maps (up to the EOL)
+  const char* const map_list = *text_line;
+  uint64_t num_maps = 1;
+  while (!GT_IS_EOL(text_line)) {
+    if (gt_expect_false((**text_line)==GT_MAP_NEXT)) ++num_maps;
+    GT_NEXT_CHAR(text_line);
+  }
+  if (max_num_maps==0) return;
+  // Record the map list
+  if (*lazy_maps_storage==NULL) *lazy_maps_storage = gt_lazy_maps_new();
+  gt_lazy_maps* const lazy_maps = *lazy_maps_storage;
+  gt_string_set_nstring(lazy_maps->text,(char*)map_list,*text_line-map_list);
+  lazy_maps->next_offset = 0;
+  lazy_maps->num_maps = GT_MIN(num_maps,max_num_maps);
+  lazy_maps->num_decoded = 0;
+  lazy_maps->owner = owner;
+  lazy_maps->paired = paired;
+  lazy_maps->map_arena = map_parser_attr->map_arena;
+  lazy_maps->skip_based_model = map_parser_attr->skip_based_model;
+  lazy_maps->file_name = NULL;
+  lazy_maps->line_num = 0;
+  lazy_maps->column_pos = 0;
+  lazy_maps->error_code = 0;
+  gt_lazy_maps_set_pending(lazy_maps,lazy_maps);
+}
+GT_INLINE void gt_imp_locate_lazy_maps(
+    gt_lazy_maps* const lazy_maps,char* const file_name,const uint64_t line_num,const uint64_t line_length) {
+  // The map list is the tail of the line
+  lazy_maps->file_name = file_name;
+  lazy_maps->line_num = line_num;
+  lazy_maps->column_pos = line_length-gt_string_get_length(lazy_maps->text);
+}
+GT_INLINE void gt_lazy_maps_decode(gt_lazy_maps* const lazy_maps,const uint64_t num_maps) {
+  GT_NULL_CHECK(lazy_maps);
+  if (num_maps<=lazy_maps->num_decoded) return;
+  // Detach (the accessors used to store the maps must not decode)
+  gt_lazy_maps_set_pending(lazy_maps,NULL);
+  // Parse the next maps
+  gt_map_parser_attributes map_parser_attr = GT_MAP_PARSER_ATTR_DEFAULT(false);
+  map_parser_attr.map_arena = lazy_maps->map_arena;
+  map_parser_attr.skip_based_model = lazy_maps->skip_based_model;
+  const char* const text_begin = gt_string_get_string(lazy_maps->text)+lazy_maps->next_offset;
+  const char* text = text_begin;
+  const uint64_t max_num_maps = GT_MIN(num_maps,lazy_maps->num_maps)-lazy_maps->num_decoded;
+  gt_status error_code;
+  if (lazy_maps->paired) {
+    gt_template* const template = (gt_template*)lazy_maps->owner;
+    error_code = gt_imp_parse_template_maps_list(&text,template,max_num_maps,&map_parser_attr);
+    lazy_maps->num_decoded = gt_vector_get_used(template->mmaps);
+  } else {
+    gt_alignment* const alignment = (gt_alignment*)lazy_maps->owner;
+    error_code = gt_imp_parse_alignment_maps_list(&text,alignment,max_num_maps,&map_parser_attr);
+    lazy_maps->num_decoded = gt_vector_get_used(alignment->maps);
+  }
+  if (gt_expect_false(error_code)) {
+    // Report the malformed map and keep the maps decoded before it
+    const uint64_t column_pos = lazy_maps->column_pos + (text-gt_string_get_string(lazy_maps->text));
+    gt_imp_prompt_error(lazy_maps->file_name,lazy_maps->line_num,column_pos,error_code);
+    lazy_maps->error_code = error_code;
+    lazy_maps->num_maps = lazy_maps->num_decoded;
+    return;
+  }
+  lazy_maps->next_offset += text-text_begin;
+  // Attach again (unless all maps are decoded)
+  if (lazy_maps->num_decoded<lazy_maps->num_maps && !GT_IS_EOL(&text)) {
+    gt_lazy_maps_set_pending(lazy_maps,lazy_maps);
+  } else {
+    lazy_maps->num_maps = lazy_maps->num_decoded;
+  }
+}
+GT_INLINE void gt_lazy_maps_discard(gt_lazy_maps* const lazy_maps) {
+  GT_NULL_CHECK(lazy_maps);
+  gt_lazy_maps_set_pending(lazy_maps,NULL);
+  gt_string_clear(lazy_maps->text);
+  lazy_maps->next_offset = 0;
+  lazy_maps->num_maps = 0;
+  lazy_maps->num_decoded = 0;
+  lazy_maps->error_code = 0;
+}
+/*
+ * Parse the maps of a template/alignment
+ */
+GT_INLINE gt_status gt_imp_parse_template_maps(
+    const char** const text_line,gt_template* const template,gt_map_parser_attributes* const map_parser_attr) {
+  GT_NULL_CHECK(text_line); GT_NULL_CHECK((*text_line));
+  GT_TEMPLATE_CHECK(template);
+  // Check null maps
+  if ((**text_line)==GT_MAP_NONE) {
+    GT_SKIP_LINE(text_line);
+    return 0;
+  }
+  // Check max_num_maps to parse (stratum-wise)
+  uint64_t max_num_maps = map_parser_attr->max_parsed_maps;
+  if (max_num_maps<GT_ALL) {
+    uint64_t strata;
+    gt_counters_calculate_num_maps(gt_template_get_counters_vector(template),
+        0,map_parser_attr->max_parsed_maps,&strata,&max_num_maps);
+  }
+  // Lazy parsing (just record the maps)
+  if (map_parser_attr->lazy_maps && !GT_IS_EOL(text_line)) {
+    gt_imp_record_lazy_maps(text_line,&template->lazy_maps,template,true,max_num_maps,map_parser_attr);
+    return 0;
+  }
+  return gt_imp_parse_template_maps_list(text_line,template,max_num_maps,map_parser_attr);
+}
+GT_INLINE gt_status gt_imp_parse_alignment_maps(const char** const text_line,gt_alignment* alignment,gt_map_parser_attributes* const map_parser_attr) {
+  GT_NULL_CHECK(text_line); GT_NULL_CHECK((*text_line));
+  GT_ALIGNMENT_CHECK(alignment);
+  // Check null maps
+  if ((**text_line)==GT_MAP_NONE) {
+    GT_SKIP_LINE(text_line);
+    return 0;
+  }
+  // Check max_num_maps to parse (stratum-wise)
+  uint64_t max_num_maps = map_parser_attr->max_parsed_maps;
+  if (max_num_maps<GT_ALL) {
+    uint64_t strata;
+    gt_counters_calculate_num_maps(gt_alignment_get_counters_vector(alignment),
+        0,map_parser_attr->max_parsed_maps,&strata,&max_num_maps);
+  }
+  // Lazy parsing (just record the maps)
+  if (map_parser_attr->lazy_maps && !GT_IS_EOL(text_line)) {
+    gt_imp_record_lazy_maps(text_line,&alignment->lazy_maps,alignment,false,max_num_maps,map_parser_attr);
+    return 0;
+  }
+  return gt_imp_parse_alignment_maps_list(text_line,alignment,max_num_maps,map_parser_attr);
+}
 GT_INLINE gt_status gt_imp_map_blocks(const char** const text_line,gt_map** const map,gt_map_parser_attributes* const map_parser_attr) {
   GT_NULL_CHECK(text_line); GT_NULL_CHECK((*text_line));
   GT_NULL_CHECK(map);
@@ -1290,7 +1452,7 @@ GT_INLINE gt_status gt_imp_parse_alignment(
   // TAG
   if ((error_code=gt_imp_tag(text_line,alignment->tag,alignment->attributes))) return error_code;
   // READ
-  error_code=gt_imp_read_block(text_line,alignment->read);
+  error_code=gt_imp_read_block(text_line,alignment->read,map_parser_attr->read_views);
   if (gt_expect_false(error_code==GT_IMP_PE_PENDING_BLOCKS)) return GT_IMP_PE_BAD_NUMBER_OF_BLOCKS;
   if (gt_expect_false(error_code!=GT_IMP_PE_EOB)) return error_code;
   // QUALITIES
@@ -1298,7 +1460,7 @@ GT_INLINE gt_status gt_imp_parse_alignment(
     if (gt_expect_false(**text_line==TAB)) {
       GT_NEXT_CHAR(text_line);
     } else {
-      error_code=gt_imp_qualities_block(text_line,alignment->qualities);
+      error_code=gt_imp_qualities_block(text_line,alignment->qualities,map_parser_attr->read_views);
       if (gt_expect_false(gt_string_get_length(alignment->qualities)!=
                           gt_string_get_length(alignment->read))) return GT_IMP_PE_QUAL_BAD_LENGTH;
       if (gt_expect_false(error_code==GT_IMP_PE_PENDING_BLOCKS)) return GT_IMP_PE_BAD_NUMBER_OF_BLOCKS;
@@ -1330,7 +1492,7 @@ GT_INLINE gt_status gt_imp_parse_template(
   error_code=GT_IMP_PE_PENDING_BLOCKS;
   while (error_code==GT_IMP_PE_PENDING_BLOCKS) {
     gt_alignment* const alignment = gt_template_get_block_dyn(template,num_blocks);
-    error_code=gt_imp_read_block(text_line,alignment->read);
+    error_code=gt_imp_read_block(text_line,alignment->read,map_parser_attr->read_views);
     if (error_code!=GT_IMP_PE_PENDING_BLOCKS && error_code!=GT_IMP_PE_EOB) return error_code;
     ++num_blocks;
   }
@@ -1346,7 +1508,7 @@ GT_INLINE gt_status gt_imp_parse_template(
       for (i=0;i<num_blocks;++i) {
         if (error_code!=GT_IMP_PE_PENDING_BLOCKS) return GT_IMP_PE_BAD_NUMBER_OF_BLOCKS;
         gt_alignment* alignment = gt_template_get_block(template,i);
-        error_code=gt_imp_qualities_block(text_line,alignment->qualities);
+        error_code=gt_imp_qualities_block(text_line,alignment->qualities,map_parser_attr->read_views);
         if (gt_expect_false(gt_string_get_length(alignment->qualities)>0 &&
             gt_string_get_length(alignment->qualities)!=gt_string_get_length(alignment->read))){
           return GT_IMP_PE_QUAL_BAD_LENGTH;
@@ -1469,12 +1631,12 @@ GT_INLINE gt_status gt_imp_get_template(
   GT_BUFFERED_INPUT_FILE_CHECK(buffered_map_input);
   GT_TEMPLATE_CHECK(template);
   GT_NULL_CHECK(map_parser_attr);
-  gt_input_file* const input_file = buffered_map_input->input_file;
   gt_status error_code;
   // Check the end_of_block. Reload buffer if needed
   if (gt_buffered_input_file_eob(buffered_map_input)) {
     if ((error_code=gt_input_map_parser_reload_buffer(buffered_map_input,true,GT_IMP_NUM_LINES))!=GT_IMP_OK) return error_code;
   }
+  gt_input_file* const input_file = buffered_map_input->input_file; // The reload may move to the next file of the set
   // Check file format
   if (gt_input_map_parser_check_map_file_format(buffered_map_input)) {
     gt_fatal_error(PARSE_MAP_BAD_FILE_FORMAT,input_file->file_name,buffered_map_input->current_line_num);
@@ -1496,6 +1658,11 @@ GT_INLINE gt_status gt_imp_get_template(
     }
     return GT_IMP_FAIL;
   }
+  // Locate the lazy maps (decoding errors are reported against this line)
+  gt_lazy_maps* const pending_maps = gt_template_get_block(template,0)->pending_maps; // Ends share the template's
+  if (pending_maps!=NULL) {
+    gt_imp_locate_lazy_maps(pending_maps,input_file->file_name,line_num,buffered_map_input->cursor-line_start);
+  }
   // Store source record
   if (map_parser_attr->src_text!=NULL) {
     gt_string_set_nstring(map_parser_attr->src_text,line_start,buffered_map_input->cursor-line_start);
@@ -1510,12 +1677,12 @@ GT_INLINE gt_status gt_imp_get_alignment(
   GT_BUFFERED_INPUT_FILE_CHECK(buffered_map_input);
   GT_ALIGNMENT_CHECK(alignment);
   GT_NULL_CHECK(map_parser_attr);
-  gt_input_file* const input_file = buffered_map_input->input_file;
   gt_status error_code;
   // Check the end_of_block. Reload buffer if needed
   if (gt_buffered_input_file_eob(buffered_map_input)) {
     if ((error_code=gt_input_map_parser_reload_buffer(buffered_map_input,false,GT_IMP_NUM_LINES))!=GT_IMP_OK) return error_code;
   }
+  gt_input_file* const input_file = buffered_map_input->input_file; // The reload may move to the next file of the set
   // Check file format
   if (gt_input_map_parser_check_map_file_format(buffered_map_input)) {
     gt_error(PARSE_MAP_BAD_FILE_FORMAT,input_file->file_name,buffered_map_input->current_line_num);
@@ -1537,6 +1704,10 @@ GT_INLINE gt_status gt_imp_get_alignment(
     }
     return GT_IMP_FAIL;
   }
+  // Locate the lazy maps (decoding errors are reported against this line)
+  if (alignment->pending_maps!=NULL) {
+    gt_imp_locate_lazy_maps(alignment->pending_maps,input_file->file_name,line_num,buffered_map_input->cursor-line_start);
+  }
   // Store source record
   if (map_parser_attr->src_text) {
     gt_string_set_nstring(map_parser_attr->src_text,line_start,buffered_map_input->cursor-line_start);
@@ -1558,10 +1729,17 @@ GT_INLINE gt_status gt_input_map_parser_get_template(
   GT_TEMPLATE_CHECK(template);
   GT_MAP_PARSER_CHECK_ATTRIBUTES(map_parser_attr);
   gt_status error_code;
+  // Recycle the maps of the previous record (the template is cleared before any map is taken)
+  if (map_parser_attr->map_arena!=NULL) gt_map_arena_clear(map_parser_attr->map_arena);
   if ((error_code=gt_imp_get_template(buffered_map_input,template,map_parser_attr))!=GT_IMP_OK) {
     return (error_code==GT_IMP_EOF) ? GT_IMP_EOF : GT_IMP_FAIL;
   }
   if (gt_template_get_num_blocks(template)==1 && map_parser_attr->force_read_paired) {
+    if (map_parser_attr->read_views && gt_buffered_input_file_eob(buffered_map_input)) { // End/2 reloads the buffer
+      gt_alignment* const end1 = gt_template_get_block(template,0);
+      gt_string_unview(end1->read);
+      gt_string_unview(end1->qualities);
+    }
     if ((error_code=gt_imp_get_alignment(buffered_map_input,gt_template_get_block_dyn(template,1),map_parser_attr))!=GT_IMP_OK) {
       return GT_IMP_FAIL;
     }
@@ -1579,8 +1757,21 @@ GT_INLINE gt_status gt_input_map_parser_get_alignment(
   GT_BUFFERED_INPUT_FILE_CHECK(buffered_map_input);
   GT_ALIGNMENT_CHECK(alignment);
   GT_MAP_PARSER_CHECK_ATTRIBUTES(map_parser_attr);
+  if (map_parser_attr->map_arena!=NULL) gt_map_arena_clear(map_parser_attr->map_arena);
   return gt_imp_get_alignment(buffered_map_input,alignment,map_parser_attr);
 }
+GT_INLINE gt_status gt_input_map_parser_get_map_table(
+    gt_buffered_input_file* const buffered_map_input,gt_template* const template,
+    gt_map_table* const map_table,gt_map_parser_attributes* map_parser_attr) {
+  GT_BUFFERED_INPUT_FILE_CHECK(buffered_map_input);
+  GT_TEMPLATE_CHECK(template);
+  GT_MAP_TABLE_CHECK(map_table);
+  GT_MAP_PARSER_CHECK_ATTRIBUTES(map_parser_attr);
+  gt_status error_code;
+  if ((error_code=gt_input_map_parser_get_template(buffered_map_input,template,map_parser_attr))!=GT_IMP_OK) return error_code;
+  gt_map_table_add_template(map_table,template);
+  return GT_IMP_OK;
+}
 /*
  * Synch read of blocks
  */
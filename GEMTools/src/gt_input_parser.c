@@ -232,3 +232,95 @@ GT_INLINE uint64_t gt_input_parse_tag_chomp_pairend_info(gt_string* const tag) {
     return GT_PAIR_SE;
   }
 }
+/*
+ * Field Index
+ */
+GT_INLINE uint64_t gt_input_field_index_build(
+    gt_field_index* const field_index,char* const line,const char separator,const uint64_t max_fields) {
+  GT_NULL_CHECK(field_index);
+  GT_NULL_CHECK(line);
+  const uint64_t fields_limit = GT_MIN(GT_MAX(max_fields,1),GT_FIELD_INDEX_MAX_FIELDS);
+  const bool tab_terminates = (separator!=TAB);
+  uint64_t num_fields = 0;
+  field_index->line = line;
+#ifdef GT_SCAN_WORD_LENGTH
+  // Vectorized scan (aligned words, so that reading beyond the EOL never crosses a page)
+  const uint64_t misalignment = (uintptr_t)line & (GT_SCAN_WORD_LENGTH-1);
+  const char* word = line-misalignment;
+  int64_t word_offset = -(int64_t)misalignment;
+  uint64_t valid_mask = UINT64_MAX << misalignment;
+  while (true) {
+    uint64_t end_mask = GT_SCAN_WORD_MASK(word,EOL) | GT_SCAN_WORD_MASK(word,EOS);
+    if (tab_terminates) end_mask |= GT_SCAN_WORD_MASK(word,TAB);
+    end_mask &= valid_mask;
+    uint64_t separator_mask = GT_SCAN_WORD_MASK(word,separator) & valid_mask;
+    if (end_mask) separator_mask &= (end_mask & -end_mask)-1; // Only separators before the end
+    while (separator_mask) {
+      field_index->field_end[num_fields++] = word_offset+__builtin_ctzll(separator_mask);
+      if (num_fields==fields_limit) return (field_index->num_fields=num_fields);
+      separator_mask &= separator_mask-1;
+    }
+    if (end_mask) {
+      field_index->field_end[num_fields++] = word_offset+__builtin_ctzll(end_mask);
+      return (field_index->num_fields=num_fields);
+    }
+    word += GT_SCAN_WORD_LENGTH;
+    word_offset += GT_SCAN_WORD_LENGTH;
+    valid_mask = UINT64_MAX;
+  }
+#else
+  uint64_t pos;
+  for (pos=0;;++pos) {
+    const char character = line[pos];
+    if (character==EOL || character==EOS || (tab_terminates && character==TAB)) {
+      field_index->field_end[num_fields++] = pos;
+      break;
+    }
+    if (character==separator) {
+      field_index->field_end[num_fields++] = pos;
+      if (num_fields==fields_limit) break;
+    }
+  }
+  return (field_index->num_fields=num_fields);
+#endif
+}
+/*
+ * Number parsing
+ */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+GT_INLINE bool gt_input_parse_swar_number(const char* const digits,const uint64_t length,uint64_t* const number) {
+  // Load the digits right-aligned (left-padded with '0')
+  uint64_t word = 0x3030303030303030ull;
+  memcpy((char*)&word+(8-length),digits,length);
+  // Check all are digits
+  if ((word & 0xF0F0F0F0F0F0F0F0ull)!=0x3030303030303030ull ||
+      ((word+0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull)!=0x3030303030303030ull) return false;
+  // Combine 2,4,8 digits at a time
+  word = ((word & 0x0F0F0F0F0F0F0F0Full)*2561) >> 8;
+  word = ((word & 0x00FF00FF00FF00FFull)*6553601) >> 16;
+  *number = ((word & 0x0000FFFF0000FFFFull)*42949672960001ull) >> 32;
+  return true;
+}
+#endif
+GT_INLINE bool gt_input_parse_field_number(const char* const field,const uint64_t length,uint64_t* const number) {
+  GT_NULL_CHECK(field);
+  GT_NULL_CHECK(number);
+  if (gt_expect_false(length==0)) return false;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  if (gt_expect_true(length<=8)) return gt_input_parse_swar_number(field,length,number);
+  if (gt_expect_true(length<=16)) {
+    uint64_t high, low;
+    if (!gt_input_parse_swar_number(field,length-8,&high)) return false;
+    if (!gt_input_parse_swar_number(field+length-8,8,&low)) return false;
+    *number = high*100000000ull+low;
+    return true;
+  }
+#endif
+  uint64_t i, value = 0;
+  for (i=0;i<length;++i) {
+    if (!gt_is_number(field[i])) return false;
+    value = value*10 + gt_get_cipher(field[i]);
+  }
+  *number = value;
+  return true;
+}
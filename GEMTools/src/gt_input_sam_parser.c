@@ -31,22 +31,6 @@ GT_INLINE void gt_input_sam_parser_attributes_set_soap_compilant(gt_sam_parser_a
   attributes->sam_soap_style = true;
 }
 
-// Internal pair-pending
-typedef struct {
-  // Current map info
-  gt_string map_seq_name;
-  uint64_t map_position;
-  uint64_t end_position; // 0/1
-  // Next map info
-  gt_string next_seq_name;
-  uint64_t next_position;
-  // Map location and span info
-  uint64_t map_displacement; // In alignment's map vector
-  uint64_t num_maps; // Maps in the vector coupled to the first one
-} gt_sam_pending_end;
-
-#define GT_SAM_INIT_PENDING { .map_seq_name.allocated=0, .next_seq_name.allocated=0 }
-
 /*
  * SAM File Format test
  */
@@ -62,27 +46,27 @@ GT_INLINE gt_status gt_input_file_sam_read_headers(
     if (GT_INPUT_FILE_SAM_READ_HEADERS_CMP_TAG(buffer+buffer_pos,'H','D')) {
       buffer_pos+=3;
       while (buffer_pos<buffer_size && buffer[buffer_pos]!=EOL) ++buffer_pos;
-      if (buffer_pos==buffer_size) return 0;
+      if (buffer_pos==buffer_size) return -1;
       ++buffer_pos;
     } else if (GT_INPUT_FILE_SAM_READ_HEADERS_CMP_TAG(buffer+buffer_pos,'S','Q')) {
       buffer_pos+=3;
       while (buffer_pos<buffer_size && buffer[buffer_pos]!=EOL) ++buffer_pos;
-      if (buffer_pos==buffer_size) return 0;
+      if (buffer_pos==buffer_size) return -1;
       ++buffer_pos;
     } else if (GT_INPUT_FILE_SAM_READ_HEADERS_CMP_TAG(buffer+buffer_pos,'R','G')) {
       buffer_pos+=3;
       while (buffer_pos<buffer_size && buffer[buffer_pos]!=EOL) ++buffer_pos;
-      if (buffer_pos==buffer_size) return 0;
+      if (buffer_pos==buffer_size) return -1;
       ++buffer_pos;
     } else if (GT_INPUT_FILE_SAM_READ_HEADERS_CMP_TAG(buffer+buffer_pos,'P','G')) {
       buffer_pos+=3;
       while (buffer_pos<buffer_size && buffer[buffer_pos]!=EOL) ++buffer_pos;
-      if (buffer_pos==buffer_size) return 0;
+      if (buffer_pos==buffer_size) return -1;
       ++buffer_pos;
     } else if (GT_INPUT_FILE_SAM_READ_HEADERS_CMP_TAG(buffer+buffer_pos,'C','O')) {
       buffer_pos+=3;
       while (buffer_pos<buffer_size && buffer[buffer_pos]!=EOL) ++buffer_pos;
-      if (buffer_pos==buffer_size) return 0;
+      if (buffer_pos==buffer_size) return -1;
       ++buffer_pos;
     } else {
       return -1;
@@ -231,6 +215,7 @@ GT_INLINE gt_status gt_input_sam_parser_get_block(
     gt_buffered_input_file* const buffered_sam_input,const uint64_t num_records) {
   GT_BUFFERED_INPUT_FILE_CHECK(buffered_sam_input);
   gt_input_file* const input_file = buffered_sam_input->input_file;
+  if (input_file->ranges!=NULL) return gt_buffered_input_file_get_range_block(buffered_sam_input);
   // Read lines
   if (input_file->eof) return GT_BMI_EOF;
   gt_input_file_lock(input_file);
@@ -238,14 +223,14 @@ GT_INLINE gt_status gt_input_sam_parser_get_block(
     gt_input_file_unlock(input_file);
     return GT_BMI_EOF;
   }
-  buffered_sam_input->block_id = gt_input_file_next_id(input_file) % UINT32_MAX;
   buffered_sam_input->current_line_num = input_file->processed_lines+1;
   gt_vector_clear(buffered_sam_input->block_buffer); // Clear dst buffer
   // Read lines & synch SAM records
+  const uint64_t block_records = gt_buffered_input_file_block_lines(buffered_sam_input,num_records);
   uint64_t lines_read = 0;
-  while (lines_read<num_records &&
+  while (lines_read<block_records &&
       gt_input_file_next_line(input_file,buffered_sam_input->block_buffer) ) ++lines_read;
-  if (lines_read==num_records) { // !EOF, Synch wrt to tag content
+  if (lines_read==block_records) { // !EOF, Synch wrt to tag content
     uint64_t num_blocks=0, num_tabs=0;
     gt_string* const reference_tag = gt_string_new(30);
     if (gt_input_file_next_record(input_file,buffered_sam_input->block_buffer,reference_tag,&num_blocks,&num_tabs)) {
@@ -264,10 +249,12 @@ GT_INLINE gt_status gt_input_sam_parser_get_block(
   }
   input_file->processed_lines+=lines_read;
   buffered_sam_input->lines_in_buffer = lines_read;
+  if (lines_read>0) buffered_sam_input->block_id = gt_input_file_next_id(input_file) % UINT32_MAX;
   gt_input_file_unlock(input_file);
 
   // Setup the block
   buffered_sam_input->cursor = gt_vector_get_mem(buffered_sam_input->block_buffer,char);
+  gt_buffered_input_file_block_read(buffered_sam_input);
   return buffered_sam_input->lines_in_buffer;
 }
 /* SAM file. Reload internal buffer */
@@ -275,9 +262,11 @@ GT_INLINE gt_status gt_input_sam_parser_reload_buffer(gt_buffered_input_file* co
   GT_BUFFERED_INPUT_FILE_CHECK(buffered_sam_input);
   // Dump buffer if BOF it attached to SAM-input, and get new out block (always FIRST)
   gt_buffered_input_file_dump_attached_buffers(buffered_sam_input->attached_buffered_output_file);
-  // Read new input block
-  const uint64_t read_lines =
-      gt_input_sam_parser_get_block(buffered_sam_input,GT_ISP_NUM_LINES);
+  // Read new input block (from the next file of the set, if any, once exhausted)
+  uint64_t read_lines;
+  do {
+    read_lines = gt_input_sam_parser_get_block(buffered_sam_input,GT_ISP_NUM_LINES);
+  } while (read_lines==0 && gt_buffered_input_file_next_input(buffered_sam_input));
   if (gt_expect_false(read_lines==0)) return GT_ISP_EOF;
   // Assign block ID
   gt_buffered_input_file_set_id_attached_buffers(buffered_sam_input->attached_buffered_output_file,buffered_sam_input->block_id);
@@ -287,160 +276,164 @@ GT_INLINE gt_status gt_input_sam_parser_reload_buffer(gt_buffered_input_file* co
  * SAM format. Basic building block for parsing
  */
 GT_INLINE uint64_t gt_isp_read_tag(char** const init_text_line,char** const end_text_line,gt_string* const tag) {
-  // Save text_line state
-  char* text_cp = *init_text_line;
-  char** const ptext_cp = &text_cp;
-  // Read tag
-  char* const tag_begin = *ptext_cp;
-  GT_READ_UNTIL(ptext_cp,**ptext_cp==TAB || **ptext_cp==SPACE);
-  if (GT_IS_EOL(ptext_cp)) return GT_ISP_PE_PREMATURE_EOL;
-  // Set tag
-  uint64_t const tag_length = *ptext_cp-tag_begin;
-  gt_string_set_nstring(tag,tag_begin,tag_length);
-  // Read the rest till next field
-  if (**ptext_cp==SPACE) {
-    GT_READ_UNTIL(ptext_cp,**ptext_cp==TAB);
-    if (GT_IS_EOL(ptext_cp)) return GT_ISP_PE_PREMATURE_EOL;
-  }
-  GT_NEXT_CHAR(ptext_cp);
-  *end_text_line = *ptext_cp;
+  // Locate the end of the QNAME field
+  gt_field_index field_index;
+  gt_input_field_index_build(&field_index,*init_text_line,TAB,1);
+  char* const tag_begin = *init_text_line;
+  char* const field_end = gt_field_index_get_end(&field_index,0);
+  if (*field_end!=TAB) return GT_ISP_PE_PREMATURE_EOL;
+  // Set tag (up to the first SPACE, if any)
+  char* const tag_end = memchr(tag_begin,SPACE,field_end-tag_begin);
+  gt_string_set_nstring(tag,tag_begin,((tag_end!=NULL) ? tag_end : field_end)-tag_begin);
+  // Skip to the next field
+  *end_text_line = field_end+1;
   return 0;
 }
 /*
  * SAM CIGAR ::
  *   2M503N34M757N40M || 5M1D95M3I40M || ...
+ *   Each operation is decoded through a table {consumes read, consumes reference, adds misms, splits}
  */
-GT_INLINE gt_status gt_isp_parse_sam_cigar(char** const text_line,gt_map** _map,const bool reverse_strand) {
-  GT_NULL_CHECK(text_line); GT_NULL_CHECK(*text_line);
+#define GT_ISP_CIGAR_READ   1
+#define GT_ISP_CIGAR_REF    2
+#define GT_ISP_CIGAR_MISMS  4
+#define GT_ISP_CIGAR_SPLIT  8
+const uint8_t gt_isp_cigar_op_table[256] = {
+  ['M'] = GT_ISP_CIGAR_READ|GT_ISP_CIGAR_REF,
+  ['='] = GT_ISP_CIGAR_READ|GT_ISP_CIGAR_REF,
+  ['X'] = GT_ISP_CIGAR_READ|GT_ISP_CIGAR_REF,
+  ['I'] = GT_ISP_CIGAR_READ|GT_ISP_CIGAR_MISMS, // Insertion to the reference
+  ['S'] = GT_ISP_CIGAR_READ|GT_ISP_CIGAR_MISMS, // Soft clipping. Nothing specific implemented //FIXME
+  ['H'] = GT_ISP_CIGAR_READ|GT_ISP_CIGAR_MISMS, // Hard clipping. Nothing specific implemented (we don't even store this)
+  ['P'] = GT_ISP_CIGAR_READ|GT_ISP_CIGAR_MISMS, // Padding. Nothing specific implemented
+  ['D'] = GT_ISP_CIGAR_REF|GT_ISP_CIGAR_MISMS,  // Deletion from the reference
+  ['N'] = GT_ISP_CIGAR_SPLIT,                   // Split. Eg TOPHAT, GEM, ...
+};
+GT_INLINE gt_status gt_isp_cigar_add_op(
+    gt_map** const map_block,const char op_char,const uint64_t length,
+    uint64_t* const position,uint64_t* const reference_span,const bool reverse_strand) {
+  const uint8_t cigar_op = gt_isp_cigar_op_table[(uint8_t)op_char];
+  if (gt_expect_false(cigar_op==0)) return GT_ISP_PE_BAD_CHARACTER;
+  gt_map* const map = *map_block;
+  if (gt_expect_true(!(cigar_op&GT_ISP_CIGAR_SPLIT))) {
+    if (cigar_op&GT_ISP_CIGAR_MISMS) {
+      gt_misms misms;
+      misms.misms_type = (cigar_op&GT_ISP_CIGAR_READ) ? DEL : INS;
+      misms.position = *position;
+      misms.size = length;
+      gt_map_add_misms(map,&misms);
+    }
+    if (cigar_op&GT_ISP_CIGAR_READ) *position += length;
+    if (cigar_op&GT_ISP_CIGAR_REF) *reference_span += length;
+  } else {
+    // Create a new map block
+    gt_map* const next_map = gt_map_new();
+    gt_map_set_seq_name_id(next_map,gt_map_get_seq_name_id(map));
+    gt_map_set_position(next_map,gt_map_get_position(map)+*reference_span+length);
+    gt_map_set_strand(next_map,gt_map_get_strand(map));
+    gt_map_set_base_length(next_map,gt_map_get_base_length(map)-*position);
+    // Close current map block
+    gt_map_set_base_length(map,*position);
+    if (reverse_strand) {
+      gt_map_set_next_block(next_map,map,SPLICE,length);
+    } else {
+      gt_map_set_next_block(map,next_map,SPLICE,length);
+    }
+    // Swap maps & Reset position,reference_span
+    *map_block = next_map;
+    *position = 0; *reference_span = 0;
+  }
+  return 0;
+}
+GT_INLINE void gt_isp_cigar_close(
+    gt_map** const _map,gt_map* const map_block,const uint64_t position,const bool reverse_strand) {
+  gt_map_set_base_length(map_block,position);
+  // Consider map CIGAR in the reverse strand
+  if (reverse_strand) {
+    *_map = map_block;
+    GT_MAP_ITERATE(map_block,map_it) {
+      gt_map_reverse_misms(map_it);
+    }
+  }
+}
+GT_INLINE gt_status gt_isp_parse_sam_cigar(
+    const char* const cigar,const uint64_t cigar_length,gt_map** _map,const bool reverse_strand) {
+  GT_NULL_CHECK(cigar);
   GT_NULL_CHECK(_map); GT_MAP_CHECK(*_map);
   gt_map* map = *_map;
+  gt_status error_code;
   // Clear mismatches
   gt_map_clear_misms(map);
-  if (**text_line==STAR) { // No CIGAR available
-    GT_NEXT_CHAR(text_line);
-    return 0;
-  }
+  if (*cigar==STAR) return 0; // No CIGAR available
   // Aux variables as to track the position in the read and the genome span
+  const char* text = cigar;
+  const char* const cigar_end = cigar+cigar_length;
   uint64_t length, position = 0, reference_span=0;
-  while (**text_line!=TAB && **text_line!=EOL) {
+  while (text<cigar_end) {
     // Parse misms_op length
-    if (!gt_is_number(**text_line)) return GT_ISP_PE_EXPECTED_NUMBER;
-    GT_PARSE_NUMBER(text_line,length);
+    if (!gt_is_number(*text)) return GT_ISP_PE_EXPECTED_NUMBER;
+    length = 0;
+    do {
+      length = length*10 + gt_get_cipher(*text);
+    } while (++text<cigar_end && gt_is_number(*text));
     // Parse misms_op
-    if (gt_expect_false(**text_line==EOL || **text_line==TAB)) return GT_ISP_PE_CIGAR_PREMATURE_END;
-    gt_misms misms;
-    const char cigar_op = **text_line;
-    GT_NEXT_CHAR(text_line);
-    switch (cigar_op) {
-      case 'M':
-      case '=':
-      case 'X':
-        position += length;
-        reference_span += length;
-        break;
-      case 'P': // Padding. Nothing specific implemented
-      case 'S': // Soft clipping. Nothing specific implemented
-      case 'H': // Hard clipping. Nothing specific implemented (we don't even store this)
-        // break; //FIXME
-      case 'I': // Insertion to the reference
-        misms.misms_type = DEL;
-        misms.position = position;
-        misms.size = length;
-        position += length;
-        gt_map_add_misms(map,&misms);
-        break;
-      case 'D': // Deletion from the reference
-        misms.misms_type = INS;
-        misms.position = position;
-        misms.size = length;
-        reference_span += length;
-        gt_map_add_misms(map,&misms);
-        break;
-      case 'N': { // Split. Eg TOPHAT, GEM, ...
-        // Create a new map block
-        gt_map* next_map = gt_map_new();
-        gt_map_set_seq_name(next_map,gt_map_get_seq_name(map),gt_map_get_seq_name_length(map));
-        gt_map_set_position(next_map,gt_map_get_position(map)+reference_span+length);
-        gt_map_set_strand(next_map,gt_map_get_strand(map));
-        gt_map_set_base_length(next_map,gt_map_get_base_length(map)-position);
-        // Close current map block
-        gt_map_set_base_length(map,position);
-        if (reverse_strand) {
-          gt_map_set_next_block(next_map,map,SPLICE,length);
-        } else {
-          gt_map_set_next_block(map,next_map,SPLICE,length);
-        }
-        // Swap maps & Reset position,reference_span
-        map = next_map;
-        position=0; reference_span=0;
-        }
-        break;
-      default:
-        return GT_ISP_PE_BAD_CHARACTER;
-        break;
-    }
-  }
-  gt_map_set_base_length(map,position);
-  // Consider map CIGAR in the reverse strand
-  if (reverse_strand) {
-    *_map = map;
-    GT_MAP_ITERATE(map,map_it) {
-      gt_map_reverse_misms(map_it);
-    }
+    if (gt_expect_false(text==cigar_end)) return GT_ISP_PE_CIGAR_PREMATURE_END;
+    if ((error_code=gt_isp_cigar_add_op(&map,*text,length,&position,&reference_span,reverse_strand))) return error_code;
+    ++text;
   }
+  gt_isp_cigar_close(_map,map,position,reverse_strand);
   return 0;
 }
 
-#define GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL() \
-  if (GT_IS_EOL(text_line)) { \
-    gt_map_delete(map); return GT_ISP_PE_PREMATURE_EOL; \
-  }
-#define GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL__NEXT() \
-  GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL(); \
-  GT_NEXT_CHAR(text_line)
-#define GT_ISP_PARSE_SAM_ALG_SKIP_FIELD() \
-  GT_READ_UNTIL(text_line,**text_line==TAB); \
-  GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL__NEXT()
-#define GT_ISP_PARSE_SAM_ALG_PARSE_NUMBER(number) \
-  if (!gt_is_number(**text_line)) { gt_map_delete(map); return GT_ISP_PE_EXPECTED_NUMBER; } \
-  GT_PARSE_NUMBER(text_line,number)
 #define GT_ISP_IF_OPT_FIELD(text_line,char1,char2,type_char) { \
   if ((*text_line)[0]==char1 && (*text_line)[1]==char2 && (*text_line)[2]!=EOL && (*text_line)[3]==type_char) {
 #define GT_ISP_END_OPT_FIELD }}
 
+/*
+ * BWA alternative hits
+ *   XA:Z:chr17,-34553512,125M,0;chr17,+34655077,125M,0;
+ *   Each hit is located with a COMA field index {seq_name,strand+position,CIGAR}
+ *   (the hit is closed by the SEMICOLON after the edit distance)
+ */
+#define GT_ISP_XA_SEQ_NAME 0
+#define GT_ISP_XA_POSITION 1
+#define GT_ISP_XA_CIGAR    2
+#define GT_ISP_XA_NUM_FIELDS 3
 GT_INLINE gt_status gt_isp_parse_sam_opt_xa_bwa(
     char** const text_line,gt_alignment* const alignment,
     gt_vector* const maps_vector,gt_sam_pending_end* const pending) {
-  *text_line+=5;
-  while (**text_line!=TAB && **text_line!=EOL) { // Read new attached maps
+  while (**text_line!=TAB && **text_line!=EOL && **text_line!=EOS) { // Read new attached maps
+    gt_field_index xa_index;
+    if (gt_input_field_index_build(&xa_index,*text_line,COMA,GT_ISP_XA_NUM_FIELDS)<GT_ISP_XA_NUM_FIELDS ||
+        *gt_field_index_get_end(&xa_index,GT_ISP_XA_CIGAR)!=COMA) {
+      *text_line = gt_field_index_get_end(&xa_index,xa_index.num_fields-1);
+      return GT_ISP_PE_PREMATURE_EOL;
+    }
     gt_map* map = gt_map_new();
     gt_map_set_base_length(map,gt_alignment_get_read_length(alignment));
     // Sequence-name/Chromosome
-    char* const seq_name = *text_line;
-    GT_READ_UNTIL(text_line,**text_line==COMA);
-    GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL();
-    gt_map_set_seq_name(map,seq_name,*text_line-seq_name);
-    GT_NEXT_CHAR(text_line);
+    gt_map_set_seq_name(map,*text_line,gt_field_index_get_length(&xa_index,GT_ISP_XA_SEQ_NAME));
     // Position
-    if (**text_line==MINUS) {
+    char* const position = gt_field_index_get_begin(&xa_index,GT_ISP_XA_POSITION);
+    if (*position==MINUS) {
       gt_map_set_strand(map,REVERSE);
-      GT_NEXT_CHAR(text_line);
-    } else if (**text_line==PLUS) {
+    } else if (*position==PLUS) {
       gt_map_set_strand(map,FORWARD);
-      GT_NEXT_CHAR(text_line);
     } else {
       gt_map_delete(map);
+      *text_line = position;
       return GT_ISP_PE_BAD_CHARACTER;
     }
-    GT_ISP_PARSE_SAM_ALG_PARSE_NUMBER(map->position);
-    GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL();
-    GT_NEXT_CHAR(text_line);
+    if (!gt_input_parse_field_number(position+1,
+        gt_field_index_get_length(&xa_index,GT_ISP_XA_POSITION)-1,&map->position)) {
+      gt_map_delete(map);
+      *text_line = position+1;
+      return GT_ISP_PE_EXPECTED_NUMBER;
+    }
     // CIGAR // TODO: Parse it !!
-    GT_READ_UNTIL(text_line,**text_line==COMA);
-    GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL();
-    GT_NEXT_CHAR(text_line);
     // Edit distance
-    GT_READ_UNTIL(text_line,**text_line==SEMICOLON);
+    *text_line = gt_field_index_get_end(&xa_index,GT_ISP_XA_CIGAR)+1;
+    GT_READ_UNTIL(text_line,**text_line==SEMICOLON || **text_line==TAB);
     if (**text_line==SEMICOLON) GT_NEXT_CHAR(text_line);
     // Add it to the list
     gt_vector_insert(maps_vector,map,gt_map*);
@@ -461,6 +454,7 @@ GT_INLINE gt_status gt_isp_parse_sam_optional_field(
    */
   GT_ISP_IF_OPT_FIELD(text_line,'X','A','Z') {
     if (!is_mapped) return GT_ISP_PE_SAM_UNMAPPED_XA;
+    *text_line+=5;
     if (gt_isp_parse_sam_opt_xa_bwa(text_line,alignment,maps_vector,pending)) {
       *text_line = init_opt_field;
     }
@@ -477,22 +471,57 @@ GT_INLINE gt_status gt_isp_parse_sam_optional_field(
   return 0;
 }
 
+/*
+ * SAM record (mandatory fields after QNAME)
+ *   All are located at once with a TAB field index, so that each field
+ *   is parsed knowing its extent (no per-character delimiter checks)
+ */
+#define GT_ISP_FIELD_FLAG   0
+#define GT_ISP_FIELD_RNAME  1
+#define GT_ISP_FIELD_POS    2
+#define GT_ISP_FIELD_MAPQ   3
+#define GT_ISP_FIELD_CIGAR  4
+#define GT_ISP_FIELD_RNEXT  5
+#define GT_ISP_FIELD_PNEXT  6
+#define GT_ISP_FIELD_TLEN   7
+#define GT_ISP_FIELD_SEQ    8
+#define GT_ISP_FIELD_QUAL   9
+#define GT_ISP_NUM_FIELDS  10
+
+#define GT_ISP_PARSE_SAM_ALG_FIELD(field_num) gt_field_index_get_begin(&field_index,field_num)
+#define GT_ISP_PARSE_SAM_ALG_FIELD_LENGTH(field_num) gt_field_index_get_length(&field_index,field_num)
+#define GT_ISP_PARSE_SAM_ALG_ERROR(field_num,error_code) { \
+  *text_line = GT_ISP_PARSE_SAM_ALG_FIELD(field_num); \
+  gt_map_delete(map); return error_code; \
+}
+#define GT_ISP_PARSE_SAM_ALG_PARSE_NUMBER(field_num,number) { \
+  uint64_t field_number; \
+  if (!gt_input_parse_field_number(GT_ISP_PARSE_SAM_ALG_FIELD(field_num), \
+      GT_ISP_PARSE_SAM_ALG_FIELD_LENGTH(field_num),&field_number)) { \
+    GT_ISP_PARSE_SAM_ALG_ERROR(field_num,GT_ISP_PE_EXPECTED_NUMBER); \
+  } \
+  number = field_number; \
+}
+
 // TODO: Increase the level of checking SAM consistency
 GT_INLINE gt_status gt_isp_parse_sam_alignment(
     char** const text_line,gt_template* const _template,gt_alignment* const _alignment,
     uint64_t* const alignment_flag,gt_sam_pending_end* const pending,const bool override_pairing) {
   gt_status error_code;
   bool is_mapped = true, is_single_segment;
+  /*
+   * Locate the fields
+   */
+  gt_field_index field_index;
+  if (gt_input_field_index_build(&field_index,*text_line,TAB,GT_ISP_NUM_FIELDS)<GT_ISP_NUM_FIELDS) {
+    *text_line = gt_field_index_get_end(&field_index,field_index.num_fields-1);
+    return GT_ISP_PE_PREMATURE_EOL;
+  }
   gt_map* map = gt_map_new();
   /*
    * Parse FLAG
    */
-  if (!gt_is_number(**text_line)) {
-    gt_map_delete(map);
-    return GT_ISP_PE_EXPECTED_NUMBER;
-  }
-  GT_PARSE_NUMBER(text_line,*alignment_flag);
-  GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL__NEXT();
+  GT_ISP_PARSE_SAM_ALG_PARSE_NUMBER(GT_ISP_FIELD_FLAG,*alignment_flag);
   // Process flags
   const bool reverse_strand = (*alignment_flag&GT_SAM_FLAG_REVERSE_COMPLEMENT);
   is_mapped = !(*alignment_flag&GT_SAM_FLAG_UNMAPPED);
@@ -521,64 +550,50 @@ GT_INLINE gt_status gt_isp_parse_sam_alignment(
   /*
    * Parse RNAME (Sequence-name/Chromosome)
    */
-  char* const seq_name = *text_line;
+  char* const seq_name = GT_ISP_PARSE_SAM_ALG_FIELD(GT_ISP_FIELD_RNAME);
   uint64_t seq_length = 0;
-  if (gt_expect_false(**text_line==STAR)) {
+  if (gt_expect_false(*seq_name==STAR)) {
     is_mapped=false; /* Unmapped */
-    GT_NEXT_CHAR(text_line);
-    GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL__NEXT();
   } else {
-    GT_READ_UNTIL(text_line,**text_line==TAB);
-    GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL();
-    seq_length = *text_line-seq_name;
+    seq_length = GT_ISP_PARSE_SAM_ALG_FIELD_LENGTH(GT_ISP_FIELD_RNAME);
     gt_map_set_seq_name(map,seq_name,seq_length);
-    GT_NEXT_CHAR(text_line);
   }
   /*
    * Parse POS (Position 1-based)
    */
-  GT_ISP_PARSE_SAM_ALG_PARSE_NUMBER(map->position);
+  GT_ISP_PARSE_SAM_ALG_PARSE_NUMBER(GT_ISP_FIELD_POS,map->position);
   if (map->position==0) is_mapped=false; /* Unmapped */
-  GT_NEXT_CHAR(text_line);
   /*
    * Parse MAPQ (Score)
    */
-  GT_ISP_PARSE_SAM_ALG_PARSE_NUMBER(map->phred_score);
-  GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL__NEXT();
+  GT_ISP_PARSE_SAM_ALG_PARSE_NUMBER(GT_ISP_FIELD_MAPQ,map->phred_score);
   /*
    * Parse CIGAR
    */
-  if ((error_code=gt_isp_parse_sam_cigar(text_line,&map,reverse_strand))) {
-    gt_map_delete(map); return error_code;
+  if ((error_code=gt_isp_parse_sam_cigar(GT_ISP_PARSE_SAM_ALG_FIELD(GT_ISP_FIELD_CIGAR),
+      GT_ISP_PARSE_SAM_ALG_FIELD_LENGTH(GT_ISP_FIELD_CIGAR),&map,reverse_strand))) {
+    GT_ISP_PARSE_SAM_ALG_ERROR(GT_ISP_FIELD_CIGAR,error_code);
   }
-  GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL__NEXT();
   /*
    * Parse RNEXT (Sequence-name of the next segment)
    */
-  if (**text_line==STAR || is_single_segment || !is_mapped ||
+  char* const next_seq_name = GT_ISP_PARSE_SAM_ALG_FIELD(GT_ISP_FIELD_RNEXT);
+  if (*next_seq_name==STAR || is_single_segment || !is_mapped ||
       (*alignment_flag&GT_SAM_FLAG_NEXT_UNMAPPED)) {
     gt_string_clear(&pending->next_seq_name);
-    GT_ISP_PARSE_SAM_ALG_SKIP_FIELD(); // RNEXT
-    GT_ISP_PARSE_SAM_ALG_SKIP_FIELD(); // PNEXT
   } else {
     // Parse RNEXT
-    if (**text_line==EQUAL) {
-      gt_string_set_nstring(&pending->next_seq_name,seq_name,seq_length);
-      GT_NEXT_CHAR(text_line);
-      if (**text_line!=TAB) {
-        gt_map_delete(map); return GT_ISP_PE_BAD_CHARACTER;
+    if (*next_seq_name==EQUAL) {
+      if (GT_ISP_PARSE_SAM_ALG_FIELD_LENGTH(GT_ISP_FIELD_RNEXT)!=1) {
+        GT_ISP_PARSE_SAM_ALG_ERROR(GT_ISP_FIELD_RNEXT,GT_ISP_PE_BAD_CHARACTER);
       }
-      GT_NEXT_CHAR(text_line);
+      gt_string_set_nstring(&pending->next_seq_name,seq_name,seq_length);
     } else {
-      char* const next_seq_name = *text_line;
-      GT_READ_UNTIL(text_line,**text_line==TAB);
-      GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL();
-      gt_string_set_nstring(&pending->next_seq_name,next_seq_name,*text_line-next_seq_name);
-      GT_NEXT_CHAR(text_line);
+      gt_string_set_nstring(&pending->next_seq_name,next_seq_name,
+          GT_ISP_PARSE_SAM_ALG_FIELD_LENGTH(GT_ISP_FIELD_RNEXT));
     }
     // Parse PNEXT (Position of the next segment)
-    GT_ISP_PARSE_SAM_ALG_PARSE_NUMBER(pending->next_position);
-    GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL__NEXT();
+    GT_ISP_PARSE_SAM_ALG_PARSE_NUMBER(GT_ISP_FIELD_PNEXT,pending->next_position);
     if (pending->next_position==0) {
       gt_string_clear(&pending->next_seq_name);
     } else {
@@ -588,21 +603,14 @@ GT_INLINE gt_status gt_isp_parse_sam_alignment(
     }
   }
   /*
-   * Parse TLEN (Template Length)
+   * Parse TLEN (Template Length). Skipped
    */
-  GT_ISP_PARSE_SAM_ALG_SKIP_FIELD();
   /*
    * Parse SEQ (READ)
    */
-  if (gt_expect_false(**text_line==STAR)) {
-    GT_NEXT_CHAR(text_line);
-    GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL__NEXT();
-  } else {
-    char* const seq_read = *text_line;
-    GT_READ_UNTIL(text_line,**text_line==TAB);
-    GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL();
-    const uint64_t read_length = *text_line-seq_read;
-    GT_NEXT_CHAR(text_line);
+  char* const seq_read = GT_ISP_PARSE_SAM_ALG_FIELD(GT_ISP_FIELD_SEQ);
+  if (gt_expect_true(*seq_read!=STAR)) {
+    const uint64_t read_length = GT_ISP_PARSE_SAM_ALG_FIELD_LENGTH(GT_ISP_FIELD_SEQ);
     // Set the read
     if (gt_string_is_null(alignment->read)) {
       gt_dna_string_set_nstring(alignment->read,seq_read,read_length);
@@ -631,15 +639,16 @@ GT_INLINE gt_status gt_isp_parse_sam_alignment(
   /*
    * Parse QUAL (QUALITY STRING)
    */
-  GT_ISP_PARSE_SAM_ALG_CHECK_PREMATURE_EOL();
-  if (gt_expect_false(**text_line==STAR && (*((*text_line)+1)==TAB || *((*text_line)+1)==EOL || *((*text_line)+1)==EOS) )) {
-    GT_NEXT_CHAR(text_line);
+  char* const seq_qual = GT_ISP_PARSE_SAM_ALG_FIELD(GT_ISP_FIELD_QUAL);
+  const uint64_t qual_length = GT_ISP_PARSE_SAM_ALG_FIELD_LENGTH(GT_ISP_FIELD_QUAL);
+  if (qual_length==0 && *gt_field_index_get_end(&field_index,GT_ISP_FIELD_QUAL)!=TAB) {
+    GT_ISP_PARSE_SAM_ALG_ERROR(GT_ISP_FIELD_QUAL,GT_ISP_PE_PREMATURE_EOL);
+  }
+  if (gt_expect_false(*seq_qual==STAR && qual_length==1)) {
+    // No qualities
   } else {
-    char* const seq_qual = *text_line;
-    GT_READ_UNTIL(text_line,**text_line==TAB);
-    const uint64_t read_length = *text_line-seq_qual;
     if (gt_string_is_null(alignment->qualities)) {
-      gt_string_set_nstring(alignment->qualities,seq_qual,read_length);
+      gt_string_set_nstring(alignment->qualities,seq_qual,qual_length);
       if (reverse_strand) {
         gt_string_reverse(alignment->qualities);
       }
@@ -649,6 +658,7 @@ GT_INLINE gt_status gt_isp_parse_sam_alignment(
   if (!gt_string_is_null(alignment->read) && !gt_string_is_null(alignment->qualities)) {
     gt_fatal_check(gt_string_get_length(alignment->read)!=gt_string_get_length(alignment->qualities),ALIGNMENT_READ_QUAL_LENGTH);
   }
+  *text_line = gt_field_index_get_end(&field_index,GT_ISP_FIELD_QUAL);
   // Build a list of alignments
   gt_vector *maps_vector = NULL;
   if (is_mapped) {
@@ -721,6 +731,7 @@ GT_INLINE void gt_isp_add_mmap(
     map_end[0] = (pending_maps_end1>1) ? mmap_end1[i] : mmap_end1[0];
     map_end[1] = (pending_maps_end2>1) ? mmap_end2[i] : mmap_end2[0];
     attr.distance = gt_map_get_global_distance(map_end[0])+gt_map_get_global_distance(map_end[1]);
+    attr.gt_score = GT_MAP_NO_GT_SCORE;
     attr.phred_score = GT_MAP_NO_PHRED_SCORE;
     gt_template_inc_counter(template,attr.distance);
     gt_template_add_mmap_ends(template,map_end[0],map_end[1],&attr);
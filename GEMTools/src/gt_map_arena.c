@@ -0,0 +1,64 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_map_arena.c
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Per-thread arena of maps for parsing
+ */
+
+#include "gt_map_arena.h"
+
+#define GT_MAP_ARENA_NUM_INITIAL_MAPS 1000
+
+/*
+ * Setup
+ */
+GT_INLINE gt_map_arena* gt_map_arena_new(void) {
+  gt_map_arena* const map_arena = gt_alloc(gt_map_arena);
+  map_arena->maps = gt_vector_new(GT_MAP_ARENA_NUM_INITIAL_MAPS,sizeof(gt_map*));
+  map_arena->next_map = 0;
+  return map_arena;
+}
+GT_INLINE void gt_map_arena_clear(gt_map_arena* const map_arena) {
+  GT_MAP_ARENA_CHECK(map_arena);
+  map_arena->next_map = 0; // Maps are cleared as they get recycled
+}
+GT_INLINE void gt_map_arena_delete(gt_map_arena* const map_arena) {
+  GT_MAP_ARENA_CHECK(map_arena);
+  GT_VECTOR_ITERATE(map_arena->maps,map,map_pos,gt_map*) {
+    (*map)->arena_allocated = false;
+    gt_map_block_delete(*map);
+  }
+  gt_vector_delete(map_arena->maps);
+  gt_free(map_arena);
+}
+
+/*
+ * Allocation
+ */
+GT_INLINE gt_map* gt_map_arena_alloc(gt_map_arena* const map_arena) {
+  GT_MAP_ARENA_CHECK(map_arena);
+  gt_map* map;
+  if (gt_expect_true(map_arena->next_map < gt_vector_get_used(map_arena->maps))) {
+    map = *gt_vector_get_elm(map_arena->maps,map_arena->next_map,gt_map*);
+    gt_map_clear(map);
+  } else {
+    map = gt_map_new();
+    map->arena_allocated = true;
+    gt_vector_insert(map_arena->maps,map,gt_map*);
+  }
+  ++(map_arena->next_map);
+  return map;
+}
+
+/*
+ * Accessors
+ */
+GT_INLINE uint64_t gt_map_arena_get_num_maps(gt_map_arena* const map_arena) {
+  GT_MAP_ARENA_CHECK(map_arena);
+  return map_arena->next_map;
+}
+GT_INLINE uint64_t gt_map_arena_get_num_allocated(gt_map_arena* const map_arena) {
+  GT_MAP_ARENA_CHECK(map_arena);
+  return gt_vector_get_used(map_arena->maps);
+}
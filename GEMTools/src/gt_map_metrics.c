@@ -201,7 +201,7 @@ GT_INLINE void gt_map_get_last_block__acc_base_length(gt_map* const map,gt_map**
 GT_INLINE int64_t gt_map_get_observed_template_size(gt_map* const map_a,gt_map* const map_b) {
   GT_MAP_CHECK(map_a);
   GT_MAP_CHECK(map_b);
-  if (gt_expect_false(!gt_string_equals(map_a->seq_name,map_b->seq_name))) return 0;
+  if (gt_expect_false(map_a->seq_name_id!=map_b->seq_name_id)) return 0;
   gt_map *right_block_a, *right_block_b;
   gt_map *left_block_a,  *left_block_b;
   uint64_t map_length_a, map_length_b;
@@ -259,7 +259,7 @@ GT_INLINE int64_t gt_map_sm_cmp(gt_map* const map_1,gt_map* const map_2) {
 }
 GT_INLINE int64_t gt_map_cmp(gt_map* const map_1,gt_map* const map_2) {
   GT_MAP_CHECK(map_1); GT_MAP_CHECK(map_2);
-  if (gt_string_cmp(map_1->seq_name,map_2->seq_name)!=0) {
+  if (map_1->seq_name_id!=map_2->seq_name_id) {
     return 1;
   } else {
     if (map_1->strand==map_2->strand) {
@@ -295,7 +295,7 @@ GT_INLINE int64_t gt_map_range_sm_cmp(gt_map* const map_1,gt_map* const map_2,co
 }
 GT_INLINE int64_t gt_map_range_cmp(gt_map* const map_1,gt_map* const map_2,const uint64_t range_tolerated) {
   GT_MAP_CHECK(map_1); GT_MAP_CHECK(map_2);
-  int64_t cmp_tags = gt_string_cmp(map_1->seq_name,map_2->seq_name);
+  int64_t cmp_tags = gt_seq_name_cmp(map_1->seq_name_id,map_2->seq_name_id);
   if (cmp_tags!=0) {
     return cmp_tags;
   } else {
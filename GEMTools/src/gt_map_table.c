@@ -0,0 +1,218 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_map_table.c
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Compact (structure-of-arrays) read-only view of the maps of templates/alignments
+ */
+
+#include "gt_map_table.h"
+
+#define GT_MAP_TABLE_NUM_INITIAL_BLOCKS 64
+#define GT_MAP_TABLE_NUM_INITIAL_MISMS 256
+
+/*
+ * Setup
+ */
+GT_INLINE gt_map_table* gt_map_table_new(void) {
+  gt_map_table* const map_table = gt_alloc(gt_map_table);
+  // Map blocks
+  map_table->seq_name_id = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(uint32_t));
+  map_table->position = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(uint64_t));
+  map_table->base_length = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(uint64_t));
+  map_table->strand = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(uint8_t));
+  map_table->junction = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(uint8_t));
+  map_table->junction_size = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(int64_t));
+  map_table->misms_offset = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS+1,sizeof(uint64_t));
+  // Maps
+  map_table->block_offset = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS+1,sizeof(uint64_t));
+  map_table->end_position = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(uint8_t));
+  map_table->distance = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(uint64_t));
+  map_table->gt_score = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(uint64_t));
+  map_table->phred_score = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(uint8_t));
+  // MMaps
+  map_table->mmap_end1 = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(uint64_t));
+  map_table->mmap_end2 = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(uint64_t));
+  map_table->mmap_attributes = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(gt_mmap_attributes));
+  // Mismatches
+  map_table->misms = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_MISMS,sizeof(gt_misms));
+  // Internals
+  map_table->map_index = gt_vector_new(GT_MAP_TABLE_NUM_INITIAL_BLOCKS,sizeof(gt_map_table_map_index));
+  gt_map_table_clear(map_table);
+  return map_table;
+}
+GT_INLINE void gt_map_table_clear(gt_map_table* const map_table) {
+  GT_NULL_CHECK(map_table);
+  // Map blocks
+  gt_vector_clear(map_table->seq_name_id);
+  gt_vector_clear(map_table->position);
+  gt_vector_clear(map_table->base_length);
+  gt_vector_clear(map_table->strand);
+  gt_vector_clear(map_table->junction);
+  gt_vector_clear(map_table->junction_size);
+  gt_vector_clear(map_table->misms_offset);
+  gt_vector_insert(map_table->misms_offset,0,uint64_t);
+  // Maps
+  gt_vector_clear(map_table->block_offset);
+  gt_vector_insert(map_table->block_offset,0,uint64_t);
+  gt_vector_clear(map_table->end_position);
+  gt_vector_clear(map_table->distance);
+  gt_vector_clear(map_table->gt_score);
+  gt_vector_clear(map_table->phred_score);
+  // MMaps
+  gt_vector_clear(map_table->mmap_end1);
+  gt_vector_clear(map_table->mmap_end2);
+  gt_vector_clear(map_table->mmap_attributes);
+  // Mismatches
+  gt_vector_clear(map_table->misms);
+}
+GT_INLINE void gt_map_table_delete(gt_map_table* const map_table) {
+  GT_MAP_TABLE_CHECK(map_table);
+  // Map blocks
+  gt_vector_delete(map_table->seq_name_id);
+  gt_vector_delete(map_table->position);
+  gt_vector_delete(map_table->base_length);
+  gt_vector_delete(map_table->strand);
+  gt_vector_delete(map_table->junction);
+  gt_vector_delete(map_table->junction_size);
+  gt_vector_delete(map_table->misms_offset);
+  // Maps
+  gt_vector_delete(map_table->block_offset);
+  gt_vector_delete(map_table->end_position);
+  gt_vector_delete(map_table->distance);
+  gt_vector_delete(map_table->gt_score);
+  gt_vector_delete(map_table->phred_score);
+  // MMaps
+  gt_vector_delete(map_table->mmap_end1);
+  gt_vector_delete(map_table->mmap_end2);
+  gt_vector_delete(map_table->mmap_attributes);
+  // Mismatches
+  gt_vector_delete(map_table->misms);
+  // Internals
+  gt_vector_delete(map_table->map_index);
+  gt_free(map_table);
+}
+
+/*
+ * Loading
+ */
+GT_INLINE void gt_map_table_add_block(gt_map_table* const map_table,gt_map* const map_block) {
+  gt_vector_insert(map_table->seq_name_id,gt_map_get_seq_name_id(map_block),uint32_t);
+  gt_vector_insert(map_table->position,gt_map_get_position(map_block),uint64_t);
+  gt_vector_insert(map_table->base_length,gt_map_get_base_length(map_block),uint64_t);
+  gt_vector_insert(map_table->strand,gt_map_get_strand(map_block),uint8_t);
+  if (gt_map_has_next_block(map_block)) {
+    gt_vector_insert(map_table->junction,gt_map_get_junction(map_block),uint8_t);
+    gt_vector_insert(map_table->junction_size,gt_map_get_junction_size(map_block),int64_t);
+  } else {
+    gt_vector_insert(map_table->junction,NO_JUNCTION,uint8_t);
+    gt_vector_insert(map_table->junction_size,0,int64_t);
+  }
+  // Mismatches
+  const uint64_t num_misms = gt_map_get_num_misms(map_block);
+  if (num_misms>0) {
+    gt_vector_reserve_additional(map_table->misms,num_misms);
+    memcpy(gt_vector_get_free_elm(map_table->misms,gt_misms),
+        gt_vector_get_mem(map_block->mismatches,gt_misms),num_misms*sizeof(gt_misms));
+    gt_vector_add_used(map_table->misms,num_misms);
+  }
+  gt_vector_insert(map_table->misms_offset,gt_vector_get_used(map_table->misms),uint64_t);
+}
+GT_INLINE uint64_t gt_map_table_add_map(gt_map_table* const map_table,gt_map* const map,const uint64_t end_position) {
+  GT_MAP_TABLE_CHECK(map_table);
+  GT_MAP_CHECK(map);
+  const uint64_t map_num = gt_map_table_get_num_maps(map_table);
+  GT_MAP_ITERATE(map,map_block) {
+    gt_map_table_add_block(map_table,map_block);
+  }
+  gt_vector_insert(map_table->block_offset,gt_vector_get_used(map_table->position),uint64_t);
+  gt_vector_insert(map_table->end_position,end_position,uint8_t);
+  gt_vector_insert(map_table->distance,gt_map_get_global_distance(map),uint64_t);
+  gt_vector_insert(map_table->gt_score,map->gt_score,uint64_t);
+  gt_vector_insert(map_table->phred_score,map->phred_score,uint8_t);
+  return map_num;
+}
+GT_INLINE void gt_map_table_add_alignment(gt_map_table* const map_table,gt_alignment* const alignment,const uint64_t end_position) {
+  GT_MAP_TABLE_CHECK(map_table);
+  GT_ALIGNMENT_CHECK(alignment);
+  GT_ALIGNMENT_ITERATE(alignment,map) {
+    gt_map_table_add_map(map_table,map,end_position);
+  }
+}
+int gt_map_table_map_index_cmp(const gt_map_table_map_index* const a,const gt_map_table_map_index* const b) {
+  return (a->map > b->map) - (a->map < b->map);
+}
+GT_INLINE uint64_t gt_map_table_map_index_lookup(gt_map_table* const map_table,gt_map* const map) {
+  if (map==NULL) return GT_MAP_TABLE_NO_MAP;
+  const gt_map_table_map_index key = { .map=map };
+  gt_map_table_map_index* const found = bsearch(&key,gt_vector_get_mem(map_table->map_index,gt_map_table_map_index),
+      gt_vector_get_used(map_table->map_index),sizeof(gt_map_table_map_index),
+      (int (*)(const void*,const void*))gt_map_table_map_index_cmp);
+  return (found!=NULL) ? found->map_num : GT_MAP_TABLE_NO_MAP;
+}
+GT_INLINE void gt_map_table_add_template(gt_map_table* const map_table,gt_template* const template) {
+  GT_MAP_TABLE_CHECK(map_table);
+  GT_TEMPLATE_CHECK(template);
+  GT_TEMPLATE_IF_REDUCES_TO_ALINGMENT(template,alignment) {
+    gt_map_table_add_alignment(map_table,alignment,0);
+  } GT_TEMPLATE_END_REDUCTION__RETURN;
+  // Add the maps of both ends (indexed by address)
+  gt_vector_clear(map_table->map_index);
+  uint64_t end_position;
+  for (end_position=0;end_position<2;++end_position) {
+    gt_alignment* const alignment = gt_template_get_block(template,end_position);
+    GT_ALIGNMENT_ITERATE(alignment,map) {
+      gt_vector_reserve_additional(map_table->map_index,1);
+      gt_map_table_map_index* const map_index = gt_vector_get_free_elm(map_table->map_index,gt_map_table_map_index);
+      map_index->map = map;
+      map_index->map_num = gt_map_table_add_map(map_table,map,end_position);
+      gt_vector_inc_used(map_table->map_index);
+    }
+  }
+  qsort(gt_vector_get_mem(map_table->map_index,gt_map_table_map_index),gt_vector_get_used(map_table->map_index),
+      sizeof(gt_map_table_map_index),(int (*)(const void*,const void*))gt_map_table_map_index_cmp);
+  // Add the mmaps (as pairs of map indexes)
+  GT_TEMPLATE_ITERATE_MMAP__ATTR_(template,mmap,mmap_attributes) {
+    gt_vector_insert(map_table->mmap_end1,gt_map_table_map_index_lookup(map_table,mmap[0]),uint64_t);
+    gt_vector_insert(map_table->mmap_end2,gt_map_table_map_index_lookup(map_table,mmap[1]),uint64_t);
+    gt_vector_insert(map_table->mmap_attributes,*mmap_attributes,gt_mmap_attributes);
+  }
+}
+
+/*
+ * Accessors
+ */
+GT_INLINE uint64_t gt_map_table_get_num_blocks(gt_map_table* const map_table) {
+  GT_MAP_TABLE_CHECK(map_table);
+  return gt_vector_get_used(map_table->position);
+}
+GT_INLINE uint64_t gt_map_table_get_num_maps(gt_map_table* const map_table) {
+  GT_MAP_TABLE_CHECK(map_table);
+  return gt_vector_get_used(map_table->end_position);
+}
+GT_INLINE uint64_t gt_map_table_get_num_mmaps(gt_map_table* const map_table) {
+  GT_MAP_TABLE_CHECK(map_table);
+  return gt_vector_get_used(map_table->mmap_end1);
+}
+GT_INLINE uint64_t gt_map_table_get_num_misms(gt_map_table* const map_table) {
+  GT_MAP_TABLE_CHECK(map_table);
+  return gt_vector_get_used(map_table->misms);
+}
+GT_INLINE uint64_t gt_map_table_get_map_num_blocks(gt_map_table* const map_table,const uint64_t map_num) {
+  GT_MAP_TABLE_CHECK(map_table);
+  const uint64_t* const block_offset = gt_vector_get_elm(map_table->block_offset,map_num,uint64_t);
+  return block_offset[1]-block_offset[0];
+}
+GT_INLINE uint64_t gt_map_table_get_map_first_block(gt_map_table* const map_table,const uint64_t map_num) {
+  GT_MAP_TABLE_CHECK(map_table);
+  return *gt_vector_get_elm(map_table->block_offset,map_num,uint64_t);
+}
+GT_INLINE uint64_t gt_map_table_get_block_num_misms(gt_map_table* const map_table,const uint64_t block_num) {
+  GT_MAP_TABLE_CHECK(map_table);
+  const uint64_t* const misms_offset = gt_vector_get_elm(map_table->misms_offset,block_num,uint64_t);
+  return misms_offset[1]-misms_offset[0];
+}
+GT_INLINE gt_misms* gt_map_table_get_block_misms(gt_map_table* const map_table,const uint64_t block_num) {
+  GT_MAP_TABLE_CHECK(map_table);
+  return gt_vector_get_mem(map_table->misms,gt_misms)+*gt_vector_get_elm(map_table->misms_offset,block_num,uint64_t);
+}
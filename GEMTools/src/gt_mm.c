@@ -41,6 +41,35 @@
   #define MAP_POPULATE 0 // TODO: disable for mac compatibility
 #endif
 
+#ifndef MADV_HUGEPAGE
+  #define MADV_HUGEPAGE MADV_NORMAL // No transparent huge pages
+#endif
+
+// NUMA memory policies (numaif.h, without depending on libnuma)
+#ifdef __LINUX__
+  #include <sys/syscall.h>
+#endif
+#ifndef MPOL_DEFAULT
+  #define MPOL_DEFAULT 0
+#endif
+#ifndef MPOL_INTERLEAVE
+  #define MPOL_INTERLEAVE 3
+#endif
+#ifndef MPOL_MF_MOVE
+  #define MPOL_MF_MOVE (1<<1)
+#endif
+#ifndef MPOL_F_MEMS_ALLOWED
+  #define MPOL_F_MEMS_ALLOWED (1<<2)
+#endif
+#define GT_MM_NUMA_MAX_NODES 1024
+
+// Heap usage (mallinfo2 since glibc 2.33)
+#include <sys/resource.h>
+#if defined(__GLIBC__) && (__GLIBC__>2 || (__GLIBC__==2 && __GLIBC_MINOR__>=33))
+  #include <malloc.h>
+  #define GT_MM_HAVE_MALLINFO2
+#endif
+
 /*
  * Memory Alignment Utils
  */
@@ -137,6 +166,9 @@ GT_INLINE gt_mm* gt_mm_bulk_mmalloc(const uint64_t num_bytes,const bool use_huge
   GT_ZERO_CHECK(num_bytes);
   // Allocate handler
   gt_mm* const mm = gt_alloc(gt_mm);
+  // Huge pages are unmapped in whole pages
+  const uint64_t mm_size = (use_huge_pages) ?
+      ((num_bytes+GT_MM_HUGE_PAGE_SIZE-1)/GT_MM_HUGE_PAGE_SIZE)*GT_MM_HUGE_PAGE_SIZE : num_bytes;
   /*
    * MMap memory (anonymous)
    *   - MAP_PRIVATE => Fits in RAM+SWAP
@@ -149,15 +181,22 @@ GT_INLINE gt_mm* gt_mm_bulk_mmalloc(const uint64_t num_bytes,const bool use_huge
    *       to consume all the free RAM and swap on the system, eventually
    *       triggering the OOM killer (Linux) or causing a SIGSEGV.
    */
-  int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
-  if (use_huge_pages) flags |= MAP_HUGETLB;
-  mm->memory = mmap(0,num_bytes,PROT_READ|PROT_WRITE,flags,-1,0);
-  gt_cond_fatal_error__perror(mm->memory==MAP_FAILED,MEM_ALLOC_MMAP_FAIL,num_bytes);
+  const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+  mm->memory = MAP_FAILED;
+  if (use_huge_pages && MAP_HUGETLB!=0) {
+    // Reserved (so it fails here, not faulting later, if the system lacks huge pages)
+    mm->memory = mmap(0,mm_size,PROT_READ|PROT_WRITE,(flags&~MAP_NORESERVE)|MAP_HUGETLB,-1,0);
+  }
+  if (mm->memory==MAP_FAILED) { // Regular pages (transparent huge pages, if requested)
+    mm->memory = mmap(0,mm_size,PROT_READ|PROT_WRITE,flags,-1,0);
+    gt_cond_fatal_error__perror(mm->memory==MAP_FAILED,MEM_ALLOC_MMAP_FAIL,num_bytes);
+    if (use_huge_pages) gt_mm_advise_huge_pages(mm->memory,mm_size);
+  }
   mm->cursor = mm->memory;
   // Set MM
   mm->mem_type = GT_MM_MMAPPED;
   mm->mode = GT_MM_READ_WRITE;
-  mm->allocated = num_bytes;
+  mm->allocated = mm_size;
   mm->fd = -1;
   mm->file_name = NULL;
   // GT_MM_PRINT_MEM_ALIGMENT(mm->memory); // Debug
@@ -307,6 +346,183 @@ GT_INLINE gt_mm* gt_mm_bulk_mload_file(char* const file_name,const uint64_t num_
   return mm;
 }
 
+/*
+ * NUMA & Huge Pages
+ */
+GT_INLINE void gt_mm_advise_huge_pages(void* const memory,const uint64_t num_bytes) {
+  // Only the huge pages fully within the buffer
+  const uintptr_t begin = (GT_MM_CAST_ADDR(memory)+GT_MM_HUGE_PAGE_SIZE-1) & ~((uintptr_t)GT_MM_HUGE_PAGE_SIZE-1);
+  const uintptr_t end = (GT_MM_CAST_ADDR(memory)+num_bytes) & ~((uintptr_t)GT_MM_HUGE_PAGE_SIZE-1);
+  if (begin < end) madvise((void*)begin,end-begin,MADV_HUGEPAGE); // Best effort
+}
+GT_INLINE bool gt_mm_numa_get_allowed_nodes(unsigned long* const node_mask) {
+#ifdef SYS_get_mempolicy
+  memset(node_mask,0,GT_MM_NUMA_MAX_NODES/8);
+  return syscall(SYS_get_mempolicy,NULL,node_mask,GT_MM_NUMA_MAX_NODES,NULL,MPOL_F_MEMS_ALLOWED)==0;
+#else
+  return false;
+#endif
+}
+uint64_t gt_mm_numa_num_nodes = 0; // Cached (Constant)
+GT_INLINE uint64_t gt_mm_numa_get_num_nodes(void) {
+  if (gt_expect_false(gt_mm_numa_num_nodes==0)) {
+    unsigned long node_mask[GT_MM_NUMA_MAX_NODES/(8*sizeof(unsigned long))];
+    uint64_t i, allowed_nodes = 0;
+    if (gt_mm_numa_get_allowed_nodes(node_mask)) {
+      for (i=0;i<GT_MM_NUMA_MAX_NODES/(8*sizeof(unsigned long));++i) {
+        allowed_nodes += __builtin_popcountl(node_mask[i]);
+      }
+    }
+    gt_mm_numa_num_nodes = GT_MAX(allowed_nodes,1);
+  }
+  return gt_mm_numa_num_nodes;
+}
+GT_INLINE int64_t gt_mm_numa_get_node(void) {
+#ifdef SYS_getcpu
+  unsigned int cpu, node;
+  if (syscall(SYS_getcpu,&cpu,&node,NULL)==0) return node;
+#endif
+  return GT_MM_NUMA_NO_NODE;
+}
+GT_INLINE void gt_mm_numa_interleave(void* const memory,const uint64_t num_bytes) {
+#ifdef SYS_mbind
+  if (gt_mm_numa_get_num_nodes() < 2) return;
+  unsigned long node_mask[GT_MM_NUMA_MAX_NODES/(8*sizeof(unsigned long))];
+  if (!gt_mm_numa_get_allowed_nodes(node_mask)) return;
+  // Whole pages within the buffer (pages already touched are moved)
+  const uint64_t page_size = getpagesize();
+  const uintptr_t begin = (GT_MM_CAST_ADDR(memory)+page_size-1) & ~((uintptr_t)page_size-1);
+  const uintptr_t end = (GT_MM_CAST_ADDR(memory)+num_bytes) & ~((uintptr_t)page_size-1);
+  if (begin < end) {
+    syscall(SYS_mbind,begin,end-begin,MPOL_INTERLEAVE,node_mask,GT_MM_NUMA_MAX_NODES,MPOL_MF_MOVE); // Best effort
+  }
+#endif
+}
+GT_INLINE void gt_mm_numa_interleave_thread(const bool interleave) {
+#ifdef SYS_set_mempolicy
+  if (gt_mm_numa_get_num_nodes() < 2) return;
+  if (interleave) {
+    unsigned long node_mask[GT_MM_NUMA_MAX_NODES/(8*sizeof(unsigned long))];
+    if (!gt_mm_numa_get_allowed_nodes(node_mask)) return;
+    syscall(SYS_set_mempolicy,MPOL_INTERLEAVE,node_mask,GT_MM_NUMA_MAX_NODES); // Best effort
+  } else {
+    syscall(SYS_set_mempolicy,MPOL_DEFAULT,NULL,0);
+  }
+#endif
+}
+
+/*
+ * Memory Accounting & Budget
+ */
+typedef struct {
+  volatile uint64_t current;
+  volatile uint64_t peak;
+} gt_mm_acc_counter;
+gt_mm_acc_counter gt_mm_acc_counters[GT_MM_ACC_NUM_CATEGORIES];
+gt_mm_acc_counter gt_mm_acc_total;
+uint64_t gt_mm_acc_budget = 0; // Unbounded
+const char* const gt_mm_acc_category_label[GT_MM_ACC_NUM_CATEGORIES] = {
+  [GT_MM_ACC_INPUT_BUFFERS] = "InputBuffers",
+  [GT_MM_ACC_OUTPUT_BUFFERS] = "OutputBuffers",
+  [GT_MM_ACC_TEMPLATES] = "Templates",
+  [GT_MM_ACC_GTF] = "GTF",
+  [GT_MM_ACC_ARCHIVE] = "Archive",
+  [GT_MM_ACC_STATS] = "Stats",
+};
+
+GT_INLINE void gt_mm_acc_counter_add(gt_mm_acc_counter* const counter,const uint64_t num_bytes) {
+  const uint64_t current = __sync_add_and_fetch(&counter->current,num_bytes);
+  uint64_t peak = counter->peak;
+  while (current > peak) {
+    const uint64_t prev_peak = __sync_val_compare_and_swap(&counter->peak,peak,current);
+    if (prev_peak==peak) break;
+    peak = prev_peak;
+  }
+}
+GT_INLINE void gt_mm_acc_add(const gt_mm_acc_category category,const uint64_t num_bytes) {
+  gt_mm_acc_counter_add(gt_mm_acc_counters+category,num_bytes);
+  gt_mm_acc_counter_add(&gt_mm_acc_total,num_bytes);
+}
+GT_INLINE void gt_mm_acc_sub(const gt_mm_acc_category category,const uint64_t num_bytes) {
+  __sync_sub_and_fetch(&gt_mm_acc_counters[category].current,num_bytes);
+  __sync_sub_and_fetch(&gt_mm_acc_total.current,num_bytes);
+}
+GT_INLINE void gt_mm_acc_resize(const gt_mm_acc_category category,const uint64_t old_num_bytes,const uint64_t new_num_bytes) {
+  if (new_num_bytes > old_num_bytes) {
+    gt_mm_acc_add(category,new_num_bytes-old_num_bytes);
+  } else if (new_num_bytes < old_num_bytes) {
+    gt_mm_acc_sub(category,old_num_bytes-new_num_bytes);
+  }
+}
+GT_INLINE void gt_mm_acc_update(const gt_mm_acc_category category,uint64_t* const accounted_bytes,const uint64_t num_bytes) {
+  GT_NULL_CHECK(accounted_bytes);
+  gt_mm_acc_resize(category,*accounted_bytes,num_bytes);
+  *accounted_bytes = num_bytes;
+}
+// Usage
+GT_INLINE uint64_t gt_mm_acc_get_current(const gt_mm_acc_category category) {
+  return gt_mm_acc_counters[category].current;
+}
+GT_INLINE uint64_t gt_mm_acc_get_peak(const gt_mm_acc_category category) {
+  return gt_mm_acc_counters[category].peak;
+}
+GT_INLINE uint64_t gt_mm_acc_get_total_current(void) {
+  return gt_mm_acc_total.current;
+}
+GT_INLINE uint64_t gt_mm_acc_get_total_peak(void) {
+  return gt_mm_acc_total.peak;
+}
+GT_INLINE uint64_t gt_mm_acc_get_heap_usage(void) {
+#ifdef GT_MM_HAVE_MALLINFO2
+  const struct mallinfo2 heap_info = mallinfo2();
+  return heap_info.uordblks+heap_info.hblkhd; // Chunks in use + mmapped chunks
+#else
+  return 0;
+#endif
+}
+GT_INLINE uint64_t gt_mm_acc_get_peak_rss(void) {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF,&usage)!=0) return 0;
+  return (uint64_t)usage.ru_maxrss*1024; // KB
+}
+// Budget
+GT_INLINE void gt_mm_acc_set_budget(const uint64_t num_bytes) {
+  gt_mm_acc_budget = num_bytes;
+}
+GT_INLINE uint64_t gt_mm_acc_get_budget(void) {
+  return gt_mm_acc_budget;
+}
+GT_INLINE uint64_t gt_mm_acc_get_usage(void) {
+  // Accounted memory outside the heap (mmapped) also counts, so take the largest
+  const uint64_t accounted = gt_mm_acc_get_total_current();
+  const uint64_t heap_usage = gt_mm_acc_get_heap_usage();
+  return GT_MAX(accounted,heap_usage);
+}
+GT_INLINE bool gt_mm_acc_is_over_budget(void) {
+  if (gt_expect_true(gt_mm_acc_budget==0)) return false;
+  return gt_mm_acc_get_usage() > gt_mm_acc_budget;
+}
+GT_INLINE bool gt_mm_acc_fits_budget(const uint64_t num_bytes) {
+  if (gt_expect_true(gt_mm_acc_budget==0)) return true;
+  return gt_mm_acc_get_usage()+num_bytes <= gt_mm_acc_budget;
+}
+// Display
+#define GT_MM_ACC_MB(num_bytes) ((double)(num_bytes)/(1024.0*1024.0))
+GT_INLINE void gt_mm_acc_print(FILE* const stream) {
+  GT_NULL_CHECK(stream);
+  fprintf(stream,"[Memory] Accounted %.1f MB (peak %.1f MB). Heap %.1f MB. Max.RSS %.1f MB",
+      GT_MM_ACC_MB(gt_mm_acc_get_total_current()),GT_MM_ACC_MB(gt_mm_acc_get_total_peak()),
+      GT_MM_ACC_MB(gt_mm_acc_get_heap_usage()),GT_MM_ACC_MB(gt_mm_acc_get_peak_rss()));
+  if (gt_mm_acc_budget>0) fprintf(stream,". Budget %.1f MB",GT_MM_ACC_MB(gt_mm_acc_budget));
+  fprintf(stream,"\n");
+  uint64_t i;
+  for (i=0;i<GT_MM_ACC_NUM_CATEGORIES;++i) {
+    if (gt_mm_acc_counters[i].peak==0) continue;
+    fprintf(stream,"  --> %-14s %10.1f MB (peak %.1f MB)\n",gt_mm_acc_category_label[i],
+        GT_MM_ACC_MB(gt_mm_acc_counters[i].current),GT_MM_ACC_MB(gt_mm_acc_counters[i].peak));
+  }
+}
+
 /*
  * Accessors
  */
@@ -546,7 +762,405 @@ GT_INLINE void gt_mm_write_mem(gt_mm* const mm,void* const src,const uint64_t nu
  *   Objects of a certain type are ready to go inside the slab, thus reducing
  *   the overhead of malloc/setup/free cycles along the program
  */
-//GT_INLINE void* gt_mm_slab_mmalloc(gt_mm_slab* const slab,const uint64_t num_elements); // TODO
-//GT_INLINE void gt_mm_slab_mfree(gt_mm_slab* const slab,void* mem_addr,const uint64_t num_elements); // TODO
+#define GT_MM_SLAB_UNIT_HEADER_SIZE ((sizeof(gt_mm_slab_unit)+15) & ~((uint64_t)15))
+#define GT_MM_SLAB_IS_OWNER(slab) pthread_equal((slab)->owner,pthread_self())
+GT_INLINE uint64_t gt_mm_slab_unit_capacity(const uint64_t element_size,uint64_t* const num_words) {
+  // Elements fitting in the unit after the header and the occupancy map
+  uint64_t total_elements = (GT_MM_SLAB_UNIT_SIZE-GT_MM_SLAB_UNIT_HEADER_SIZE)/element_size;
+  const uint64_t words = (total_elements+63)/64;
+  const uint64_t offset = (GT_MM_SLAB_UNIT_HEADER_SIZE+words*8+15) & ~((uint64_t)15);
+  total_elements = (GT_MM_SLAB_UNIT_SIZE-offset)/element_size;
+  if (num_words!=NULL) *num_words = words;
+  return total_elements;
+}
+GT_INLINE gt_mm_slab* gt_mm_slab_allocate(uint64_t element_size,gt_mm_pool* const mm_pool) {
+  GT_ZERO_CHECK(element_size);
+  element_size = (element_size+GT_MM_SLAB_MIN_ELEMENT_SIZE-1) & ~((uint64_t)GT_MM_SLAB_MIN_ELEMENT_SIZE-1);
+  gt_cond_fatal_error(gt_mm_slab_unit_capacity(element_size,NULL)==0,MEM_SLAB_ELEMENTS,(uint64_t)1,element_size);
+  gt_mm_slab* const slab = gt_alloc(gt_mm_slab);
+  slab->element_size = element_size;
+  slab->free_units = NULL;
+  slab->units = NULL;
+  slab->num_units = 0;
+  slab->num_empty_units = 0;
+  slab->mm_pool = mm_pool;
+  slab->owner = pthread_self();
+  slab->remote_frees = NULL;
+  slab->page_size = sysconf(_SC_PAGESIZE);
+  return slab;
+}
+/*
+ * Slab units
+ */
+GT_INLINE void gt_mm_slab_link_free_unit(gt_mm_slab* const slab,gt_mm_slab_unit* const unit) {
+  unit->prev = NULL;
+  unit->next = slab->free_units;
+  if (slab->free_units!=NULL) slab->free_units->prev = unit;
+  slab->free_units = unit;
+}
+GT_INLINE void gt_mm_slab_unlink_free_unit(gt_mm_slab* const slab,gt_mm_slab_unit* const unit) {
+  if (unit->prev!=NULL) unit->prev->next = unit->next;
+  else slab->free_units = unit->next;
+  if (unit->next!=NULL) unit->next->prev = unit->prev;
+}
+GT_INLINE gt_mm_slab_unit* gt_mm_slab_add_unit(gt_mm_slab* const slab) {
+  // Get unit memory
+  void* unit_memory;
+  if (slab->mm_pool!=NULL) {
+    unit_memory = gt_mm_pool_get_unit(slab->mm_pool);
+  } else {
+    gt_cond_fatal_error(posix_memalign(&unit_memory,GT_MM_SLAB_UNIT_SIZE,GT_MM_SLAB_UNIT_SIZE),
+        MEM_ALLOC_INFO,(uint64_t)GT_MM_SLAB_UNIT_SIZE);
+    gt_mm_acc_add(GT_MM_ACC_TEMPLATES,GT_MM_SLAB_UNIT_SIZE);
+  }
+  // Setup unit (header + occupancy map + elements)
+  gt_mm_slab_unit* const unit = (gt_mm_slab_unit*)unit_memory;
+  uint64_t num_words;
+  unit->slab = slab;
+  unit->element_size = slab->element_size;
+  unit->total_elements = gt_mm_slab_unit_capacity(slab->element_size,&num_words);
+  unit->allocated_elements = 0;
+  unit->free_word_hint = 0;
+  unit->occupancy_map = (uint64_t*)(unit_memory+GT_MM_SLAB_UNIT_HEADER_SIZE);
+  unit->memory = unit_memory+((GT_MM_SLAB_UNIT_HEADER_SIZE+num_words*8+15) & ~((uint64_t)15));
+  memset(unit->occupancy_map,0,num_words*8);
+  uint64_t i; // Mark the tail of the bitmap as allocated (never handed out)
+  for (i=unit->total_elements;i<num_words*64;++i) unit->occupancy_map[i/64] |= (UINT64_C(1)<<(i%64));
+  unit->state = GT_SLAB_EMPTY;
+  // Link it
+  unit->prev_unit = NULL;
+  unit->next_unit = slab->units;
+  if (slab->units!=NULL) slab->units->prev_unit = unit;
+  slab->units = unit;
+  gt_mm_slab_link_free_unit(slab,unit);
+  ++(slab->num_units);
+  ++(slab->num_empty_units);
+  return unit;
+}
+GT_INLINE void gt_mm_slab_remove_unit(gt_mm_slab* const slab,gt_mm_slab_unit* const unit) {
+  // Unlink
+  if (unit->state!=GT_SLAB_FULL) gt_mm_slab_unlink_free_unit(slab,unit);
+  if (unit->state==GT_SLAB_EMPTY) --(slab->num_empty_units);
+  if (unit->prev_unit!=NULL) unit->prev_unit->next_unit = unit->next_unit;
+  else slab->units = unit->next_unit;
+  if (unit->next_unit!=NULL) unit->next_unit->prev_unit = unit->prev_unit;
+  --(slab->num_units);
+  // Give the memory back
+  if (slab->mm_pool!=NULL) {
+    gt_mm_pool_put_unit(slab->mm_pool,unit);
+  } else {
+    free(unit);
+    gt_mm_acc_sub(GT_MM_ACC_TEMPLATES,GT_MM_SLAB_UNIT_SIZE);
+  }
+}
+/*
+ * Occupancy
+ */
+GT_INLINE void gt_mm_slab_unit_occupy(
+    gt_mm_slab* const slab,gt_mm_slab_unit* const unit,const uint64_t position,const uint64_t num_elements) {
+  uint64_t i;
+  for (i=position;i<position+num_elements;++i) unit->occupancy_map[i/64] |= (UINT64_C(1)<<(i%64));
+  if (unit->state==GT_SLAB_EMPTY) --(slab->num_empty_units);
+  unit->allocated_elements += num_elements;
+  if (unit->allocated_elements==unit->total_elements) {
+    gt_mm_slab_unlink_free_unit(slab,unit);
+    unit->state = GT_SLAB_FULL;
+  } else {
+    unit->state = GT_SLAB_PARTIAL;
+  }
+}
+GT_INLINE void gt_mm_slab_unit_release(
+    gt_mm_slab* const slab,gt_mm_slab_unit* const unit,const uint64_t position,const uint64_t num_elements) {
+  uint64_t i;
+  for (i=position;i<position+num_elements;++i) unit->occupancy_map[i/64] &= ~(UINT64_C(1)<<(i%64));
+  if (position/64 < unit->free_word_hint) unit->free_word_hint = position/64;
+  if (unit->state==GT_SLAB_FULL) gt_mm_slab_link_free_unit(slab,unit);
+  unit->allocated_elements -= num_elements;
+  if (unit->allocated_elements==0) {
+    unit->state = GT_SLAB_EMPTY;
+    ++(slab->num_empty_units);
+    // Keep a few empty units, the rest go back to the pool
+    if (slab->num_empty_units > GT_MM_SLAB_MAX_EMPTY_UNITS) gt_mm_slab_remove_unit(slab,unit);
+  } else {
+    unit->state = GT_SLAB_PARTIAL;
+  }
+}
+GT_INLINE void gt_mm_slab_local_free(gt_mm_slab* const slab,void* const mem_addr,const uint64_t num_elements) {
+  gt_mm_slab_unit* const unit = gt_mm_slab_get_unit(mem_addr);
+  gt_fatal_check(unit->slab!=slab,MEM_CURSOR_OUT_OF_SEGMENT);
+  const uint64_t position = (mem_addr-unit->memory)/unit->element_size;
+  gt_mm_slab_unit_release(slab,unit,position,num_elements);
+}
+GT_INLINE void gt_mm_slab_process_remote_frees(gt_mm_slab* const slab) {
+  if (slab->remote_frees==NULL) return;
+  void** element = (void**)__sync_lock_test_and_set(&slab->remote_frees,NULL);
+  while (element!=NULL) {
+    void** const next_element = (void**)element[0];
+    gt_mm_slab_local_free(slab,element,(uint64_t)element[1]);
+    element = next_element;
+  }
+}
+/*
+ * Setup
+ */
+GT_INLINE gt_mm_slab* gt_mm_slab_new_(const uint64_t element_size,const uint64_t num_intial_slabs) {
+  gt_mm_slab* const slab = gt_mm_slab_allocate(element_size,NULL);
+  uint64_t i;
+  for (i=0;i<num_intial_slabs;++i) gt_mm_slab_add_unit(slab);
+  return slab;
+}
+GT_INLINE void gt_mm_slab_cast(gt_mm_slab* const slab,const uint64_t element_size) {
+  GT_MM_SLAB_CHECK(slab);
+  GT_ZERO_CHECK(element_size);
+  gt_mm_slab_process_remote_frees(slab);
+  gt_cond_fatal_error(slab->num_units!=slab->num_empty_units,MEM_SLAB_CAST);
+  while (slab->units!=NULL) gt_mm_slab_remove_unit(slab,slab->units);
+  slab->element_size = (element_size+GT_MM_SLAB_MIN_ELEMENT_SIZE-1) & ~((uint64_t)GT_MM_SLAB_MIN_ELEMENT_SIZE-1);
+  gt_cond_fatal_error(gt_mm_slab_unit_capacity(slab->element_size,NULL)==0,MEM_SLAB_ELEMENTS,(uint64_t)1,slab->element_size);
+}
+GT_INLINE void gt_mm_slab_reap_empty(gt_mm_slab* const slab) {
+  GT_MM_SLAB_CHECK(slab);
+  gt_mm_slab_process_remote_frees(slab);
+  gt_mm_slab_unit* unit = slab->free_units;
+  while (unit!=NULL) {
+    gt_mm_slab_unit* const next_unit = unit->next;
+    if (unit->state==GT_SLAB_EMPTY) gt_mm_slab_remove_unit(slab,unit);
+    unit = next_unit;
+  }
+}
+GT_INLINE void gt_mm_slab_delete(gt_mm_slab* const slab) {
+  GT_MM_SLAB_CHECK(slab);
+  while (slab->units!=NULL) gt_mm_slab_remove_unit(slab,slab->units);
+  gt_free(slab);
+}
+/*
+ * Allocation
+ */
+GT_INLINE gt_mm_slab_unit* gt_mm_slab_get_free_unit(gt_mm_slab* const slab) {
+  if (gt_expect_false(slab->free_units==NULL)) {
+    gt_mm_slab_process_remote_frees(slab);
+    if (slab->free_units==NULL) gt_mm_slab_add_unit(slab);
+  }
+  return slab->free_units;
+}
+GT_INLINE void* gt_mm_slab_malloc(gt_mm_slab* const slab) {
+  GT_MM_SLAB_CHECK(slab);
+  gt_mm_slab_unit* const unit = gt_mm_slab_get_free_unit(slab);
+  // Find a free element (there is at least one)
+  uint64_t word = unit->free_word_hint;
+  while (unit->occupancy_map[word]==UINT64_MAX) ++word;
+  unit->free_word_hint = word;
+  const uint64_t position = word*64 + __builtin_ctzll(~unit->occupancy_map[word]);
+  gt_mm_slab_unit_occupy(slab,unit,position,1);
+  return unit->memory+position*unit->element_size;
+}
+GT_INLINE void gt_mm_slab_free(gt_mm_slab* const slab,void* mem_addr) {
+  GT_MM_SLAB_CHECK(slab);
+  gt_mm_slab_mfree(slab,mem_addr,1);
+}
+GT_INLINE bool gt_mm_slab_unit_find_run(gt_mm_slab_unit* const unit,const uint64_t num_elements,uint64_t* const position) {
+  uint64_t i, run_length = 0;
+  for (i=unit->free_word_hint*64;i<unit->total_elements;++i) {
+    if (unit->occupancy_map[i/64] & (UINT64_C(1)<<(i%64))) {
+      run_length = 0;
+    } else if (++run_length==num_elements) {
+      *position = i+1-num_elements;
+      return true;
+    }
+  }
+  return false;
+}
+GT_INLINE void* gt_mm_slab_mmalloc(gt_mm_slab* const slab,const uint64_t num_elements) {
+  GT_MM_SLAB_CHECK(slab);
+  GT_ZERO_CHECK(num_elements);
+  if (num_elements==1) return gt_mm_slab_malloc(slab);
+  gt_cond_fatal_error(num_elements>gt_mm_slab_unit_capacity(slab->element_size,NULL),
+      MEM_SLAB_ELEMENTS,num_elements,slab->element_size);
+  // Look for a run of free elements in the units with free elements
+  uint64_t position;
+  gt_mm_slab_unit* unit = gt_mm_slab_get_free_unit(slab);
+  while (unit!=NULL && !gt_mm_slab_unit_find_run(unit,num_elements,&position)) unit = unit->next;
+  if (unit==NULL) {
+    unit = gt_mm_slab_add_unit(slab);
+    position = 0;
+  }
+  gt_mm_slab_unit_occupy(slab,unit,position,num_elements);
+  return unit->memory+position*unit->element_size;
+}
+GT_INLINE void gt_mm_slab_mfree(gt_mm_slab* const slab,void* mem_addr,const uint64_t num_elements) {
+  GT_MM_SLAB_CHECK(slab);
+  GT_NULL_CHECK(mem_addr);
+  if (gt_expect_true(GT_MM_SLAB_IS_OWNER(slab))) {
+    gt_mm_slab_local_free(slab,mem_addr,num_elements);
+  } else {
+    // Queue it to the owner (elements are at least 16 Bytes: {next,num_elements})
+    void** const element = (void**)mem_addr;
+    element[1] = (void*)num_elements;
+    void* head;
+    do {
+      head = slab->remote_frees;
+      element[0] = head;
+    } while (!__sync_bool_compare_and_swap(&slab->remote_frees,head,element));
+  }
+}
 
+/*
+ * PoolMemory
+ *   Pool of Slabs as gather all slabs needed along a program
+ *   The goal is to minimize all memory malloc/setup/free overhead
+ *   Offers thread safe allocation of slabs as to balance memory consumption across threads
+ */
+#define GT_MM_POOL_NUM_INITIAL_INSTANCES 64
+gt_mm_pool* gt_mm_pool_default = NULL;
+pthread_once_t gt_mm_pool_default_once = PTHREAD_ONCE_INIT;
+pthread_key_t gt_mm_pool_instance_key;
+__thread gt_mm_pool* gt_mm_pool_thread_instance = NULL;
 
+GT_INLINE gt_mm_pool* gt_mm_pool_new() {
+  gt_mm_pool* const mm_pool = gt_alloc(gt_mm_pool);
+  mm_pool->free_slabs_units = gt_vector_new(GT_MM_POOL_MAX_FREE_UNITS,sizeof(void*));
+  mm_pool->free_instances = gt_vector_new(GT_MM_POOL_NUM_INITIAL_INSTANCES,sizeof(gt_mm_pool*));
+  mm_pool->parent_pool = NULL;
+  memset(mm_pool->slabs,0,sizeof(mm_pool->slabs));
+  memset(mm_pool->num_recycled,0,sizeof(mm_pool->num_recycled));
+  mm_pool->pool_id = 0;
+  gt_cond_fatal_error(pthread_mutex_init(&mm_pool->input_mutex,NULL),SYS_MUTEX_INIT);
+  return mm_pool;
+}
+GT_INLINE gt_mm_pool* gt_mm_pool_get_new_instance(gt_mm_pool* mm_pool) {
+  GT_NULL_CHECK(mm_pool);
+  gt_mm_pool* instance = NULL;
+  GT_BEGIN_MUTEX_SECTION(mm_pool->input_mutex) {
+    if (!gt_vector_is_empty(mm_pool->free_instances)) { // Adopt a released instance
+      instance = *gt_vector_get_last_elm(mm_pool->free_instances,gt_mm_pool*);
+      gt_vector_dec_used(mm_pool->free_instances);
+    } else {
+      instance = gt_alloc(gt_mm_pool);
+      instance->free_slabs_units = NULL;
+      instance->free_instances = NULL;
+      instance->parent_pool = mm_pool;
+      memset(instance->slabs,0,sizeof(instance->slabs));
+      memset(instance->num_recycled,0,sizeof(instance->num_recycled));
+      instance->pool_id = ++(mm_pool->pool_id);
+    }
+  } GT_END_MUTEX_SECTION(mm_pool->input_mutex);
+  // Take over its slabs
+  uint64_t i;
+  for (i=0;i<GT_MM_POOL_NUM_SIZE_CLASSES;++i) {
+    if (instance->slabs[i]!=NULL) instance->slabs[i]->owner = pthread_self();
+  }
+  return instance;
+}
+GT_INLINE void gt_mm_pool_release_instance(gt_mm_pool* const mm_pool_instance) {
+  GT_NULL_CHECK(mm_pool_instance);
+  GT_NULL_CHECK(mm_pool_instance->parent_pool);
+  gt_mm_pool* const mm_pool = mm_pool_instance->parent_pool;
+  uint64_t i;
+  for (i=0;i<GT_MM_POOL_NUM_SIZE_CLASSES;++i) {
+    if (mm_pool_instance->slabs[i]!=NULL) gt_mm_slab_reap_empty(mm_pool_instance->slabs[i]);
+  }
+  GT_BEGIN_MUTEX_SECTION(mm_pool->input_mutex) {
+    gt_vector_insert(mm_pool->free_instances,mm_pool_instance,gt_mm_pool*);
+  } GT_END_MUTEX_SECTION(mm_pool->input_mutex);
+}
+GT_INLINE void gt_mm_pool_delete(gt_mm_pool* const mm_pool) {
+  GT_NULL_CHECK(mm_pool);
+  uint64_t i;
+  for (i=0;i<GT_MM_POOL_NUM_SIZE_CLASSES;++i) {
+    if (mm_pool->slabs[i]!=NULL) gt_mm_slab_delete(mm_pool->slabs[i]);
+  }
+  if (mm_pool->parent_pool==NULL) {
+    GT_VECTOR_ITERATE(mm_pool->free_instances,instance,instance_num,gt_mm_pool*) gt_mm_pool_delete(*instance);
+    GT_VECTOR_ITERATE(mm_pool->free_slabs_units,unit_memory,unit_num,void*) free(*unit_memory);
+    gt_mm_acc_sub(GT_MM_ACC_TEMPLATES,gt_vector_get_used(mm_pool->free_slabs_units)*GT_MM_SLAB_UNIT_SIZE);
+    gt_vector_delete(mm_pool->free_instances);
+    gt_vector_delete(mm_pool->free_slabs_units);
+    gt_cond_error(pthread_mutex_destroy(&mm_pool->input_mutex),SYS_MUTEX_DESTROY);
+  }
+  gt_free(mm_pool);
+}
+/*
+ * Units
+ */
+GT_INLINE void* gt_mm_pool_get_unit(gt_mm_pool* const mm_pool) {
+  GT_NULL_CHECK(mm_pool);
+  void* unit_memory = NULL;
+  GT_BEGIN_MUTEX_SECTION(mm_pool->input_mutex) {
+    if (!gt_vector_is_empty(mm_pool->free_slabs_units)) {
+      unit_memory = *gt_vector_get_last_elm(mm_pool->free_slabs_units,void*);
+      gt_vector_dec_used(mm_pool->free_slabs_units);
+    }
+  } GT_END_MUTEX_SECTION(mm_pool->input_mutex);
+  if (unit_memory==NULL) {
+    gt_cond_fatal_error(posix_memalign(&unit_memory,GT_MM_SLAB_UNIT_SIZE,GT_MM_SLAB_UNIT_SIZE),
+        MEM_ALLOC_INFO,(uint64_t)GT_MM_SLAB_UNIT_SIZE);
+    gt_mm_acc_add(GT_MM_ACC_TEMPLATES,GT_MM_SLAB_UNIT_SIZE);
+  }
+  return unit_memory;
+}
+GT_INLINE void gt_mm_pool_put_unit(gt_mm_pool* const mm_pool,void* const unit_memory) {
+  GT_NULL_CHECK(mm_pool);
+  GT_NULL_CHECK(unit_memory);
+  bool kept = false;
+  GT_BEGIN_MUTEX_SECTION(mm_pool->input_mutex) {
+    if (gt_vector_get_used(mm_pool->free_slabs_units) < GT_MM_POOL_MAX_FREE_UNITS) {
+      gt_vector_insert(mm_pool->free_slabs_units,unit_memory,void*);
+      kept = true;
+    }
+  } GT_END_MUTEX_SECTION(mm_pool->input_mutex);
+  if (!kept) {
+    free(unit_memory);
+    gt_mm_acc_sub(GT_MM_ACC_TEMPLATES,GT_MM_SLAB_UNIT_SIZE);
+  }
+}
+/*
+ * Allocation (from the instance of the calling thread)
+ */
+void gt_mm_pool_thread_exit(void* const mm_pool_instance) {
+  gt_mm_pool_release_instance((gt_mm_pool*)mm_pool_instance);
+}
+void gt_mm_pool_default_setup(void) {
+  gt_mm_pool_default = gt_mm_pool_new();
+  gt_cond_fatal_error(pthread_key_create(&gt_mm_pool_instance_key,gt_mm_pool_thread_exit),SYS_THREAD);
+}
+GT_INLINE gt_mm_pool* gt_mm_pool_get_thread_instance(void) {
+  if (gt_expect_false(gt_mm_pool_thread_instance==NULL)) {
+    pthread_once(&gt_mm_pool_default_once,gt_mm_pool_default_setup);
+    gt_mm_pool_thread_instance = gt_mm_pool_get_new_instance(gt_mm_pool_default);
+    pthread_setspecific(gt_mm_pool_instance_key,gt_mm_pool_thread_instance); // Released on thread exit
+  }
+  return gt_mm_pool_thread_instance;
+}
+GT_INLINE void* gt_mm_pool_malloc(const uint64_t num_bytes) {
+  if (gt_expect_false(num_bytes>GT_MM_POOL_MAX_ELEMENT_SIZE)) return gt_malloc(num_bytes);
+  gt_mm_pool* const mm_pool_instance = gt_mm_pool_get_thread_instance();
+  const uint64_t size_class = (num_bytes>0) ? (num_bytes-1)/GT_MM_POOL_SIZE_CLASS : 0;
+  gt_mm_slab* slab = mm_pool_instance->slabs[size_class];
+  if (gt_expect_false(slab==NULL)) {
+    slab = gt_mm_slab_allocate((size_class+1)*GT_MM_POOL_SIZE_CLASS,mm_pool_instance->parent_pool);
+    mm_pool_instance->slabs[size_class] = slab;
+  }
+  return gt_mm_slab_malloc(slab);
+}
+GT_INLINE void gt_mm_pool_free(void* const mem_addr,const uint64_t num_bytes) {
+  if (gt_expect_false(mem_addr==NULL)) return;
+  if (gt_expect_false(num_bytes>GT_MM_POOL_MAX_ELEMENT_SIZE)) {
+    gt_free(mem_addr);
+  } else {
+    gt_mm_slab_free(gt_mm_slab_get_slab(mem_addr),mem_addr);
+  }
+}
+/*
+ * Recycled objects (of the instance of the calling thread)
+ */
+GT_INLINE void* gt_mm_pool_get_recycled(const gt_mm_recycled_t recycled_type) {
+  gt_mm_pool* const mm_pool_instance = gt_mm_pool_get_thread_instance();
+  if (mm_pool_instance->num_recycled[recycled_type]==0) return NULL;
+  return mm_pool_instance->recycled[recycled_type][--(mm_pool_instance->num_recycled[recycled_type])];
+}
+GT_INLINE bool gt_mm_pool_put_recycled(const gt_mm_recycled_t recycled_type,void* const object) {
+  gt_mm_pool* const mm_pool_instance = gt_mm_pool_get_thread_instance();
+  if (mm_pool_instance->num_recycled[recycled_type]==GT_MM_POOL_MAX_RECYCLED) return false;
+  mm_pool_instance->recycled[recycled_type][(mm_pool_instance->num_recycled[recycled_type])++] = object;
+  return true;
+}
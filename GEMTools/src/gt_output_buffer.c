@@ -8,14 +8,15 @@
 
 #include "gt_output_buffer.h"
 
-#define GT_OUTPUT_BUFFER_INITIAL_SIZE GT_BUFFER_SIZE_16M
-
 /*
  * Setup
  */
 GT_INLINE gt_output_buffer* gt_output_buffer_new(void) {
   gt_output_buffer* output_buffer = gt_alloc(gt_output_buffer);
   output_buffer->buffer=gt_vector_new(GT_OUTPUT_BUFFER_INITIAL_SIZE,sizeof(char));
+  gt_mm_advise_huge_pages(gt_vector_get_mem(output_buffer->buffer,char),GT_OUTPUT_BUFFER_INITIAL_SIZE);
+  output_buffer->numa_node = gt_mm_numa_get_node();
+  output_buffer->accounted_memory = 0;
   gt_output_buffer_initiallize(output_buffer,GT_OUTPUT_BUFFER_FREE);
   return output_buffer;
 }
@@ -30,9 +31,12 @@ GT_INLINE void gt_output_buffer_initiallize(gt_output_buffer* const output_buffe
   GT_OUTPUT_BUFFER_CHECK(output_buffer);
   gt_output_buffer_clear(output_buffer);
   gt_output_buffer_set_state(output_buffer,buffer_state);
+  gt_mm_acc_update(GT_MM_ACC_OUTPUT_BUFFERS,&output_buffer->accounted_memory, // Buffers can grow
+      output_buffer->buffer->elements_allocated*output_buffer->buffer->element_size);
 }
 GT_INLINE void gt_output_buffer_delete(gt_output_buffer* const output_buffer) {
   GT_OUTPUT_BUFFER_CHECK(output_buffer);
+  gt_mm_acc_update(GT_MM_ACC_OUTPUT_BUFFERS,&output_buffer->accounted_memory,0);
   gt_vector_delete(output_buffer->buffer);
   gt_free(output_buffer);
 }
@@ -132,3 +136,11 @@ GT_INLINE gt_status gt_bprintf_(
   va_end(v_args);
   return chars_printed;
 }
+GT_INLINE gt_status gt_bwrite(gt_output_buffer* const output_buffer,const void* const data,const uint64_t length) {
+  GT_OUTPUT_BUFFER_CHECK(output_buffer);
+  GT_NULL_CHECK(data);
+  gt_vector_reserve_additional(output_buffer->buffer,length);
+  memcpy(gt_vector_get_free_elm(output_buffer->buffer,uint8_t),data,length);
+  gt_vector_add_used(output_buffer->buffer,length);
+  return length;
+}
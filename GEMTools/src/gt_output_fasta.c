@@ -99,6 +99,7 @@ GT_INLINE gt_status gt_output_fasta_gprint_fastq(gt_generic_printer* const gprin
   } else { // Print dummy qualities
     const uint64_t read_length = gt_string_get_length(read);
     uint64_t i;
+    gt_gprintf(gprinter,"+\n");
     for (i=0;i<read_length;++i) gt_gprintf(gprinter,"X");
     gt_gprintf(gprinter,"\n");
   }
@@ -13,6 +13,9 @@
 #include <bzlib.h>
 #endif
 #include "gt_output_file.h"
+#include "gt_input_file_index.h"
+
+#define GT_OUTPUT_FILE_BUDGET_WAIT_MS 100
 
 /*
  * Setup
@@ -25,6 +28,10 @@ GT_INLINE void gt_output_file_init_buffers(gt_output_file* const output_file) {
   }
   output_file->buffer_busy=0;
   output_file->buffer_write_pending=0;
+  output_file->buffer_releases=0;
+  output_file->buffer_budget_waiters=0;
+  /* Index */
+  output_file->index=NULL;
   /* Block ID (for synchronization purposes) */
   output_file->mayor_block_id=0;
   output_file->minor_block_id=0;
@@ -184,6 +191,11 @@ gt_status gt_output_file_close(gt_output_file* const output_file) {
     }
   	break;
   }
+  // Save the index
+  if (output_file->index!=NULL) {
+    gt_input_file_index_save(output_file->index,output_file->file_name);
+    gt_input_file_index_delete(output_file->index);
+  }
   // Delete allocated buffers
   uint64_t i;
   for (i=0;i<GT_MAX_OUTPUT_BUFFERS&&output_file->buffer[i]!=NULL;++i) {
@@ -198,6 +210,26 @@ gt_status gt_output_file_close(gt_output_file* const output_file) {
   return error_code;
 }
 
+/*
+ * Output File Index
+ */
+void gt_output_file_enable_index(
+    gt_output_file* const output_file,const uint64_t lines_per_record,const uint64_t sampling_rate) {
+  GT_OUTPUT_FILE_CHECK(output_file);
+  gt_cond_fatal_error(output_file->compression_type!=NONE,OUTPUT_FILE_INDEX_COMPRESSED,output_file->file_name);
+  gt_cond_fatal_error(!strcmp(output_file->file_name,GT_STREAM_FILE_NAME),OUTPUT_FILE_INDEX_STREAM);
+  gt_cond_fatal_error(sampling_rate==0,FILE_INDEX_SAMPLING_RATE);
+  if (output_file->index!=NULL) gt_input_file_index_delete(output_file->index);
+  output_file->index = gt_input_file_index_new(sampling_rate,lines_per_record,false);
+}
+GT_INLINE uint64_t gt_output_file_fwrite(gt_output_file* const output_file,const void* const data,const uint64_t length) {
+  const uint64_t bytes_written = fwrite(data,1,length,output_file->file);
+  if (output_file->index!=NULL) {
+    gt_input_file_index_scan(output_file->index,(const uint8_t*)data,bytes_written);
+  }
+  return bytes_written;
+}
+
 /*
  * Output File Printers
  */
@@ -207,7 +239,15 @@ GT_INLINE gt_status gt_vofprintf(gt_output_file* const output_file,const char *t
   gt_status error_code;
   GT_BEGIN_MUTEX_SECTION(output_file->out_file_mutex)
   {
-    error_code = vfprintf(output_file->file,template,v_args);
+    if (output_file->index==NULL) {
+      error_code = vfprintf(output_file->file,template,v_args);
+    } else {
+      gt_string* const formatted = gt_string_new(GT_BUFFER_SIZE_1K);
+      gt_vsprintf(formatted,template,v_args);
+      const uint64_t length = gt_string_get_length(formatted);
+      error_code = (gt_output_file_fwrite(output_file,gt_string_get_string(formatted),length)==length) ? (gt_status)length : -1;
+      gt_string_delete(formatted);
+    }
   }
   GT_END_MUTEX_SECTION(output_file->out_file_mutex);
   return error_code;
@@ -221,24 +261,69 @@ GT_INLINE gt_status gt_ofprintf(gt_output_file* const output_file,const char *te
   va_end(v_args);
   return error_code;
 }
+GT_INLINE gt_status gt_ofwrite(gt_output_file* const output_file,const void* const data,const uint64_t length) {
+  GT_OUTPUT_FILE_CHECK(output_file);
+  GT_NULL_CHECK(data);
+  uint64_t bytes_written;
+  GT_BEGIN_MUTEX_SECTION(output_file->out_file_mutex)
+  {
+    bytes_written = gt_output_file_fwrite(output_file,data,length);
+  }
+  GT_END_MUTEX_SECTION(output_file->out_file_mutex);
+  return (bytes_written==length) ? (gt_status)length : -1;
+}
 
 /*
  * Internal Buffers Accessors
  */
+GT_INLINE bool __gt_buffered_output_file_budget_wait(gt_output_file* const output_file) {
+  // Wait for a buffer to be released. False if none is released for a while
+  // (busy buffers might be waiting on us to be written, so we better not wait forever)
+  const uint64_t buffer_releases = output_file->buffer_releases;
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME,&deadline);
+  deadline.tv_nsec += GT_OUTPUT_FILE_BUDGET_WAIT_MS*1000000;
+  deadline.tv_sec += deadline.tv_nsec/1000000000;
+  deadline.tv_nsec %= 1000000000;
+  ++output_file->buffer_budget_waiters;
+  int error_code = 0;
+  while (output_file->buffer_releases==buffer_releases && error_code!=ETIMEDOUT) {
+    error_code = pthread_cond_timedwait(&output_file->out_buffer_cond,&output_file->out_file_mutex,&deadline);
+    gt_cond_fatal_error(error_code!=0 && error_code!=ETIMEDOUT,SYS_COND_VAR);
+  }
+  --output_file->buffer_budget_waiters;
+  return output_file->buffer_releases!=buffer_releases;
+}
 GT_INLINE gt_output_buffer* __gt_buffered_output_file_request_buffer(gt_output_file* const output_file) {
   GT_OUTPUT_FILE_CONSISTENCY_CHECK(output_file);
-  // Conditional guard. Wait till there is any free buffer left
-  while (output_file->buffer_busy==GT_MAX_OUTPUT_BUFFERS) {
-    GT_CV_WAIT(output_file->out_buffer_cond,output_file->out_file_mutex);
-  }
-  // There is at least one free buffer. Get it!
+  const int64_t numa_node = gt_mm_numa_get_node();
+  bool budget_stalled = false;
   uint64_t i;
-  for (i=0;i<GT_MAX_OUTPUT_BUFFERS&&output_file->buffer[i]!=NULL;++i) {
-    if (gt_output_buffer_get_state(output_file->buffer[i])==GT_OUTPUT_BUFFER_FREE) break;
-  }
-  gt_cond_fatal_error(i>=GT_MAX_OUTPUT_BUFFERS,ALG_INCONSISNTENCY);
-  if (output_file->buffer[i]==NULL) {
+  while (true) {
+    // Conditional guard. Wait till there is any free buffer left
+    while (output_file->buffer_busy==GT_MAX_OUTPUT_BUFFERS) {
+      GT_CV_WAIT(output_file->out_buffer_cond,output_file->out_file_mutex);
+    }
+    // There is at least one free buffer. Get it! (preferably one on the NUMA node of the thread)
+    uint64_t free_buffer = GT_MAX_OUTPUT_BUFFERS;
+    for (i=0;i<GT_MAX_OUTPUT_BUFFERS&&output_file->buffer[i]!=NULL;++i) {
+      if (gt_output_buffer_get_state(output_file->buffer[i])==GT_OUTPUT_BUFFER_FREE) {
+        if (output_file->buffer[i]->numa_node==numa_node) break;
+        if (free_buffer==GT_MAX_OUTPUT_BUFFERS) free_buffer = i;
+      }
+    }
+    if (free_buffer<GT_MAX_OUTPUT_BUFFERS && (i>=GT_MAX_OUTPUT_BUFFERS || output_file->buffer[i]==NULL)) {
+      i = free_buffer; // No local one, take a remote one (rather than another buffer)
+    }
+    gt_cond_fatal_error(i>=GT_MAX_OUTPUT_BUFFERS,ALG_INCONSISNTENCY);
+    if (output_file->buffer[i]!=NULL) break;
+    // A new buffer. Over the memory budget, rather wait for one in flight to be released
+    if (!budget_stalled && output_file->buffer_busy>0 && !gt_mm_acc_fits_budget(GT_OUTPUT_BUFFER_INITIAL_SIZE)) {
+      budget_stalled = !__gt_buffered_output_file_budget_wait(output_file);
+      continue; // Look again (the buffers changed meanwhile)
+    }
     output_file->buffer[i] = gt_output_buffer_new();
+    break;
   }
   ++output_file->buffer_busy;
   gt_output_buffer_initiallize(output_file->buffer[i],GT_OUTPUT_BUFFER_BUSY);
@@ -260,7 +345,8 @@ GT_INLINE void __gt_buffered_output_file_release_buffer(
   GT_OUTPUT_FILE_CONSISTENCY_CHECK(output_file);
   GT_OUTPUT_BUFFER_CHECK(output_buffer);
   // Broadcast. Wake up sleepy.
-  if (output_file->buffer_busy==GT_MAX_OUTPUT_BUFFERS) {
+  ++output_file->buffer_releases;
+  if (output_file->buffer_busy==GT_MAX_OUTPUT_BUFFERS || output_file->buffer_budget_waiters>0) {
     GT_CV_BROADCAST(output_file->out_buffer_cond);
   }
   // Free buffer
@@ -287,8 +373,8 @@ GT_INLINE gt_output_buffer* gt_output_file_write_buffer(
     gt_vector* const vbuffer = gt_output_buffer_to_vchar(output_buffer);
     GT_BEGIN_MUTEX_SECTION(output_file->out_file_mutex)
     {
-      bytes_written = fwrite(gt_vector_get_mem(vbuffer,char),1,
-          gt_vector_get_used(vbuffer),output_file->file);
+      bytes_written = gt_output_file_fwrite(output_file,
+          gt_vector_get_mem(vbuffer,char),gt_vector_get_used(vbuffer));
     }
     GT_END_MUTEX_SECTION(output_file->out_file_mutex);
     gt_cond_fatal_error(bytes_written!=gt_vector_get_used(vbuffer),OUTPUT_FILE_FAIL_WRITE);
@@ -330,7 +416,7 @@ GT_INLINE gt_output_buffer* gt_output_file_sorted_write_buffer_asynchronous(
     if (gt_output_buffer_get_used(output_buffer) > 0) {
       gt_vector* const vbuffer = gt_output_buffer_to_vchar(output_buffer);
       const int64_t bytes_written =
-          fwrite(gt_vector_get_mem(vbuffer,char),1,gt_vector_get_used(vbuffer),output_file->file);
+          gt_output_file_fwrite(output_file,gt_vector_get_mem(vbuffer,char),gt_vector_get_used(vbuffer));
       gt_cond_fatal_error(bytes_written!=gt_vector_get_used(vbuffer),OUTPUT_FILE_FAIL_WRITE);
     }
     // Update buffers' state
@@ -3,7 +3,7 @@
  * FILE: gt_output_generic_printer.c
  * DATE: 28/01/2013
  * AUTHOR(S): Santiago Marco-Sola <santiagomsola@gmail.com>
- * DESCRIPTION: Generic printer for {FASTA,FASTQ,MAP,SAM}
+ * DESCRIPTION: Generic printer for {FASTA,FASTQ,MAP,SAM,GTB}
  */
 
 #include "gt_output_generic_printer.h"
@@ -16,6 +16,7 @@ GT_INLINE gt_generic_printer_attributes* gt_generic_printer_attributes_new(const
   attributes->output_sam_attributes = NULL;
   attributes->output_fasta_attributes = NULL;
   attributes->output_map_attributes = NULL;
+  attributes->output_gtb_attributes = NULL;
   gt_generic_printer_attributes_set_format(attributes,file_format);
   return attributes;
 }
@@ -24,6 +25,7 @@ GT_INLINE void gt_generic_printer_attributes_delete(gt_generic_printer_attribute
   if (attributes->output_sam_attributes!=NULL) gt_output_sam_attributes_delete(attributes->output_sam_attributes);
   if (attributes->output_fasta_attributes!=NULL) gt_output_fasta_attributes_delete(attributes->output_fasta_attributes);
   if (attributes->output_map_attributes!=NULL) gt_output_map_attributes_delete(attributes->output_map_attributes);
+  if (attributes->output_gtb_attributes!=NULL) gt_output_gtb_attributes_delete(attributes->output_gtb_attributes);
   gt_free(attributes);
 }
 GT_INLINE void gt_generic_printer_attributes_set_format(
@@ -31,6 +33,7 @@ GT_INLINE void gt_generic_printer_attributes_set_format(
   GT_NULL_CHECK(attributes);
   switch (file_format) {
     case SAM:
+    case BAM: // BAM inputs are printed as SAM
       attributes->output_format = SAM;
       attributes->output_sam_attributes = gt_output_sam_attributes_new();
       break;
@@ -38,6 +41,10 @@ GT_INLINE void gt_generic_printer_attributes_set_format(
       attributes->output_format = FASTA;
       attributes->output_fasta_attributes = gt_output_fasta_attributes_new();
       break;
+    case GTB:
+      attributes->output_format = GTB;
+      attributes->output_gtb_attributes = gt_output_gtb_attributes_new();
+      break;
     case MAP:
     default:
       attributes->output_format = MAP;
@@ -64,6 +71,9 @@ GT_INLINE gt_status gt_output_generic_gprint_alignment(gt_generic_printer* const
     case FASTA:
       gt_output_fasta_gprint_alignment(gprinter,alignment,attributes->output_fasta_attributes);
       break;
+    case GTB:
+      gt_output_gtb_gprint_alignment(gprinter,alignment,attributes->output_gtb_attributes);
+      break;
     case MAP:
     default:
       gt_output_map_gprint_alignment(gprinter,alignment,attributes->output_map_attributes);
@@ -86,6 +96,9 @@ GT_INLINE gt_status gt_output_generic_gprint_template(gt_generic_printer* const
     case FASTA:
       gt_output_fasta_gprint_template(gprinter,template,attributes->output_fasta_attributes);
       break;
+    case GTB:
+      gt_output_gtb_gprint_template(gprinter,template,attributes->output_gtb_attributes);
+      break;
     case MAP:
     default:
       gt_output_map_gprint_gem_template(gprinter,template,attributes->output_map_attributes);
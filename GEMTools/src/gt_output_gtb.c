@@ -0,0 +1,336 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_output_gtb.c
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Output printers for GTB format (compact binary MAP; layout in gt_input_gtb_parser.h)
+ */
+
+#include "gt_output_gtb.h"
+#include "gt_input_gtb_parser.h"
+
+#define GT_OUTPUT_GTB_BLOCK_SIZE GT_BUFFER_SIZE_4M // Payload beyond which a new block is started
+#define GT_OUTPUT_GTB_RECORD_SIZE GT_BUFFER_SIZE_1K
+#define GT_OUTPUT_GTB_NUM_INITIAL_CONTIGS 100
+
+/*
+ * Output attributes
+ */
+GT_INLINE gt_output_gtb_attributes* gt_output_gtb_attributes_new(void) {
+  gt_output_gtb_attributes* const attributes = gt_alloc(gt_output_gtb_attributes);
+  attributes->contig_ids = gt_vector_new(GT_OUTPUT_GTB_NUM_INITIAL_CONTIGS,sizeof(uint32_t));
+  attributes->block_contigs = gt_vector_new(GT_OUTPUT_GTB_NUM_INITIAL_CONTIGS,sizeof(uint32_t));
+  attributes->record = gt_vector_new(GT_OUTPUT_GTB_RECORD_SIZE,sizeof(uint8_t));
+  attributes->block = gt_vector_new(GT_OUTPUT_GTB_RECORD_SIZE,sizeof(uint8_t));
+  attributes->tag = gt_string_new(GT_OUTPUT_GTB_RECORD_SIZE);
+  gt_output_gtb_attributes_reset(attributes);
+  return attributes;
+}
+GT_INLINE void gt_output_gtb_attributes_delete(gt_output_gtb_attributes* const attributes) {
+  GT_NULL_CHECK(attributes);
+  gt_vector_delete(attributes->contig_ids);
+  gt_vector_delete(attributes->block_contigs);
+  gt_vector_delete(attributes->record);
+  gt_vector_delete(attributes->block);
+  gt_string_delete(attributes->tag);
+  gt_free(attributes);
+}
+GT_INLINE void gt_output_gtb_attributes_reset(gt_output_gtb_attributes* const attributes) {
+  GT_NULL_CHECK(attributes);
+  attributes->block_buffer = NULL;
+  attributes->block_id = UINT64_MAX;
+  attributes->block_offset = 0;
+  attributes->block_end = 0;
+  attributes->num_templates = 0;
+}
+
+/*
+ * Encoding building blocks
+ */
+#define gt_output_gtb_zigzag(value) ((((uint64_t)(value))<<1) ^ (uint64_t)(((int64_t)(value))>>63))
+#define gt_output_gtb_optional(value) (((value)==UINT64_MAX) ? GT_GTB_NONE : (value)+1) // GT_MAP_NO_GT_SCORE/No MCS
+GT_INLINE void gt_output_gtb_put_varint(gt_vector* const buffer,uint64_t value) {
+  gt_vector_reserve_additional(buffer,10);
+  uint8_t* const mem = gt_vector_get_free_elm(buffer,uint8_t);
+  uint64_t num_bytes = 0;
+  while (value>=0x80) {
+    mem[num_bytes++] = (uint8_t)(value|0x80);
+    value >>= 7;
+  }
+  mem[num_bytes++] = (uint8_t)value;
+  gt_vector_add_used(buffer,num_bytes);
+}
+GT_INLINE void gt_output_gtb_put_byte(gt_vector* const buffer,const uint8_t value) {
+  gt_vector_insert(buffer,value,uint8_t);
+}
+GT_INLINE void gt_output_gtb_put_bytes(gt_vector* const buffer,const void* const data,const uint64_t length) {
+  gt_vector_reserve_additional(buffer,length);
+  memcpy(gt_vector_get_free_elm(buffer,uint8_t),data,length);
+  gt_vector_add_used(buffer,length);
+}
+GT_INLINE void gt_output_gtb_put_string(gt_vector* const buffer,gt_string* const string) {
+  const uint64_t length = gt_string_get_length(string);
+  gt_output_gtb_put_varint(buffer,length);
+  gt_output_gtb_put_bytes(buffer,gt_string_get_string(string),length);
+}
+GT_INLINE void gt_output_gtb_set_uint32(uint8_t* const mem,const uint32_t value) {
+  mem[0] = value; mem[1] = value>>8; mem[2] = value>>16; mem[3] = value>>24;
+}
+
+/*
+ * Blocks
+ */
+GT_INLINE void gt_output_gtb_open_block(
+    gt_output_gtb_attributes* const attributes,gt_vector* const buffer,const uint64_t block_id) {
+  // Reset the dictionary
+  uint32_t* const contig_ids = gt_vector_get_mem(attributes->contig_ids,uint32_t);
+  GT_VECTOR_ITERATE(attributes->block_contigs,seq_name_id,contig_num,uint32_t) {
+    contig_ids[*seq_name_id] = 0;
+  }
+  gt_vector_clear(attributes->block_contigs);
+  // Header (sizes patched as records are added)
+  attributes->block_buffer = buffer;
+  attributes->block_id = block_id;
+  attributes->block_offset = gt_vector_get_used(buffer);
+  attributes->num_templates = 0;
+  gt_output_gtb_put_bytes(buffer,GT_GTB_MAGIC,GT_GTB_MAGIC_LENGTH);
+  gt_output_gtb_put_byte(buffer,GT_GTB_VERSION);
+  gt_vector_reserve_additional(buffer,GT_GTB_BLOCK_HEADER_SIZE);
+  memset(gt_vector_get_free_elm(buffer,uint8_t),0,GT_GTB_BLOCK_HEADER_SIZE-(GT_GTB_MAGIC_LENGTH+1));
+  gt_vector_add_used(buffer,GT_GTB_BLOCK_HEADER_SIZE-(GT_GTB_MAGIC_LENGTH+1));
+  attributes->block_end = gt_vector_get_used(buffer);
+}
+GT_INLINE bool gt_output_gtb_is_block_open(
+    gt_output_gtb_attributes* const attributes,gt_vector* const buffer,const uint64_t block_id) {
+  // Nothing else was printed (nor the buffer dumped) since the last record
+  return attributes->block_buffer==buffer && attributes->block_id==block_id &&
+      attributes->block_end==gt_vector_get_used(buffer) &&
+      attributes->block_end-attributes->block_offset-GT_GTB_BLOCK_HEADER_SIZE < GT_OUTPUT_GTB_BLOCK_SIZE;
+}
+GT_INLINE uint64_t gt_output_gtb_get_contig_id(gt_output_gtb_attributes* const attributes,const uint32_t seq_name_id) {
+  gt_vector* const contig_ids = attributes->contig_ids;
+  const uint64_t num_ids = gt_vector_get_used(contig_ids);
+  if (gt_expect_false(seq_name_id>=num_ids)) {
+    gt_vector_reserve(contig_ids,seq_name_id+1,false);
+    memset(gt_vector_get_mem(contig_ids,uint32_t)+num_ids,0,(seq_name_id+1-num_ids)*sizeof(uint32_t));
+    gt_vector_set_used(contig_ids,seq_name_id+1);
+  }
+  uint32_t* const contig_id = gt_vector_get_elm(contig_ids,seq_name_id,uint32_t);
+  if (gt_expect_false(*contig_id==0)) {
+    // Define it (before the record using it)
+    gt_string* const seq_name = gt_seq_name_get_string(seq_name_id);
+    gt_vector* const block_buffer = attributes->block_buffer;
+    gt_output_gtb_put_varint(block_buffer,(gt_string_get_length(seq_name)<<1)|GT_GTB_ENTRY_CONTIG);
+    gt_output_gtb_put_bytes(block_buffer,gt_string_get_string(seq_name),gt_string_get_length(seq_name));
+    gt_vector_insert(attributes->block_contigs,seq_name_id,uint32_t);
+    *contig_id = gt_vector_get_used(attributes->block_contigs);
+  }
+  return *contig_id-1;
+}
+
+/*
+ * Records
+ */
+GT_INLINE void gt_output_gtb_put_map(
+    gt_output_gtb_attributes* const attributes,gt_map* const map,uint64_t* const last_position) {
+  gt_vector* const record = attributes->record;
+  gt_map* map_block = map;
+  while (true) {
+    // Location
+    gt_output_gtb_put_varint(record,gt_output_gtb_get_contig_id(attributes,gt_map_get_seq_name_id(map_block)));
+    const bool has_next = gt_map_has_next_block(map_block);
+    uint8_t flags = gt_map_get_strand(map_block) & GT_GTB_MAP_STRAND_MASK;
+    if (has_next) flags |= GT_GTB_MAP_HAS_NEXT | (gt_map_get_junction(map_block)<<GT_GTB_MAP_JUNCTION_SHIFT);
+    gt_output_gtb_put_byte(record,flags);
+    const uint64_t position = gt_map_get_position(map_block);
+    gt_output_gtb_put_varint(record,gt_output_gtb_zigzag(position-*last_position));
+    *last_position = position;
+    gt_output_gtb_put_varint(record,gt_map_get_base_length(map_block));
+    // Scores
+    gt_output_gtb_put_varint(record,gt_output_gtb_optional(map_block->gt_score));
+    gt_output_gtb_put_byte(record,map_block->phred_score);
+    // Mismatches
+    const uint64_t num_misms = gt_map_get_num_misms(map_block);
+    uint64_t i, last_misms_position = 0;
+    gt_output_gtb_put_varint(record,num_misms);
+    for (i=0;i<num_misms;++i) {
+      gt_misms* const misms = gt_map_get_misms(map_block,i);
+      gt_output_gtb_put_varint(record,
+          (gt_output_gtb_zigzag(misms->position-last_misms_position)<<2) | misms->misms_type);
+      last_misms_position = misms->position;
+      if (misms->misms_type==MISMS) {
+        gt_output_gtb_put_byte(record,misms->base);
+      } else {
+        gt_output_gtb_put_varint(record,misms->size);
+      }
+    }
+    // Next block
+    if (!has_next) break;
+    gt_output_gtb_put_varint(record,gt_output_gtb_zigzag(gt_map_get_junction_size(map_block)));
+    map_block = gt_map_get_next_block(map_block);
+  }
+}
+GT_INLINE bool gt_output_gtb_locate_map(gt_alignment* const alignment,gt_map* const map,uint64_t* const position) {
+  // MMaps mostly follow the order of the maps (search from the last one found)
+  GT_ALIGNMENT_DECODE_MAPS(alignment);
+  const uint64_t num_maps = gt_vector_get_used(alignment->maps);
+  gt_map** const maps = gt_vector_get_mem(alignment->maps,gt_map*);
+  uint64_t i, pos = *position;
+  for (i=0;i<num_maps;++i,++pos) {
+    if (pos>=num_maps) pos = 0;
+    if (maps[pos]==map) {
+      *position = pos;
+      return true;
+    }
+  }
+  return false;
+}
+GT_INLINE void gt_output_gtb_put_record(
+    gt_output_gtb_attributes* const attributes,gt_template* const template,gt_alignment* const alignment) {
+  gt_vector* const record = attributes->record;
+  gt_vector_clear(record);
+  // Blocks (a template of one block is printed as its alignment, as in MAP)
+  const bool is_template = (template!=NULL && gt_template_get_num_blocks(template)!=1);
+  const uint64_t num_blocks = (is_template) ? gt_template_get_num_blocks(template) : 1;
+  gt_alignment* const se_alignment = (is_template) ? NULL : (template!=NULL) ? gt_template_get_block(template,0) : alignment;
+  #define gt_output_gtb_get_block(block_num) ((is_template) ? gt_template_get_block(template,block_num) : se_alignment)
+  gt_output_gtb_put_varint(record,num_blocks);
+  // TAG
+  gt_output_map_attributes output_map_attributes = GT_OUTPUT_MAP_ATTR_DEFAULT();
+  gt_string_clear(attributes->tag);
+  if (is_template) {
+    gt_output_map_sprint_tag(attributes->tag,template->tag,template->attributes,&output_map_attributes);
+  } else {
+    gt_output_map_sprint_tag(attributes->tag,se_alignment->tag,se_alignment->attributes,&output_map_attributes);
+  }
+  gt_output_gtb_put_varint(record,gt_string_get_length(attributes->tag)+1);
+  gt_output_gtb_put_bytes(record,gt_string_get_string(attributes->tag),gt_string_get_length(attributes->tag));
+  gt_output_gtb_put_byte(record,TAB);
+  // READ/QUALITIES
+  uint64_t block_num;
+  for (block_num=0;block_num<num_blocks;++block_num) {
+    gt_alignment* const block = gt_output_gtb_get_block(block_num);
+    gt_output_gtb_put_string(record,block->read);
+    gt_output_gtb_put_string(record,block->qualities);
+  }
+  // COUNTERS
+  const bool not_unique = (is_template) ?
+      gt_template_get_not_unique_flag(template) : gt_alignment_get_not_unique_flag(se_alignment);
+  const uint64_t mcs = (is_template) ? gt_template_get_mcs(template) : gt_alignment_get_mcs(se_alignment);
+  gt_vector* const counters = (is_template) ?
+      gt_template_get_counters_vector(template) : gt_alignment_get_counters_vector(se_alignment);
+  gt_output_gtb_put_varint(record,(not_unique) ? GT_GTB_RECORD_NOT_UNIQUE : 0);
+  gt_output_gtb_put_varint(record,gt_output_gtb_optional(mcs));
+  gt_output_gtb_put_varint(record,gt_vector_get_used(counters));
+  GT_VECTOR_ITERATE(counters,counter,counter_num,uint64_t) {
+    gt_output_gtb_put_varint(record,*counter);
+  }
+  // MAPS
+  uint64_t last_position = 0;
+  for (block_num=0;block_num<num_blocks;++block_num) {
+    gt_alignment* const block = gt_output_gtb_get_block(block_num);
+    const uint64_t num_maps = gt_alignment_get_num_maps(block);
+    uint64_t i;
+    gt_output_gtb_put_varint(record,num_maps);
+    for (i=0;i<num_maps;++i) {
+      gt_output_gtb_put_map(attributes,gt_alignment_get_map(block,i),&last_position);
+    }
+  }
+  // MMAPS
+  if (is_template && num_blocks>1) {
+    uint64_t map_position[2] = {0,0};
+    GT_TEMPLATE_DECODE_MAPS(template);
+    gt_output_gtb_put_varint(record,gt_template_get_num_mmaps(template));
+    GT_TEMPLATE_ITERATE_MMAP__ATTR_(template,mmap,mmap_attributes) {
+      for (block_num=0;block_num<num_blocks;++block_num) {
+        if (mmap[block_num]==NULL) {
+          gt_output_gtb_put_varint(record,GT_GTB_MMAP_END_NULL);
+        } else if (gt_output_gtb_locate_map(gt_template_get_block(template,block_num),mmap[block_num],map_position+block_num)) {
+          gt_output_gtb_put_varint(record,GT_GTB_MMAP_END_MAP+map_position[block_num]);
+          ++map_position[block_num];
+        } else {
+          gt_output_gtb_put_varint(record,GT_GTB_MMAP_END_INLINE);
+          gt_output_gtb_put_map(attributes,mmap[block_num],&last_position);
+        }
+      }
+      gt_output_gtb_put_varint(record,mmap_attributes->distance);
+      gt_output_gtb_put_varint(record,gt_output_gtb_optional(mmap_attributes->gt_score));
+      gt_output_gtb_put_byte(record,mmap_attributes->phred_score);
+    }
+  }
+  #undef gt_output_gtb_get_block
+}
+GT_INLINE void gt_output_gtb_append_record(
+    gt_output_gtb_attributes* const attributes,gt_vector* const buffer,const uint64_t block_id,
+    gt_template* const template,gt_alignment* const alignment) {
+  // Open a new block (unless the records are still appended to the current one)
+  if (!gt_output_gtb_is_block_open(attributes,buffer,block_id)) {
+    gt_output_gtb_open_block(attributes,buffer,block_id);
+  }
+  // Encode the record (contigs defined on the fly) & append it
+  gt_output_gtb_put_record(attributes,template,alignment);
+  gt_output_gtb_put_varint(buffer,(gt_vector_get_used(attributes->record)<<1)|GT_GTB_ENTRY_TEMPLATE);
+  gt_output_gtb_put_bytes(buffer,gt_vector_get_mem(attributes->record,uint8_t),gt_vector_get_used(attributes->record));
+  // Update the header
+  attributes->block_end = gt_vector_get_used(buffer);
+  ++attributes->num_templates;
+  uint8_t* const header = gt_vector_get_elm(buffer,attributes->block_offset,uint8_t);
+  gt_output_gtb_set_uint32(header+GT_GTB_BLOCK_PAYLOAD_SIZE,
+      attributes->block_end-attributes->block_offset-GT_GTB_BLOCK_HEADER_SIZE);
+  gt_output_gtb_set_uint32(header+GT_GTB_BLOCK_NUM_TEMPLATES,attributes->num_templates);
+}
+GT_INLINE void gt_output_gtb_gprint_record(gt_generic_printer* const gprinter,
+    gt_template* const template,gt_alignment* const alignment,gt_output_gtb_attributes* const attributes) {
+  gt_output_buffer* output_buffer;
+  switch (gprinter->printer_type) {
+    case GT_BOF_PRINTER:
+      if (gt_expect_false(gt_output_buffer_get_used(gprinter->buffered_output_file->buffer)>=
+          GT_BUFFERED_OUTPUT_FILE_FORCE_DUMP_SIZE)) {
+        gt_buffered_output_file_safety_dump(gprinter->buffered_output_file);
+      }
+      output_buffer = gprinter->buffered_output_file->buffer;
+      break;
+    case GT_BUFFER_PRINTER:
+      output_buffer = gprinter->output_buffer;
+      break;
+    default:
+      // Whole block written at once
+      gt_vector_clear(attributes->block);
+      gt_output_gtb_append_record(attributes,attributes->block,UINT64_MAX,template,alignment);
+      gt_gwrite(gprinter,gt_vector_get_mem(attributes->block,uint8_t),gt_vector_get_used(attributes->block));
+      gt_output_gtb_attributes_reset(attributes);
+      return;
+  }
+  // Streamed into the output buffer (block IDs change whenever the buffer is dumped)
+  const uint64_t block_id = ((uint64_t)gt_output_buffer_get_mayor_block_id(output_buffer)<<32) |
+      gt_output_buffer_get_minor_block_id(output_buffer);
+  gt_output_gtb_append_record(attributes,gt_output_buffer_to_vchar(output_buffer),block_id,template,alignment);
+}
+
+/*
+ * GTB Printers
+ */
+#undef GT_GENERIC_PRINTER_DELEGATE_CALL_PARAMS
+#define GT_GENERIC_PRINTER_DELEGATE_CALL_PARAMS template,attributes
+GT_GENERIC_PRINTER_IMPLEMENTATION(gt_output_gtb,print_template,
+    gt_template* const template,gt_output_gtb_attributes* const attributes);
+GT_INLINE gt_status gt_output_gtb_gprint_template(gt_generic_printer* const gprinter,
+    gt_template* const template,gt_output_gtb_attributes* const attributes) {
+  GT_GENERIC_PRINTER_CHECK(gprinter);
+  GT_TEMPLATE_CHECK(template);
+  GT_NULL_CHECK(attributes);
+  gt_output_gtb_gprint_record(gprinter,template,NULL,attributes);
+  return 0;
+}
+#undef GT_GENERIC_PRINTER_DELEGATE_CALL_PARAMS
+#define GT_GENERIC_PRINTER_DELEGATE_CALL_PARAMS alignment,attributes
+GT_GENERIC_PRINTER_IMPLEMENTATION(gt_output_gtb,print_alignment,
+    gt_alignment* const alignment,gt_output_gtb_attributes* const attributes);
+GT_INLINE gt_status gt_output_gtb_gprint_alignment(gt_generic_printer* const gprinter,
+    gt_alignment* const alignment,gt_output_gtb_attributes* const attributes) {
+  GT_GENERIC_PRINTER_CHECK(gprinter);
+  GT_ALIGNMENT_CHECK(alignment);
+  GT_NULL_CHECK(attributes);
+  gt_output_gtb_gprint_record(gprinter,NULL,alignment,attributes);
+  return 0;
+}
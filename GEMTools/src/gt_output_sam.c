@@ -475,7 +475,7 @@ GT_INLINE void gt_output_sam_gprint_map_placeholder_xa(gt_generic_printer* const
    * XA maps (chr12,+91022,101M,0)
    */
   gt_gprintf(gprinter,PRIgts",%c%lu,",
-      PRIgts_content(map_ph->map->seq_name),
+      PRIgts_content(gt_map_get_string_seq_name(map_ph->map)),
       (map_ph->map->strand==FORWARD)?'+':'-',
       gt_map_get_global_coordinate(map_ph->map)); // Print the map
   gt_output_sam_gprint_map_cigar(gprinter,map_ph->map,attributes,map_ph->hard_trim_left,map_ph->hard_trim_right);
@@ -507,7 +507,7 @@ GT_INLINE gt_status gt_output_sam_gprint_core_fields_se(gt_generic_printer* cons
     // (3) Print RNAME
     // (4) Print POS
     // (5) Print MAPQ
-    gt_gprintf(gprinter,"\t"PRIgts"\t%"PRIu64"\t%"PRIu8"\t",PRIgts_content(map->seq_name),position,phred_score);
+    gt_gprintf(gprinter,"\t"PRIgts"\t%"PRIu64"\t%"PRIu8"\t",PRIgts_content(gt_map_get_string_seq_name(map)),position,phred_score);
     // (6) Print CIGAR
     gt_output_sam_gprint_map_cigar(gprinter,map,attributes,hard_left_trim_read,hard_right_trim_read);
   } else {
@@ -563,7 +563,7 @@ GT_INLINE gt_status gt_output_sam_gprint_core_fields_pe(gt_generic_printer* cons
   // (5) Print MAPQ
   // (6) Print CIGAR
   if (map!=NULL) {
-    gt_gprintf(gprinter,"\t"PRIgts"\t%"PRIu64"\t%"PRIu8"\t",PRIgts_content(map->seq_name),position,phred_score);
+    gt_gprintf(gprinter,"\t"PRIgts"\t%"PRIu64"\t%"PRIu8"\t",PRIgts_content(gt_map_get_string_seq_name(map)),position,phred_score);
     gt_output_sam_gprint_map_cigar(gprinter,map,attributes,hard_left_trim_read,hard_right_trim_read); // CIGAR
   } else {
     gt_gprintf(gprinter,"\t*\t0\t255\t*");
@@ -572,8 +572,8 @@ GT_INLINE gt_status gt_output_sam_gprint_core_fields_pe(gt_generic_printer* cons
   // (8) Print PNEXT
   // (9) Print TLEN
   if (mate!=NULL) {
-    if (map!=NULL && !gt_string_equals(map->seq_name,mate->seq_name)) {
-      gt_gprintf(gprinter,"\t"PRIgts"\t%"PRIu64"\t%"PRId64,PRIgts_content(mate->seq_name),mate_position,template_length);
+    if (map!=NULL && map->seq_name_id!=mate->seq_name_id) {
+      gt_gprintf(gprinter,"\t"PRIgts"\t%"PRIu64"\t%"PRId64,PRIgts_content(gt_map_get_string_seq_name(mate)),mate_position,template_length);
     } else {
       gt_gprintf(gprinter,"\t=\t%"PRIu64"\t%"PRId64,mate_position,template_length);
     }
@@ -9,6 +9,22 @@
 
 #include "gt_sam_attributes.h"
 
+/*
+ * BAM File specifics (Binary header)
+ */
+#define GT_BAM_HEADERS_INIT_REFERENCES 100
+#define GT_BAM_HEADERS_INIT_RECORD_SIZE 1024
+GT_INLINE void gt_bam_headers_init(gt_bam_headers* const bam_headers) {
+  GT_NULL_CHECK(bam_headers);
+  bam_headers->reference_ids = gt_vector_new(GT_BAM_HEADERS_INIT_REFERENCES,sizeof(uint32_t));
+  bam_headers->next_record = gt_vector_new(GT_BAM_HEADERS_INIT_RECORD_SIZE,sizeof(uint8_t));
+}
+GT_INLINE void gt_bam_headers_destroy(gt_bam_headers* const bam_headers) {
+  GT_NULL_CHECK(bam_headers);
+  gt_vector_delete(bam_headers->reference_ids);
+  gt_vector_delete(bam_headers->next_record);
+}
+
 /*
  * SAM File specifics Attribute (SAM Headers)
  */
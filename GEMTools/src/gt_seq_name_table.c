@@ -0,0 +1,204 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_seq_name_table.c
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Table of interned sequence names (Chromosome/Contig/...)
+ */
+
+#include "gt_seq_name_table.h"
+
+#define GT_SEQ_NAME_TABLE_NUM_INITIAL_RETIRED 8
+
+#define GT_SEQ_NAME_SLOT(hash,seq_name_id) (((hash)&0xFFFFFFFF00000000ull) | ((uint64_t)(seq_name_id)+1))
+#define GT_SEQ_NAME_SLOT_GET_ID(slot) ((uint32_t)((slot)&0xFFFFFFFFull)-1)
+#define GT_SEQ_NAME_SLOT_GET_TAG(slot) ((slot)>>32)
+
+#define gt_seq_name_table_get_entry(seq_name_table,seq_name_id) \
+  ((seq_name_table)->chunks[(seq_name_id)>>GT_SEQ_NAME_TABLE_CHUNK_BITS]+((seq_name_id)&(GT_SEQ_NAME_TABLE_CHUNK_SIZE-1)))
+
+/*
+ * Hashing (FNV-1a)
+ */
+GT_INLINE uint64_t gt_seq_name_hash(const char* const name,const uint64_t length) {
+  uint64_t hash = 0xcbf29ce484222325ull, i;
+  for (i=0;i<length;++i) {
+    hash ^= (uint8_t)name[i];
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+/*
+ * Index (name->ID)
+ */
+GT_INLINE gt_seq_name_index* gt_seq_name_index_new(const uint64_t num_slots) {
+  gt_seq_name_index* const index = gt_malloc_(1,sizeof(gt_seq_name_index)+num_slots*sizeof(uint64_t),true,0);
+  index->num_slots = num_slots;
+  return index;
+}
+GT_INLINE bool gt_seq_name_index_lookup(
+    gt_seq_name_table* const seq_name_table,gt_seq_name_index* const index,
+    const char* const name,const uint64_t length,const uint64_t hash,uint32_t* const seq_name_id) {
+  const uint64_t mask = index->num_slots-1;
+  uint64_t pos = hash&mask;
+  while (true) {
+    const uint64_t slot = index->slots[pos];
+    if (slot==0) return false;
+    if (GT_SEQ_NAME_SLOT_GET_TAG(slot)==GT_SEQ_NAME_SLOT_GET_TAG(hash)) {
+      const uint32_t candidate_id = GT_SEQ_NAME_SLOT_GET_ID(slot);
+      gt_string* const entry = gt_seq_name_table_get_entry(seq_name_table,candidate_id);
+      if (entry->length==length && memcmp(entry->buffer,name,length)==0) {
+        *seq_name_id = candidate_id;
+        return true;
+      }
+    }
+    pos = (pos+1)&mask;
+  }
+}
+GT_INLINE void gt_seq_name_index_insert(gt_seq_name_index* const index,const uint64_t hash,const uint64_t slot) {
+  const uint64_t mask = index->num_slots-1;
+  uint64_t pos = hash&mask;
+  while (index->slots[pos]!=0) pos = (pos+1)&mask;
+  index->slots[pos] = slot;
+}
+
+/*
+ * Setup
+ */
+GT_INLINE uint32_t gt_seq_name_table_add(gt_seq_name_table* const seq_name_table,
+    const char* const name,const uint64_t length,const uint64_t hash); // (table mutex held)
+GT_INLINE gt_seq_name_table* gt_seq_name_table_new(void) {
+  gt_seq_name_table* const seq_name_table = gt_alloc(gt_seq_name_table);
+  memset(seq_name_table->chunks,0,sizeof(seq_name_table->chunks));
+  seq_name_table->num_names = 0;
+  seq_name_table->index = gt_seq_name_index_new(GT_SEQ_NAME_TABLE_INITIAL_SLOTS);
+  seq_name_table->retired_indexes = gt_vector_new(GT_SEQ_NAME_TABLE_NUM_INITIAL_RETIRED,sizeof(gt_seq_name_index*));
+  gt_cond_fatal_error(pthread_mutex_init(&seq_name_table->table_mutex,NULL),SYS_MUTEX_INIT);
+  // Reserve the ID of the empty name
+  gt_seq_name_table_add(seq_name_table,"",0,gt_seq_name_hash("",0));
+  return seq_name_table;
+}
+GT_INLINE void gt_seq_name_table_delete(gt_seq_name_table* const seq_name_table) {
+  GT_SEQ_NAME_TABLE_CHECK(seq_name_table);
+  uint64_t i;
+  for (i=0;i<seq_name_table->num_names;++i) {
+    gt_string* const entry = gt_seq_name_table_get_entry(seq_name_table,i);
+    if (entry->memory!=entry->inline_buffer) gt_free(entry->memory);
+  }
+  for (i=0;i<GT_SEQ_NAME_TABLE_MAX_CHUNKS && seq_name_table->chunks[i]!=NULL;++i) {
+    gt_free(seq_name_table->chunks[i]);
+  }
+  GT_VECTOR_ITERATE(seq_name_table->retired_indexes,retired_index,retired_num,gt_seq_name_index*) {
+    gt_free(*retired_index);
+  }
+  gt_vector_delete(seq_name_table->retired_indexes);
+  gt_free(seq_name_table->index);
+  gt_cond_error(pthread_mutex_destroy(&seq_name_table->table_mutex),SYS_MUTEX_DESTROY);
+  gt_free(seq_name_table);
+}
+
+/*
+ * Adding names
+ *   The name is completely stored before its slot is published, so lock-free readers
+ *   finding the slot always see the name. Outgrown indexes are kept (retired) until the
+ *   table is deleted, as readers might be probing them (they just miss the newest names)
+ */
+GT_INLINE void gt_seq_name_table_grow_index(gt_seq_name_table* const seq_name_table) {
+  gt_seq_name_index* const old_index = seq_name_table->index;
+  gt_seq_name_index* const new_index = gt_seq_name_index_new(2*old_index->num_slots);
+  uint64_t i;
+  for (i=0;i<old_index->num_slots;++i) {
+    const uint64_t slot = old_index->slots[i];
+    if (slot!=0) {
+      gt_string* const entry = gt_seq_name_table_get_entry(seq_name_table,GT_SEQ_NAME_SLOT_GET_ID(slot));
+      gt_seq_name_index_insert(new_index,gt_seq_name_hash(entry->buffer,entry->length),slot);
+    }
+  }
+  __sync_synchronize();
+  seq_name_table->index = new_index;
+  gt_vector_insert(seq_name_table->retired_indexes,old_index,gt_seq_name_index*);
+}
+GT_INLINE uint32_t gt_seq_name_table_add(gt_seq_name_table* const seq_name_table,
+    const char* const name,const uint64_t length,const uint64_t hash) {
+  const uint64_t seq_name_id = seq_name_table->num_names;
+  const uint64_t chunk_num = seq_name_id>>GT_SEQ_NAME_TABLE_CHUNK_BITS;
+  gt_cond_fatal_error(chunk_num>=GT_SEQ_NAME_TABLE_MAX_CHUNKS,SEQ_NAME_TABLE_FULL);
+  if (seq_name_table->chunks[chunk_num]==NULL) {
+    seq_name_table->chunks[chunk_num] = gt_calloc(GT_SEQ_NAME_TABLE_CHUNK_SIZE,gt_string,true);
+  }
+  // Store the name
+  gt_string* const entry = gt_seq_name_table_get_entry(seq_name_table,seq_name_id);
+  if (length+1 <= GT_STRING_INLINE_SIZE) {
+    entry->memory = entry->inline_buffer;
+    entry->allocated = GT_STRING_INLINE_SIZE;
+  } else {
+    entry->memory = gt_malloc(length+1);
+    entry->allocated = length+1;
+  }
+  entry->buffer = entry->memory;
+  memcpy(entry->buffer,name,length);
+  entry->buffer[length] = EOS;
+  entry->length = length;
+  __sync_synchronize();
+  seq_name_table->num_names = seq_name_id+1;
+  // Index it (keeping the load under 1/2)
+  if (2*(seq_name_id+1) > seq_name_table->index->num_slots) gt_seq_name_table_grow_index(seq_name_table);
+  gt_seq_name_index_insert(seq_name_table->index,hash,GT_SEQ_NAME_SLOT(hash,seq_name_id));
+  return seq_name_id;
+}
+
+/*
+ * Accessors
+ */
+GT_INLINE uint32_t gt_seq_name_table_get_id(
+    gt_seq_name_table* const seq_name_table,const char* const name,const uint64_t length) {
+  GT_SEQ_NAME_TABLE_CHECK(seq_name_table);
+  GT_NULL_CHECK(name);
+  const uint64_t hash = gt_seq_name_hash(name,length);
+  uint32_t seq_name_id;
+  // Lock-free lookup (names already in the table)
+  if (gt_expect_true(gt_seq_name_index_lookup(seq_name_table,seq_name_table->index,name,length,hash,&seq_name_id))) {
+    return seq_name_id;
+  }
+  // Add it (unless someone else just did)
+  GT_BEGIN_MUTEX_SECTION(seq_name_table->table_mutex) {
+    if (!gt_seq_name_index_lookup(seq_name_table,seq_name_table->index,name,length,hash,&seq_name_id)) {
+      seq_name_id = gt_seq_name_table_add(seq_name_table,name,length,hash);
+    }
+  } GT_END_MUTEX_SECTION(seq_name_table->table_mutex);
+  return seq_name_id;
+}
+GT_INLINE gt_string* gt_seq_name_table_get_string(gt_seq_name_table* const seq_name_table,const uint32_t seq_name_id) {
+  GT_SEQ_NAME_TABLE_CHECK(seq_name_table);
+  GT_SEQ_NAME_TABLE_CHECK_ID(seq_name_table,seq_name_id);
+  return gt_seq_name_table_get_entry(seq_name_table,seq_name_id);
+}
+GT_INLINE uint64_t gt_seq_name_table_get_num_names(gt_seq_name_table* const seq_name_table) {
+  GT_SEQ_NAME_TABLE_CHECK(seq_name_table);
+  return seq_name_table->num_names;
+}
+GT_INLINE int64_t gt_seq_name_table_cmp(
+    gt_seq_name_table* const seq_name_table,const uint32_t seq_name_id_a,const uint32_t seq_name_id_b) {
+  GT_SEQ_NAME_TABLE_CHECK(seq_name_table);
+  if (seq_name_id_a==seq_name_id_b) return 0;
+  return gt_string_cmp(
+      gt_seq_name_table_get_string(seq_name_table,seq_name_id_a),
+      gt_seq_name_table_get_string(seq_name_table,seq_name_id_b));
+}
+
+/*
+ * Global table
+ */
+gt_seq_name_table* gt_seq_name_table_global = NULL;
+pthread_once_t gt_seq_name_table_global_once = PTHREAD_ONCE_INIT;
+
+void gt_seq_name_table_global_setup(void) {
+  gt_seq_name_table_global = gt_seq_name_table_new();
+}
+GT_INLINE gt_seq_name_table* gt_seq_name_table_get_global(void) {
+  if (gt_expect_false(gt_seq_name_table_global==NULL)) {
+    pthread_once(&gt_seq_name_table_global_once,gt_seq_name_table_global_setup);
+  }
+  return gt_seq_name_table_global;
+}
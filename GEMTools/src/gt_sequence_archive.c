@@ -42,6 +42,7 @@ GT_INLINE void gt_sequence_archive_clear(gt_sequence_archive* const seq_archive)
   }
   // Free MM
   if (seq_archive->mm!=NULL) {
+    gt_mm_acc_sub(GT_MM_ACC_ARCHIVE,seq_archive->mm->allocated);
     gt_mm_free(seq_archive->mm);
     seq_archive->mm = NULL;
   }
@@ -60,7 +61,10 @@ GT_INLINE void gt_sequence_archive_delete(gt_sequence_archive* const seq_archive
     gt_shash_delete(seq_archive->bed_intervals,false); // Clear BED intervals
   }
   // Free MM
-  if (seq_archive->mm!=NULL) gt_mm_free(seq_archive->mm);
+  if (seq_archive->mm!=NULL) {
+    gt_mm_acc_sub(GT_MM_ACC_ARCHIVE,seq_archive->mm->allocated);
+    gt_mm_free(seq_archive->mm);
+  }
   // Free handler
   gt_free(seq_archive);
 }
@@ -234,20 +238,17 @@ int gt_sequence_archive_karyotypic_sort_fx(char *a,char *b) {
   return str_cmp_ab;
 }
 
-#define gt_string_cmp_wrapper(arg1,arg2) gt_string_cmp((char*)arg1,(char*)arg2)
-#define gt_sequence_archive_lexicographical_sort_fx_wrapper(arg1,arg2) gt_sequence_archive_lexicographical_sort_fx((char*)arg1,(char*)arg2)
-#define gt_sequence_archive_karyotypic_sort_fx_wrapper(arg1,arg2) gt_sequence_archive_karyotypic_sort_fx((char*)arg1,(char*)arg2)
 GT_INLINE void gt_sequence_archive_sort(gt_sequence_archive* const seq_archive,int (*gt_string_cmp)(char*,char*)) {
   GT_SEQUENCE_ARCHIVE_CHECK(seq_archive);
-  HASH_SORT(seq_archive->sequences->shash_head,gt_string_cmp_wrapper);
+  gt_shash_sort_by_key(seq_archive->sequences,gt_string_cmp);
 }
 GT_INLINE void gt_sequence_archive_lexicographical_sort(gt_sequence_archive* const seq_archive) {
   GT_SEQUENCE_ARCHIVE_CHECK(seq_archive);
-  HASH_SORT(seq_archive->sequences->shash_head,gt_sequence_archive_lexicographical_sort_fx_wrapper);
+  gt_shash_sort_by_key(seq_archive->sequences,gt_sequence_archive_lexicographical_sort_fx);
 }
 GT_INLINE void gt_sequence_archive_karyotypic_sort(gt_sequence_archive* const seq_archive) {
   GT_SEQUENCE_ARCHIVE_CHECK(seq_archive);
-  HASH_SORT(seq_archive->sequences->shash_head,gt_sequence_archive_karyotypic_sort_fx_wrapper);
+  gt_shash_sort_by_key(seq_archive->sequences,gt_sequence_archive_karyotypic_sort_fx);
 }
 
 /*
@@ -258,17 +259,18 @@ GT_INLINE void gt_sequence_archive_new_iterator(
   GT_SEQUENCE_ARCHIVE_CHECK(seq_archive);
   GT_NULL_CHECK(seq_archive_iterator);
   seq_archive_iterator->sequence_archive = seq_archive;
-  seq_archive_iterator->shash_it = seq_archive->sequences->shash_head;
+  gt_shash_iterator_init(&seq_archive_iterator->shash_it,seq_archive->sequences);
+  seq_archive_iterator->shash_it_eos = !gt_shash_iterator_next(&seq_archive_iterator->shash_it);
 }
 GT_INLINE bool gt_sequence_archive_iterator_eos(gt_sequence_archive_iterator* const seq_archive_iterator) {
   GT_SEQUENCE_ARCHIVE_ITERATOR_CHECK(seq_archive_iterator);
-  return seq_archive_iterator->shash_it==NULL;
+  return seq_archive_iterator->shash_it_eos;
 }
 GT_INLINE gt_segmented_sequence* gt_sequence_archive_iterator_next(gt_sequence_archive_iterator* const seq_archive_iterator) {
   GT_SEQUENCE_ARCHIVE_ITERATOR_CHECK(seq_archive_iterator);
-  if (seq_archive_iterator->shash_it) {
-    gt_segmented_sequence* elm =  seq_archive_iterator->shash_it->element;
-    seq_archive_iterator->shash_it = seq_archive_iterator->shash_it->hh.next;
+  if (!seq_archive_iterator->shash_it_eos) {
+    gt_segmented_sequence* elm = gt_shash_iterator_get_element(&seq_archive_iterator->shash_it);
+    seq_archive_iterator->shash_it_eos = !gt_shash_iterator_next(&seq_archive_iterator->shash_it);
     return elm;
   } else {
     return NULL;
@@ -29,14 +29,118 @@ GT_INLINE void gt_shash_free_element(gt_shash_element* const shash_element) {
       break;
   }
 }
-GT_INLINE void gt_shash_free_shash_element(gt_shash_element* const shash_element,const bool free_element) {
-  GT_NULL_CHECK(shash_element);
-  // Free key
-  gt_free(shash_element->key);
-  // Free element
-  if (free_element) gt_shash_free_element(shash_element);
-  // Free handler
-  gt_free(shash_element);
+
+/*
+ * Keys
+ */
+#define gt_shash_keys_chunk_get_previous(keys_chunk) (*((char**)(keys_chunk)))
+GT_INLINE char* gt_shash_store_key(gt_shash* const shash,const char* const key,const uint64_t key_length) {
+  // Open a new chunk (if needed)
+  if (gt_expect_false(shash->keys_chunk_used+key_length+1 > shash->keys_chunk_size)) {
+    uint64_t chunk_size = (shash->keys_chunk==NULL) ? GT_SHASH_KEYS_INITIAL_CHUNK_SIZE :
+        GT_MIN(2*shash->keys_chunk_size,GT_SHASH_KEYS_MAX_CHUNK_SIZE);
+    chunk_size = GT_MAX(chunk_size,sizeof(char*)+key_length+1);
+    char* const keys_chunk = gt_malloc(chunk_size);
+    gt_shash_keys_chunk_get_previous(keys_chunk) = shash->keys_chunk;
+    shash->keys_chunk = keys_chunk;
+    shash->keys_chunk_used = sizeof(char*);
+    shash->keys_chunk_size = chunk_size;
+  }
+  // Store key
+  char* const key_cp = shash->keys_chunk+shash->keys_chunk_used;
+  memcpy(key_cp,key,key_length);
+  key_cp[key_length] = EOS;
+  shash->keys_chunk_used += key_length+1;
+  return key_cp;
+}
+GT_INLINE void gt_shash_clear_keys(gt_shash* const shash,const bool keep_last_chunk) {
+  if (shash->keys_chunk==NULL) return;
+  char* keys_chunk = gt_shash_keys_chunk_get_previous(shash->keys_chunk);
+  while (keys_chunk!=NULL) {
+    char* const previous_chunk = gt_shash_keys_chunk_get_previous(keys_chunk);
+    gt_free(keys_chunk);
+    keys_chunk = previous_chunk;
+  }
+  if (keep_last_chunk) {
+    gt_shash_keys_chunk_get_previous(shash->keys_chunk) = NULL;
+    shash->keys_chunk_used = sizeof(char*);
+  } else {
+    gt_free(shash->keys_chunk);
+    shash->keys_chunk = NULL;
+    shash->keys_chunk_used = 0;
+    shash->keys_chunk_size = 0;
+  }
+}
+
+/*
+ * Dense array & Index
+ */
+GT_INLINE void gt_shash_rebuild_index(gt_shash* const shash,const uint64_t num_slots) {
+  gt_hash_index_reset(&shash->index,num_slots);
+  uint64_t i;
+  for (i=0;i<shash->elements_used;++i) {
+    if (shash->elements[i].key==NULL) continue;
+    gt_hash_index_insert(&shash->index,shash->elements[i].hash,i);
+  }
+}
+GT_INLINE void gt_shash_compact(gt_shash* const shash) {
+  uint64_t i, used = 0;
+  for (i=0;i<shash->elements_used;++i) {
+    if (shash->elements[i].key!=NULL) shash->elements[used++] = shash->elements[i];
+  }
+  shash->elements_used = used;
+  gt_shash_rebuild_index(shash,shash->index.num_slots);
+}
+GT_INLINE uint64_t gt_shash_find_slot(
+    gt_shash* const shash,const char* const key,const uint64_t key_length,const uint64_t hash) {
+  if (gt_expect_false(shash->index.num_slots==0)) return UINT64_MAX;
+  const uint64_t* const slots = shash->index.slots;
+  const uint64_t mask = shash->index.num_slots-1;
+  uint64_t slot_num = GT_HASH_INDEX_HOME(hash,shash->index.num_slots);
+  while (slots[slot_num]!=0) {
+    if (GT_HASH_INDEX_SLOT_MATCHES(slots[slot_num],hash)) {
+      gt_shash_element* const shash_element = shash->elements+GT_HASH_INDEX_SLOT_GET_POSITION(slots[slot_num]);
+      if (shash_element->hash==hash && shash_element->key_length==key_length &&
+          memcmp(shash_element->key,key,key_length)==0) return slot_num;
+    }
+    slot_num = (slot_num+1)&mask;
+  }
+  return UINT64_MAX;
+}
+GT_INLINE gt_shash_element* gt_shash_add_shash_element(
+    gt_shash* const shash,const char* const key,const uint64_t key_length,const uint64_t hash) {
+  // Make room in the dense array (squeezing out removed elements first)
+  if (gt_expect_false(shash->elements_used==shash->elements_allocated)) {
+    if (shash->num_elements < shash->elements_used/2) {
+      gt_shash_compact(shash);
+    } else {
+      shash->elements_allocated = (shash->elements_allocated==0) ? GT_HASH_INITIAL_ELEMENTS : 2*shash->elements_allocated;
+      shash->elements = realloc(shash->elements,shash->elements_allocated*sizeof(gt_shash_element));
+      gt_cond_fatal_error(shash->elements==NULL,MEM_REALLOC);
+    }
+  }
+  // Grow the index
+  if (gt_expect_false(gt_hash_index_is_full(&shash->index,shash->num_elements+1))) {
+    gt_shash_rebuild_index(shash,(shash->index.num_slots==0) ? GT_HASH_INDEX_INITIAL_SLOTS : 2*shash->index.num_slots);
+  }
+  // Add
+  const uint64_t position = shash->elements_used++;
+  gt_shash_element* const shash_element = shash->elements+position;
+  shash_element->key = gt_shash_store_key(shash,key,key_length);
+  shash_element->key_length = key_length;
+  shash_element->hash = hash;
+  gt_hash_index_insert(&shash->index,hash,position);
+  ++(shash->num_elements);
+  return shash_element;
+}
+GT_INLINE gt_shash_element* gt_shash_get_or_add_shash_element(gt_shash* const shash,char* const key) {
+  uint64_t key_length;
+  const uint64_t hash = gt_hash_string(key,&key_length);
+  const uint64_t slot_num = gt_shash_find_slot(shash,key,key_length,hash);
+  if (gt_expect_true(slot_num==UINT64_MAX)) return gt_shash_add_shash_element(shash,key,key_length,hash);
+  gt_shash_element* const shash_element = shash->elements+GT_HASH_INDEX_SLOT_GET_POSITION(shash->index.slots[slot_num]);
+  gt_shash_free_element(shash_element);
+  return shash_element;
 }
 
 /*
@@ -44,26 +148,43 @@ GT_INLINE void gt_shash_free_shash_element(gt_shash_element* const shash_element
  */
 GT_INLINE gt_shash* gt_shash_new(void) {
   gt_shash* shash = gt_alloc(gt_shash);
-  shash->shash_head = NULL; // uthash initializer
+  shash->elements = NULL;
+  shash->elements_used = 0;
+  shash->elements_allocated = 0;
+  shash->num_elements = 0;
+  gt_hash_index_init(&shash->index);
+  shash->keys_chunk = NULL;
+  shash->keys_chunk_used = 0;
+  shash->keys_chunk_size = 0;
   return shash;
 }
 GT_INLINE void gt_shash_clear(gt_shash* const shash,const bool free_element) {
   GT_HASH_CHECK(shash);
-  gt_shash_element *shash_element, *tmp;
-  HASH_ITER(hh,shash->shash_head,shash_element,tmp) {
-    HASH_DEL(shash->shash_head,shash_element);
-    gt_shash_free_shash_element(shash_element,free_element);
+  if (free_element) {
+    GT_SHASH_BEGIN_ELEMENT_ITERATE_(shash) {
+      gt_shash_free_element(shash_sh_element);
+    } GT_SHASH_END_ITERATE;
   }
+  shash->elements_used = 0;
+  shash->num_elements = 0;
+  gt_hash_index_clear(&shash->index);
+  gt_shash_clear_keys(shash,true);
 }
 GT_INLINE void gt_shash_delete(gt_shash* const shash,const bool free_element) {
   GT_HASH_CHECK(shash);
-  gt_shash_clear(shash,free_element);
+  if (free_element) {
+    GT_SHASH_BEGIN_ELEMENT_ITERATE_(shash) {
+      gt_shash_free_element(shash_sh_element);
+    } GT_SHASH_END_ITERATE;
+  }
+  if (shash->elements!=NULL) free(shash->elements);
+  gt_hash_index_destroy(&shash->index);
+  gt_shash_clear_keys(shash,false);
   gt_free(shash);
 }
 GT_INLINE void gt_shash_destroy(gt_shash* const shash) {
   GT_HASH_CHECK(shash);
-  gt_shash_clear(shash,true);
-  gt_free(shash);
+  gt_shash_delete(shash,true);
 }
 
 /*
@@ -72,26 +193,18 @@ GT_INLINE void gt_shash_destroy(gt_shash* const shash) {
 GT_INLINE gt_shash_element* gt_shash_get_shash_element(gt_shash* const shash,char* const key) {
   GT_HASH_CHECK(shash);
   GT_NULL_CHECK(key);
-  gt_shash_element *shash_element;
-  HASH_FIND_STR(shash->shash_head,key,shash_element);
-  return shash_element;
+  uint64_t key_length;
+  const uint64_t hash = gt_hash_string(key,&key_length);
+  const uint64_t slot_num = gt_shash_find_slot(shash,key,key_length,hash);
+  return (slot_num==UINT64_MAX) ? NULL : shash->elements+GT_HASH_INDEX_SLOT_GET_POSITION(shash->index.slots[slot_num]);
 }
 GT_INLINE char* gt_shash_insert_primitive(
     gt_shash* const shash,char* const key,void* const element,const int64_t element_size) {
   GT_HASH_CHECK(shash);
   GT_ZERO_CHECK(element_size);
   GT_NULL_CHECK(key); GT_NULL_CHECK(element);
-  gt_shash_element *shash_element = gt_shash_get_shash_element(shash,key);
-  if (gt_expect_true(shash_element==NULL)) {
-    shash_element = gt_alloc(gt_shash_element);
-    const uint64_t key_length = strlen(key);
-    shash_element->key = gt_strndup(key,key_length);
-    shash_element->element = element;
-    HASH_ADD_KEYPTR(hh,shash->shash_head,shash_element->key,key_length,shash_element);
-  } else {
-    gt_shash_free_element(shash_element);
-    shash_element->element = element;
-  }
+  gt_shash_element* const shash_element = gt_shash_get_or_add_shash_element(shash,key);
+  shash_element->element = element;
   // Set shash element type
   shash_element->element_type = GT_HASH_TYPE_REGULAR;
   shash_element->element_size = element_size;
@@ -104,17 +217,8 @@ GT_INLINE char* gt_shash_insert_object(
   GT_HASH_CHECK(shash);
   GT_NULL_CHECK(key); GT_NULL_CHECK(object);
   GT_NULL_CHECK(element_dup_fx); GT_NULL_CHECK(element_free_fx);
-  gt_shash_element *shash_element = gt_shash_get_shash_element(shash,key);
-  if (gt_expect_true(shash_element==NULL)) {
-    shash_element = gt_alloc(gt_shash_element);
-    const uint64_t key_length = strlen(key);
-    shash_element->key = gt_strndup(key,key_length);
-    shash_element->element = object;
-    HASH_ADD_KEYPTR(hh,shash->shash_head,shash_element->key,key_length,shash_element);
-  } else {
-    gt_shash_free_element(shash_element);
-    shash_element->element = object;
-  }
+  gt_shash_element* const shash_element = gt_shash_get_or_add_shash_element(shash,key);
+  shash_element->element = object;
   // Set shash element type
   shash_element->element_type = GT_HASH_TYPE_OBJECT;
   shash_element->element_setup.element_dup_fx = element_dup_fx;
@@ -137,10 +241,15 @@ GT_INLINE void* gt_shash_get_element(gt_shash* const shash,char* const key) {
 GT_INLINE void gt_shash_remove(gt_shash* const shash,char* const key,const bool free_element) {
   GT_HASH_CHECK(shash);
   GT_NULL_CHECK(key);
-  gt_shash_element *shash_element = gt_shash_get_shash_element(shash,key);
-  if (shash_element) {
-    HASH_DEL(shash->shash_head,shash_element);
-    gt_shash_free_shash_element(shash_element,free_element);
+  uint64_t key_length;
+  const uint64_t hash = gt_hash_string(key,&key_length);
+  const uint64_t slot_num = gt_shash_find_slot(shash,key,key_length,hash);
+  if (slot_num!=UINT64_MAX) {
+    gt_shash_element* const shash_element = shash->elements+GT_HASH_INDEX_SLOT_GET_POSITION(shash->index.slots[slot_num]);
+    if (free_element) gt_shash_free_element(shash_element);
+    shash_element->key = NULL; // Its memory is reclaimed when cleared
+    gt_hash_index_remove(&shash->index,slot_num);
+    --(shash->num_elements);
   }
 }
 
@@ -154,7 +263,7 @@ GT_INLINE bool gt_shash_is_contained(gt_shash* const shash,char* const key) {
 }
 GT_INLINE uint64_t gt_shash_get_num_elements(gt_shash* const shash) {
   GT_HASH_CHECK(shash);
-  return (uint64_t)HASH_COUNT(shash->shash_head);
+  return shash->num_elements;
 }
 
 /*
@@ -186,17 +295,37 @@ GT_INLINE void gt_shash_copy(gt_shash* const shash_dst,gt_shash* const shash_src
     }
   } GT_SHASH_END_ITERATE;
 }
+__thread int (*gt_shash_key_cmp_fx)(char*,char*);
+int gt_shash_cmp_keys(const gt_shash_element* const a,const gt_shash_element* const b) {
+  return gt_shash_key_cmp_fx(a->key,b->key);
+}
+GT_INLINE void gt_shash_sort_by_key(gt_shash* const shash,int (*key_cmp_fx)(char*,char*)) {
+  GT_HASH_CHECK(shash);
+  GT_NULL_CHECK(key_cmp_fx);
+  if (shash->num_elements==0) return;
+  // Sort the dense array (once compacted) and reindex it
+  if (shash->num_elements < shash->elements_used) gt_shash_compact(shash);
+  gt_shash_key_cmp_fx = key_cmp_fx;
+  qsort(shash->elements,shash->elements_used,sizeof(gt_shash_element),
+      (int (*)(const void *,const void *))gt_shash_cmp_keys);
+  gt_shash_rebuild_index(shash,shash->index.num_slots);
+}
 
 /*
  * Iterator
  */
+GT_INLINE void gt_shash_iterator_init(gt_shash_iterator* const shash_iterator,gt_shash* const shash) {
+  GT_HASH_CHECK(shash);
+  shash_iterator->shash = shash;
+  shash_iterator->next = 0;
+  shash_iterator->current = NULL;
+}
 GT_INLINE gt_shash_iterator* gt_shash_iterator_new(gt_shash* const shash) {
   GT_HASH_CHECK(shash);
   // Allocate
   gt_shash_iterator* const shash_iterator = gt_alloc(gt_shash_iterator);
   // Init
-  shash_iterator->shash = shash;
-  shash_iterator->next = shash;
+  gt_shash_iterator_init(shash_iterator,shash);
   return shash_iterator;
 }
 GT_INLINE void gt_shash_iterator_delete(gt_shash_iterator* const shash_iterator) {
@@ -205,18 +334,24 @@ GT_INLINE void gt_shash_iterator_delete(gt_shash_iterator* const shash_iterator)
 }
 GT_INLINE bool gt_shash_iterator_next(gt_shash_iterator* const shash_iterator) {
   GT_HASH_CHECK(shash_iterator->shash);
-  if (gt_expect_false(shash_iterator->next==NULL)) return false;
-  shash_iterator->next = shash_iterator->next->hh.next;
-  return true;
+  gt_shash* const shash = shash_iterator->shash;
+  while (shash_iterator->next < shash->elements_used) {
+    gt_shash_element* const shash_element = shash->elements+(shash_iterator->next++);
+    if (shash_element->key!=NULL) {
+      shash_iterator->current = shash_element;
+      return true;
+    }
+  }
+  shash_iterator->current = NULL;
+  return false;
 }
 GT_INLINE char* gt_shash_iterator_get_key(gt_shash_iterator* const shash_iterator) {
   GT_HASH_CHECK(shash_iterator->shash);
-  GT_HASH_CHECK(shash_iterator->next);
-  return shash_iterator->next->key;
+  GT_HASH_CHECK(shash_iterator->current);
+  return shash_iterator->current->key;
 }
 GT_INLINE void* gt_shash_iterator_get_element(gt_shash_iterator* const shash_iterator) {
   GT_HASH_CHECK(shash_iterator->shash);
-  GT_HASH_CHECK(shash_iterator->next);
-  return shash_iterator->next->element;
+  GT_HASH_CHECK(shash_iterator->current);
+  return shash_iterator->current->element;
 }
-
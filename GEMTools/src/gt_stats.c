@@ -17,6 +17,18 @@
   for (iii=0;iii<RANGE;++iii) { VECTOR_A[iii] += VECTOR_B[iii]; } \
 }
 
+/*
+ * Counters (accounted as GT_MM_ACC_STATS)
+ */
+GT_INLINE uint64_t* gt_stats_counters_new(const uint64_t num_counters) {
+  gt_mm_acc_add(GT_MM_ACC_STATS,num_counters*sizeof(uint64_t));
+  return gt_calloc(num_counters,uint64_t,true);
+}
+GT_INLINE void gt_stats_counters_delete(uint64_t* const counters,const uint64_t num_counters) {
+  gt_mm_acc_sub(GT_MM_ACC_STATS,num_counters*sizeof(uint64_t));
+  gt_free(counters);
+}
+
 /*
  * MAPS Error Profile
  */
@@ -27,17 +39,17 @@ GT_INLINE gt_maps_profile* gt_maps_profile_new() {
    * Init
    */
   // Mismatch/Indel Profile
-  maps_profile->mismatches = gt_calloc(GT_STATS_MISMS_RANGE,uint64_t,true);
-  maps_profile->levenshtein = gt_calloc(GT_STATS_MISMS_RANGE,uint64_t,true);
-  maps_profile->insertion_length = gt_calloc(GT_STATS_MISMS_RANGE,uint64_t,true);
-  maps_profile->deletion_length = gt_calloc(GT_STATS_MISMS_RANGE,uint64_t,true);
-  maps_profile->errors_events = gt_calloc(GT_STATS_MISMS_RANGE,uint64_t,true);
+  maps_profile->mismatches = gt_stats_counters_new(GT_STATS_MISMS_RANGE);
+  maps_profile->levenshtein = gt_stats_counters_new(GT_STATS_MISMS_RANGE);
+  maps_profile->insertion_length = gt_stats_counters_new(GT_STATS_MISMS_RANGE);
+  maps_profile->deletion_length = gt_stats_counters_new(GT_STATS_MISMS_RANGE);
+  maps_profile->errors_events = gt_stats_counters_new(GT_STATS_MISMS_RANGE);
   // Mismatch/Indel Distribution
   maps_profile->total_mismatches=0;
   maps_profile->total_levenshtein=0;
   maps_profile->total_indel_length=0;
   maps_profile->total_errors_events=0;
-  maps_profile->error_position = gt_calloc(GT_STATS_LARGE_READ_POS_RANGE,uint64_t,true);
+  maps_profile->error_position = gt_stats_counters_new(GT_STATS_LARGE_READ_POS_RANGE);
   // Trim/Mapping stats
   maps_profile->total_bases=0;
   maps_profile->total_bases_matching=0;
@@ -50,18 +62,18 @@ GT_INLINE gt_maps_profile* gt_maps_profile_new() {
   maps_profile->pair_strand_ff=0;
   maps_profile->pair_strand_rr=0;
   // Insert Size Distribution
-  maps_profile->inss = gt_calloc(GT_STATS_INSS_RANGE,uint64_t,true);
+  maps_profile->inss = gt_stats_counters_new(GT_STATS_INSS_RANGE);
   // Mismatch/Errors bases
-  maps_profile->misms_transition = gt_calloc(GT_STATS_MISMS_BASE_RANGE*GT_STATS_MISMS_BASE_RANGE,uint64_t,true);
-  maps_profile->qual_score_misms = gt_calloc(GT_STATS_QUAL_SCORE_RANGE,uint64_t,true);
-  maps_profile->misms_1context = gt_calloc(GT_STATS_MISMS_1_CONTEXT_RANGE,uint64_t,true);
-  maps_profile->indel_transition_1 = gt_calloc(GT_STATS_INDEL_TRANSITION_1_RANGE,uint64_t,true);
-  maps_profile->indel_transition_2 = gt_calloc(GT_STATS_INDEL_TRANSITION_2_RANGE,uint64_t,true);
-  maps_profile->indel_transition_3 = gt_calloc(GT_STATS_INDEL_TRANSITION_3_RANGE,uint64_t,true);
-  maps_profile->indel_transition_4 = gt_calloc(GT_STATS_INDEL_TRANSITION_4_RANGE,uint64_t,true);
-  maps_profile->indel_1context = gt_calloc(GT_STATS_INDEL_1_CONTEXT,uint64_t,true);
-  maps_profile->indel_2context = gt_calloc(GT_STATS_INDEL_2_CONTEXT,uint64_t,true);
-  maps_profile->qual_score_errors = gt_calloc(GT_STATS_QUAL_SCORE_RANGE,uint64_t,true);
+  maps_profile->misms_transition = gt_stats_counters_new(GT_STATS_MISMS_BASE_RANGE*GT_STATS_MISMS_BASE_RANGE);
+  maps_profile->qual_score_misms = gt_stats_counters_new(GT_STATS_QUAL_SCORE_RANGE);
+  maps_profile->misms_1context = gt_stats_counters_new(GT_STATS_MISMS_1_CONTEXT_RANGE);
+  maps_profile->indel_transition_1 = gt_stats_counters_new(GT_STATS_INDEL_TRANSITION_1_RANGE);
+  maps_profile->indel_transition_2 = gt_stats_counters_new(GT_STATS_INDEL_TRANSITION_2_RANGE);
+  maps_profile->indel_transition_3 = gt_stats_counters_new(GT_STATS_INDEL_TRANSITION_3_RANGE);
+  maps_profile->indel_transition_4 = gt_stats_counters_new(GT_STATS_INDEL_TRANSITION_4_RANGE);
+  maps_profile->indel_1context = gt_stats_counters_new(GT_STATS_INDEL_1_CONTEXT);
+  maps_profile->indel_2context = gt_stats_counters_new(GT_STATS_INDEL_2_CONTEXT);
+  maps_profile->qual_score_errors = gt_stats_counters_new(GT_STATS_QUAL_SCORE_RANGE);
   return maps_profile;
 }
 GT_INLINE void gt_maps_profile_clear(gt_maps_profile* const maps_profile) {
@@ -108,26 +120,26 @@ GT_INLINE void gt_maps_profile_clear(gt_maps_profile* const maps_profile) {
 }
 GT_INLINE void gt_maps_profile_delete(gt_maps_profile* const maps_profile) {
   // Mismatch/Indel Profile
-  gt_free(maps_profile->mismatches);
-  gt_free(maps_profile->levenshtein);
-  gt_free(maps_profile->insertion_length);
-  gt_free(maps_profile->deletion_length);
-  gt_free(maps_profile->errors_events);
+  gt_stats_counters_delete(maps_profile->mismatches,GT_STATS_MISMS_RANGE);
+  gt_stats_counters_delete(maps_profile->levenshtein,GT_STATS_MISMS_RANGE);
+  gt_stats_counters_delete(maps_profile->insertion_length,GT_STATS_MISMS_RANGE);
+  gt_stats_counters_delete(maps_profile->deletion_length,GT_STATS_MISMS_RANGE);
+  gt_stats_counters_delete(maps_profile->errors_events,GT_STATS_MISMS_RANGE);
   // Mismatch/Indel Distribution
-  gt_free(maps_profile->error_position);
+  gt_stats_counters_delete(maps_profile->error_position,GT_STATS_LARGE_READ_POS_RANGE);
   // Insert Size Distribution
-  gt_free(maps_profile->inss);
+  gt_stats_counters_delete(maps_profile->inss,GT_STATS_INSS_RANGE);
   // Mismatch/Errors bases
-  gt_free(maps_profile->misms_transition);
-  gt_free(maps_profile->qual_score_misms);
-  gt_free(maps_profile->misms_1context);
-  gt_free(maps_profile->indel_transition_1);
-  gt_free(maps_profile->indel_transition_2);
-  gt_free(maps_profile->indel_transition_3);
-  gt_free(maps_profile->indel_transition_4);
-  gt_free(maps_profile->indel_1context);
-  gt_free(maps_profile->indel_2context);
-  gt_free(maps_profile->qual_score_errors);
+  gt_stats_counters_delete(maps_profile->misms_transition,GT_STATS_MISMS_BASE_RANGE*GT_STATS_MISMS_BASE_RANGE);
+  gt_stats_counters_delete(maps_profile->qual_score_misms,GT_STATS_QUAL_SCORE_RANGE);
+  gt_stats_counters_delete(maps_profile->misms_1context,GT_STATS_MISMS_1_CONTEXT_RANGE);
+  gt_stats_counters_delete(maps_profile->indel_transition_1,GT_STATS_INDEL_TRANSITION_1_RANGE);
+  gt_stats_counters_delete(maps_profile->indel_transition_2,GT_STATS_INDEL_TRANSITION_2_RANGE);
+  gt_stats_counters_delete(maps_profile->indel_transition_3,GT_STATS_INDEL_TRANSITION_3_RANGE);
+  gt_stats_counters_delete(maps_profile->indel_transition_4,GT_STATS_INDEL_TRANSITION_4_RANGE);
+  gt_stats_counters_delete(maps_profile->indel_1context,GT_STATS_INDEL_1_CONTEXT);
+  gt_stats_counters_delete(maps_profile->indel_2context,GT_STATS_INDEL_2_CONTEXT);
+  gt_stats_counters_delete(maps_profile->qual_score_errors,GT_STATS_QUAL_SCORE_RANGE);
   gt_free(maps_profile);
 }
 GT_INLINE void gt_maps_profile_merge(
@@ -183,9 +195,9 @@ GT_INLINE gt_splitmaps_profile* gt_splitmaps_profile_new() {
   splitmaps_profile->num_mapped_only_splitmaps = 0;
   splitmaps_profile->total_splitmaps = 0;
   splitmaps_profile->total_junctions = 0;
-  splitmaps_profile->num_junctions = gt_calloc(GT_STATS_NUM_JUNCTION_RANGE,uint64_t,true);
-  splitmaps_profile->length_junctions = gt_calloc(GT_STATS_LEN_JUNCTION_RANGE,uint64_t,true);
-  splitmaps_profile->junction_position = gt_calloc(GT_STATS_SHORT_READ_POS_RANGE,uint64_t,true);
+  splitmaps_profile->num_junctions = gt_stats_counters_new(GT_STATS_NUM_JUNCTION_RANGE);
+  splitmaps_profile->length_junctions = gt_stats_counters_new(GT_STATS_LEN_JUNCTION_RANGE);
+  splitmaps_profile->junction_position = gt_stats_counters_new(GT_STATS_SHORT_READ_POS_RANGE);
   // Paired SM combinations
   splitmaps_profile->pe_sm_sm = 0;
   splitmaps_profile->pe_sm_rm = 0;
@@ -210,9 +222,9 @@ GT_INLINE void gt_splitmaps_profile_clear(gt_splitmaps_profile* const splitmaps_
   splitmaps_profile->pe_rm_rm = 0;
 }
 GT_INLINE void gt_splitmaps_profile_delete(gt_splitmaps_profile* const splitmaps_profile) {
-  gt_free(splitmaps_profile->num_junctions);
-  gt_free(splitmaps_profile->length_junctions);
-  gt_free(splitmaps_profile->junction_position);
+  gt_stats_counters_delete(splitmaps_profile->num_junctions,GT_STATS_NUM_JUNCTION_RANGE);
+  gt_stats_counters_delete(splitmaps_profile->length_junctions,GT_STATS_LEN_JUNCTION_RANGE);
+  gt_stats_counters_delete(splitmaps_profile->junction_position,GT_STATS_SHORT_READ_POS_RANGE);
   gt_free(splitmaps_profile);
 }
 GT_INLINE void gt_splitmaps_profile_merge(
@@ -240,9 +252,9 @@ GT_INLINE gt_population_profile* gt_population_profile_new() {
    * Init
    */
   // Diversity
-  population_profile->local_diversity = gt_calloc(GT_STATS_DIVERSITY_RANGE,uint64_t,true);
-  population_profile->local_dominant = gt_calloc(GT_STATS_DOMINANT_RANGE,uint64_t,true);
-  population_profile->local_diversity__dominant = gt_calloc(GT_STATS_DIVERSITY_DOMINANT_RANGE,uint64_t,true);
+  population_profile->local_diversity = gt_stats_counters_new(GT_STATS_DIVERSITY_RANGE);
+  population_profile->local_dominant = gt_stats_counters_new(GT_STATS_DOMINANT_RANGE);
+  population_profile->local_diversity__dominant = gt_stats_counters_new(GT_STATS_DIVERSITY_DOMINANT_RANGE);
   population_profile->global_diversity = 0;
   // Quimeras
   population_profile->num_map_quimeras = 0;
@@ -266,9 +278,9 @@ GT_INLINE void gt_population_profile_clear(gt_population_profile* const populati
   gt_shash_clear(population_profile->_global_diversity_hash,true);
 }
 GT_INLINE void gt_population_profile_delete(gt_population_profile* const population_profile) {
-  gt_free(population_profile->local_diversity);
-  gt_free(population_profile->local_dominant);
-  gt_free(population_profile->local_diversity__dominant);
+  gt_stats_counters_delete(population_profile->local_diversity,GT_STATS_DIVERSITY_RANGE);
+  gt_stats_counters_delete(population_profile->local_dominant,GT_STATS_DOMINANT_RANGE);
+  gt_stats_counters_delete(population_profile->local_diversity__dominant,GT_STATS_DIVERSITY_DOMINANT_RANGE);
 }
 GT_INLINE void gt_population_profile_merge(
     gt_population_profile* const population_profile_dst,gt_population_profile* const population_profile_src) {
@@ -508,22 +520,22 @@ GT_INLINE gt_stats* gt_stats_new() {
   stats->total_bases_aligned=0;
   stats->mapped_min_length=UINT64_MAX;
   stats->mapped_max_length=0;
-  stats->length = gt_calloc(GT_STATS_LENGTH_RANGE,uint64_t,true);
-  stats->length_mapped = gt_calloc(GT_STATS_LENGTH_RANGE,uint64_t,true);
-  stats->length__mmap = gt_calloc(GT_STATS_LENGTH__MMAP_RANGE,uint64_t,true);
-  stats->length__quality = gt_calloc(GT_STATS_LENGTH__QUAL_SCORE_RANGE,uint64_t,true);
-  stats->avg_quality = gt_calloc(GT_STATS_QUAL_SCORE_RANGE,uint64_t,true);
-  stats->mmap__avg_quality = gt_calloc(GT_STATS_QUAL_SCORE__MMAP_RANGE,uint64_t,true);
+  stats->length = gt_stats_counters_new(GT_STATS_LENGTH_RANGE);
+  stats->length_mapped = gt_stats_counters_new(GT_STATS_LENGTH_RANGE);
+  stats->length__mmap = gt_stats_counters_new(GT_STATS_LENGTH__MMAP_RANGE);
+  stats->length__quality = gt_stats_counters_new(GT_STATS_LENGTH__QUAL_SCORE_RANGE);
+  stats->avg_quality = gt_stats_counters_new(GT_STATS_QUAL_SCORE_RANGE);
+  stats->mmap__avg_quality = gt_stats_counters_new(GT_STATS_QUAL_SCORE__MMAP_RANGE);
   // Nucleotide counting (wrt to the maps=read+errors)
-  stats->nt_counting = gt_calloc(GT_STATS_MISMS_BASE_RANGE,uint64_t,true);
+  stats->nt_counting = gt_stats_counters_new(GT_STATS_MISMS_BASE_RANGE);
   // Mapped/Maps/MMaps/Uniq...
   stats->num_blocks=0;
   stats->num_alignments=0;
   stats->num_maps=0;
   stats->num_mapped=0;
   stats->num_mapped_reads=0;
-  stats->mmap = gt_calloc(GT_STATS_MMAP_RANGE,uint64_t,true); // MMaps
-  stats->uniq = gt_calloc(GT_STATS_UNIQ_RANGE,uint64_t,true); // Uniq
+  stats->mmap = gt_stats_counters_new(GT_STATS_MMAP_RANGE); // MMaps
+  stats->uniq = gt_stats_counters_new(GT_STATS_UNIQ_RANGE); // Uniq
   // Maps Error Profile
   stats->maps_profile = gt_maps_profile_new();
   // Split maps Profile
@@ -566,15 +578,15 @@ GT_INLINE void gt_stats_clear(gt_stats* const stats) {
   gt_population_profile_clear(stats->population_profile);
 }
 GT_INLINE void gt_stats_delete(gt_stats* const stats) {
-  gt_free(stats->length);
-  gt_free(stats->length_mapped);
-  gt_free(stats->length__mmap);
-  gt_free(stats->length__quality);
-  gt_free(stats->avg_quality);
-  gt_free(stats->mmap__avg_quality);
-  gt_free(stats->nt_counting);
-  gt_free(stats->mmap);
-  gt_free(stats->uniq);
+  gt_stats_counters_delete(stats->length,GT_STATS_LENGTH_RANGE);
+  gt_stats_counters_delete(stats->length_mapped,GT_STATS_LENGTH_RANGE);
+  gt_stats_counters_delete(stats->length__mmap,GT_STATS_LENGTH__MMAP_RANGE);
+  gt_stats_counters_delete(stats->length__quality,GT_STATS_LENGTH__QUAL_SCORE_RANGE);
+  gt_stats_counters_delete(stats->avg_quality,GT_STATS_QUAL_SCORE_RANGE);
+  gt_stats_counters_delete(stats->mmap__avg_quality,GT_STATS_QUAL_SCORE__MMAP_RANGE);
+  gt_stats_counters_delete(stats->nt_counting,GT_STATS_MISMS_BASE_RANGE);
+  gt_stats_counters_delete(stats->mmap,GT_STATS_MMAP_RANGE);
+  gt_stats_counters_delete(stats->uniq,GT_STATS_UNIQ_RANGE);
   gt_maps_profile_delete(stats->maps_profile);
   gt_splitmaps_profile_delete(stats->splitmaps_profile);
   gt_population_profile_delete(stats->population_profile);
@@ -654,12 +666,12 @@ GT_INLINE void gt_stats_make_population_profile(
   GT_TEMPLATE_ITERATE(template,mmap) {
     GT_MMAP_ITERATE(mmap,map,end_pos) {
       ++num_maps;
-      gt_stats_add_map_to_population(population_profile->_local_diversity_hash,map->seq_name);
-      gt_stats_add_map_to_population(population_profile->_global_diversity_hash,map->seq_name);
+      gt_stats_add_map_to_population(population_profile->_local_diversity_hash,gt_map_get_string_seq_name(map));
+      gt_stats_add_map_to_population(population_profile->_global_diversity_hash,gt_map_get_string_seq_name(map));
       if (gt_map_segment_get_num_segments(map)>1) ++population_profile->num_map_quimeras;
     }
     if (paired_map) {
-      if (!gt_string_equals(mmap[0]->seq_name,mmap[1]->seq_name)) ++population_profile->num_pair_quimeras;
+      if (mmap[0]->seq_name_id!=mmap[1]->seq_name_id) ++population_profile->num_pair_quimeras;
     }
     // FIRST-MAP :: Break if we just proccess the first one
     if (stats_analysis->first_map) break;
@@ -16,50 +16,92 @@
 #define GT_STRING_STATIC 0
 #define GT_STRING_DEFAULT_BUFFER_SIZE 200
 
+/*
+ * Memory
+ *   @memory is the inline buffer (if it fits) or a heap buffer (otherwise)
+ */
+#define gt_string_memory_is_inline(string) ((string)->memory==(string)->inline_buffer)
+GT_INLINE void gt_string_memory_init(gt_string* const string,const uint64_t buffer_size) {
+  if (buffer_size <= GT_STRING_INLINE_SIZE) {
+    string->memory = string->inline_buffer;
+    string->allocated = GT_STRING_INLINE_SIZE;
+  } else {
+    string->memory = gt_malloc(buffer_size);
+    string->allocated = buffer_size;
+  }
+  string->buffer = string->memory;
+}
+GT_INLINE void gt_string_memory_free(gt_string* const string) {
+  if (string->allocated > 0 && !gt_string_memory_is_inline(string)) gt_free(string->memory);
+  string->memory = NULL;
+  string->allocated = 0;
+}
+GT_INLINE void gt_string_memory_grow(gt_string* const string,const uint64_t new_buffer_size) {
+  if (gt_string_memory_is_inline(string)) {
+    char* const memory = gt_malloc(new_buffer_size);
+    memcpy(memory,string->inline_buffer,GT_STRING_INLINE_SIZE);
+    string->memory = memory;
+  } else {
+    string->memory = realloc(string->memory,new_buffer_size);
+    gt_cond_fatal_error(!string->memory,MEM_REALLOC);
+  }
+  string->allocated = new_buffer_size;
+}
+// Drops the view (if any) without keeping its contents (about to be overwritten)
+#define gt_string_drop_view(string) if ((string)->allocated>0) (string)->buffer = (string)->memory
+
 /*
  * Constructor & Accessors
  */
 GT_INLINE gt_string* gt_string_new(const uint64_t initial_buffer_size) {
-  gt_string* string = gt_alloc(gt_string);
+  gt_string* string = gt_pool_alloc(gt_string);
   // Initialize string
   if (gt_expect_true(initial_buffer_size>0)) {
-    string->buffer = gt_malloc(initial_buffer_size);
+    gt_string_memory_init(string,initial_buffer_size);
     string->buffer[0] = EOS;
   } else {
     string->buffer = NULL;
+    string->memory = NULL;
+    string->allocated = 0;
   }
-  string->allocated = initial_buffer_size;
   string->length = 0;
   return string;
 }
 GT_INLINE gt_string* gt_string_set_new(const char* const string_src) {
   GT_NULL_CHECK(string_src);
-  gt_string* const string = gt_alloc(gt_string);
+  gt_string* const string = gt_pool_alloc(gt_string);
   const uint64_t length = strlen(string_src);
-  string->buffer = gt_malloc(length+1);
-  string->allocated = length+1;
+  gt_string_memory_init(string,length+1);
   gt_strncpy(string->buffer,string_src,length);
   string->length = length;
   return string;
 }
 GT_INLINE void gt_string_resize(gt_string* const string,const uint64_t new_buffer_size) {
   GT_STRING_CHECK_BUFFER(string);
-  if (string->allocated > 0 && string->allocated < new_buffer_size) {
-    string->buffer = realloc(string->buffer,new_buffer_size);
-    gt_cond_fatal_error(!string->buffer,MEM_REALLOC);
-    string->allocated = new_buffer_size;
+  if (string->allocated > 0) {
+    if (gt_expect_false(string->buffer!=string->memory)) { // Copy the view (about to be modified)
+      gt_string_unview(string);
+    }
+    if (string->allocated < new_buffer_size) {
+      gt_string_memory_grow(string,new_buffer_size);
+      string->buffer = string->memory;
+    }
   }
 }
 GT_INLINE void gt_string_clear(gt_string* const string) {
   GT_STRING_CHECK(string);
-  if (string->allocated) string->buffer[0] = EOS;
-  else string->buffer = NULL;
+  if (string->allocated) {
+    gt_string_drop_view(string);
+    string->buffer[0] = EOS;
+  } else {
+    string->buffer = NULL;
+  }
   string->length = 0;
 }
 GT_INLINE void gt_string_delete(gt_string* const string) {
   GT_STRING_CHECK(string);
-  if (string->allocated) gt_free(string->buffer);
-  gt_free(string);
+  gt_string_memory_free(string);
+  gt_pool_free(string,gt_string);
 }
 
 GT_INLINE bool gt_string_is_static(gt_string* const string) {
@@ -68,10 +110,7 @@ GT_INLINE bool gt_string_is_static(gt_string* const string) {
 }
 GT_INLINE void gt_string_cast_static(gt_string* const string) {
   GT_STRING_CHECK(string);
-  if (string->allocated > 0) {
-    gt_free(string->buffer);
-    string->allocated = 0;
-  }
+  gt_string_memory_free(string);
   string->buffer = NULL;
   string->length = 0;
 }
@@ -79,12 +118,13 @@ GT_INLINE void gt_string_cast_dynamic(gt_string* const string,const uint64_t ini
   GT_STRING_CHECK(string);
   if (gt_expect_false(initial_buffer_size==0)) {
     gt_string_cast_static(string);
-  } else {
-    if (string->buffer!=NULL) {
-      string->buffer = gt_strndup(string->buffer,string->length);
-      string->allocated = string->length+1;
+  } else if (string->allocated==0) {
+    char* const string_src = string->buffer;
+    if (string_src!=NULL) {
+      gt_string_memory_init(string,GT_MAX(initial_buffer_size,string->length+1));
+      gt_strncpy(string->buffer,string_src,string->length);
     } else {
-      string->buffer = gt_malloc(initial_buffer_size);
+      gt_string_memory_init(string,initial_buffer_size);
       string->buffer[0] = EOS;
     }
   }
@@ -99,6 +139,7 @@ GT_INLINE void gt_string_set_nstring(gt_string* const string,char* const string_
   GT_STRING_CHECK(string);
   GT_NULL_CHECK(string_src);
   if (gt_expect_true(string->allocated>0)) {
+    gt_string_drop_view(string);
     gt_string_resize(string,length+1);
     gt_strncpy(string->buffer,string_src,length);
   } else {
@@ -114,16 +155,41 @@ GT_INLINE void gt_string_set_string_static(gt_string* const string,const char* c
 GT_INLINE void gt_string_set_nstring_static(gt_string* const string,const char* const string_src,const uint64_t length) {
   GT_STRING_CHECK_NO_STATIC(string);
   GT_NULL_CHECK(string_src);
+  gt_string_drop_view(string);
   gt_string_resize(string,length+1);
   gt_strncpy(string->buffer,string_src,length);
   string->length = length;
 }
 
-
 GT_INLINE char* gt_string_get_string(gt_string* const string) {
   GT_STRING_CHECK(string);
   return string->buffer;
 }
+
+/*
+ * Views
+ */
+GT_INLINE void gt_string_set_view(gt_string* const string,const char* const string_src,const uint64_t length) {
+  GT_STRING_CHECK(string);
+  GT_NULL_CHECK(string_src);
+  string->buffer = (char*)string_src;
+  string->length = length;
+}
+GT_INLINE bool gt_string_is_view(gt_string* const string) {
+  GT_STRING_CHECK(string);
+  return string->allocated>0 && string->buffer!=string->memory;
+}
+GT_INLINE void gt_string_unview(gt_string* const string) {
+  GT_STRING_CHECK(string);
+  if (!gt_string_is_view(string)) return;
+  char* const string_src = string->buffer;
+  if (string->allocated < string->length+1) {
+    gt_string_memory_free(string);
+    gt_string_memory_init(string,string->length+1);
+  }
+  string->buffer = string->memory;
+  gt_strncpy(string->buffer,string_src,string->length);
+}
 GT_INLINE uint64_t gt_string_get_length(gt_string* const string) {
   GT_STRING_CHECK(string);
   return string->length;
@@ -212,6 +278,11 @@ GT_INLINE void gt_string_trim_left(gt_string* const string,const uint64_t length
       return;
     }
     const uint64_t new_length = string->length-length;
+    if (gt_string_is_view(string)) { // Just narrow the view
+      string->buffer += length;
+      string->length = new_length;
+      return;
+    }
     uint64_t i;
     for (i=0;i<new_length;++i) string->buffer[i]=string->buffer[i+length];
     string->buffer[new_length] = EOS;
@@ -226,7 +297,7 @@ GT_INLINE void gt_string_trim_right(gt_string* const string,const uint64_t lengt
       return;
     }
     string->length -= length;
-    string->buffer[string->length] = EOS;
+    if (!gt_string_is_view(string)) string->buffer[string->length] = EOS;
   }
 }
 /*
@@ -234,7 +305,9 @@ GT_INLINE void gt_string_trim_right(gt_string* const string,const uint64_t lengt
  */
 GT_INLINE bool gt_string_is_null(gt_string* const string) {
   return (gt_expect_false(string==NULL) ? true :
-      ((gt_expect_true(string->allocated>0)) ? string->buffer[0]==EOS : string->buffer==NULL) );
+      ((gt_expect_true(string->allocated>0)) ?
+          ((gt_expect_true(string->buffer==string->memory)) ? string->buffer[0]==EOS : string->length==0) :
+          string->buffer==NULL) );
 }
 GT_INLINE int64_t gt_string_cmp(gt_string* const string_a,gt_string* const string_b) {
   GT_STRING_CHECK(string_a);
@@ -288,6 +361,7 @@ GT_INLINE bool gt_string_nequals(gt_string* const string_a,gt_string* const stri
  */
 GT_INLINE void gt_string_reverse(gt_string* const sequence) {
   GT_STRING_CHECK(sequence);
+  gt_string_unview(sequence);
   const uint64_t string_length = sequence->length;
   const uint64_t middle = string_length/2;
   char* const buffer = sequence->buffer;
@@ -314,6 +388,7 @@ GT_INLINE gt_string* gt_string_dup(gt_string* const sequence) {
 GT_INLINE void gt_string_copy(gt_string* const sequence_dst,gt_string* const sequence_src) {
   GT_STRING_CHECK_NO_STATIC(sequence_dst);
   GT_STRING_CHECK(sequence_src);
+  gt_string_drop_view(sequence_dst);
   gt_string_resize(sequence_dst,sequence_src->length+1);
   gt_strncpy(sequence_dst->buffer,sequence_src->buffer,sequence_src->length);
   sequence_dst->length = sequence_src->length;
@@ -322,6 +397,7 @@ GT_INLINE void gt_string_reverse_copy(gt_string* const sequence_dst,gt_string* c
   GT_STRING_CHECK_NO_STATIC(sequence_dst);
   GT_STRING_CHECK(sequence_src);
   const uint64_t string_length = sequence_src->length;
+  gt_string_drop_view(sequence_dst);
   gt_string_resize(sequence_dst,string_length+1);
   char* const buffer_src = sequence_src->buffer;
   char* const buffer_dst = sequence_dst->buffer;
@@ -337,6 +413,7 @@ GT_INLINE uint64_t gt_string_copy_substr(gt_string * const sequence_dst,gt_strin
 	GT_STRING_CHECK_NO_STATIC(sequence_dst);
 	GT_STRING_CHECK(sequence_src);
 	if(off+len>sequence_src->length) len=0;
+	gt_string_drop_view(sequence_dst);
 	gt_string_resize(sequence_dst,len+1);
 	if(!len) sequence_dst->buffer[0]=EOS;
 	else gt_strncpy(sequence_dst->buffer,sequence_src->buffer+off,len);
@@ -351,6 +428,7 @@ GT_INLINE gt_status gt_vsprintf(gt_string* const sequence,const char *template,v
   gt_status chars_printed;
   if (!gt_string_is_static(sequence)) { // Allocate memory
     const uint64_t mem_required = gt_calculate_memory_required_v(template,v_args);
+    gt_string_drop_view(sequence);
     gt_string_resize(sequence,mem_required+1);
   }
   chars_printed=vsprintf(gt_string_get_string(sequence),template,v_args);
@@ -10,7 +10,7 @@
 #include "gt_template.h"
 #include "gt_sam_attributes.h"
 
-#define GT_TEMPLATE_TAG_INITIAL_LENGTH 100
+#define GT_TEMPLATE_TAG_INITIAL_LENGTH GT_STRING_INLINE_SIZE
 #define GT_TEMPLATE_NUM_INITIAL_COUNTERS 10
 #define GT_TEMPLATE_NUM_INITIAL_BLOCKS 2
 #define GT_TEMPLATE_NUM_INITIAL_MMAPS 20
@@ -19,7 +19,11 @@
  * Setup
  */
 GT_INLINE gt_template* gt_template_new() {
-  gt_template* template = gt_alloc(gt_template);
+  // Reuse a recycled template (already clear)
+  gt_template* template = gt_pool_get_recycled(GT_MM_RECYCLED_TEMPLATE);
+  if (template!=NULL) return template;
+  // Allocate
+  template = gt_pool_alloc(gt_template);
   template->template_id = UINT32_MAX;
   template->in_block_id = UINT32_MAX;
   template->tag = gt_string_new(GT_TEMPLATE_TAG_INITIAL_LENGTH);
@@ -27,6 +31,8 @@ GT_INLINE gt_template* gt_template_new() {
   template->alignment_end2=NULL;
   template->counters = gt_vector_new(GT_TEMPLATE_NUM_INITIAL_COUNTERS,sizeof(uint64_t));
   template->mmaps = gt_vector_new(GT_TEMPLATE_NUM_INITIAL_MMAPS,sizeof(gt_mmap));
+  template->pending_maps = NULL;
+  template->lazy_maps = NULL;
   template->attributes = gt_attributes_new();
   template->alg_dictionary = NULL;
   return template;
@@ -38,21 +44,44 @@ GT_INLINE void gt_template_clear_handler(gt_template* const template) {
 }
 GT_INLINE void gt_template_clear(gt_template* const template,const bool delete_alignments) {
   GT_TEMPLATE_CHECK(template);
+  if (template->pending_maps!=NULL) gt_lazy_maps_discard(template->pending_maps);
   if (delete_alignments) gt_template_delete_blocks(template);
   gt_vector_clear(template->counters);
   gt_vector_clear(template->mmaps);
   gt_template_clear_handler(template);
 }
+GT_INLINE bool gt_template_recycle(gt_template* const template) {
+  // Strings turned static are not what gt_template_new() hands out
+  if (gt_string_is_static(template->tag)) return false;
+  gt_template_clear(template,true); // Alignments are recycled on their own
+  template->template_id = UINT32_MAX;
+  template->in_block_id = UINT32_MAX;
+  if (template->alg_dictionary!=NULL) {
+    gt_template_dictionary_delete(template->alg_dictionary);
+    template->alg_dictionary = NULL;
+  }
+  return gt_pool_put_recycled(GT_MM_RECYCLED_TEMPLATE,template);
+}
 GT_INLINE void gt_template_delete(gt_template* const template) {
   GT_TEMPLATE_CHECK(template);
+  if (gt_template_recycle(template)) return;
+  if (template->pending_maps!=NULL) gt_lazy_maps_discard(template->pending_maps);
+  if (template->lazy_maps!=NULL) gt_lazy_maps_delete(template->lazy_maps);
   gt_string_delete(template->tag);
   gt_template_delete_blocks(template);
   gt_vector_delete(template->counters);
   gt_vector_delete(template->mmaps);
   gt_attributes_delete(template->attributes);
-  gt_free(template);
+  gt_pool_free(template,gt_template);
 }
 
+/*
+ * Lazy maps
+ */
+// Decodes (at least) the first @num_mmaps mmaps of the template
+#define gt_template_decode_mmaps(template,num_mmaps) \
+  if (gt_expect_false((template)->pending_maps!=NULL)) gt_lazy_maps_decode((template)->pending_maps,num_mmaps)
+
 /*
  * Accessors
  */
@@ -282,6 +311,7 @@ GT_INLINE uint64_t gt_template_get_num_mmaps(gt_template* const template) {
   GT_TEMPLATE_IF_REDUCES_TO_ALINGMENT(template,alignment) {
     return gt_alignment_get_num_maps(alignment);
   } GT_TEMPLATE_END_REDUCTION;
+  if (gt_expect_false(template->pending_maps!=NULL)) return template->pending_maps->num_maps; // Counted by the parser
   return gt_vector_get_used(template->mmaps);
 }
 GT_INLINE void gt_template_clear_mmaps(gt_template* const template) {
@@ -289,6 +319,7 @@ GT_INLINE void gt_template_clear_mmaps(gt_template* const template) {
   GT_TEMPLATE_IF_REDUCES_TO_ALINGMENT(template,alignment) {
     gt_alignment_clear_maps(alignment);
   } GT_TEMPLATE_END_REDUCTION__RETURN;
+  GT_TEMPLATE_DECODE_MAPS(template); // Maps stay in the alignments
   gt_vector_clear(template->mmaps);
 }
 /* MMap attributes */
@@ -301,16 +332,19 @@ GT_INLINE void gt_template_mmap_attributes_clear(gt_mmap_attributes* const mmap_
 /* MMap record */
 GT_INLINE gt_mmap* gt_template_get_mmap(gt_template* const template,const uint64_t position) {
   GT_TEMPLATE_CHECK(template);
+  gt_template_decode_mmaps(template,position+1);
   return gt_vector_get_elm(template->mmaps,position,gt_mmap);
 }
 GT_INLINE void gt_template_set_mmap(gt_template* const template,const uint64_t position,gt_mmap* const mmap) {
   GT_TEMPLATE_CHECK(template);
   GT_MMAP_CHECK(mmap);
+  gt_template_decode_mmaps(template,position+1);
   gt_vector_set_elm(template->mmaps,position,gt_mmap,*mmap);
 }
 GT_INLINE void gt_template_add_mmap(gt_template* const template,gt_mmap* const mmap) {
   GT_TEMPLATE_CHECK(template);
   GT_MMAP_CHECK(mmap);
+  GT_TEMPLATE_DECODE_MAPS(template);
   gt_vector_insert(template->mmaps,*mmap,gt_mmap);
 }
 /* MMap array */
@@ -318,8 +352,10 @@ GT_INLINE gt_map** gt_template_get_mmap_array(
     gt_template* const template,const uint64_t position,gt_mmap_attributes** mmap_attributes) {
   GT_TEMPLATE_CHECK(template);
   GT_TEMPLATE_IF_REDUCES_TO_ALINGMENT(template,alignment) {
+    gt_alignment_decode_maps(alignment,position+1);
     return gt_vector_get_elm(alignment->maps,position,gt_map*);
   } GT_TEMPLATE_END_REDUCTION;
+  gt_template_decode_mmaps(template,position+1);
   // Retrieve the mmap from the mmap vector
   gt_mmap* mmap_ph = gt_vector_get_elm(template->mmaps,position,gt_mmap);
   if (mmap_attributes) *mmap_attributes = &mmap_ph->attributes;
@@ -332,6 +368,7 @@ GT_INLINE void gt_template_set_mmap_array(
   GT_TEMPLATE_IF_REDUCES_TO_ALINGMENT(template,alignment) {
     gt_alignment_set_map(alignment,mmap[0],position);
   } GT_TEMPLATE_END_REDUCTION__RETURN;
+  gt_template_decode_mmaps(template,position+1);
   gt_mmap* mmap_ph = gt_vector_get_elm(template->mmaps,position,gt_mmap);
   mmap_ph->mmap[0] = mmap[0];
   mmap_ph->mmap[1] = mmap[1];
@@ -348,6 +385,7 @@ GT_INLINE void gt_template_add_mmap_array(
   GT_TEMPLATE_IF_REDUCES_TO_ALINGMENT(template,alignment) {
     gt_alignment_add_map(alignment,mmap[0]);
   } GT_TEMPLATE_END_REDUCTION__RETURN;
+  GT_TEMPLATE_DECODE_MAPS(template);
   // Allocate new mmap element
   gt_vector_reserve_additional(template->mmaps,1);
   gt_vector_inc_used(template->mmaps);
@@ -370,6 +408,7 @@ GT_INLINE void gt_template_set_mmap_ends(
   GT_TEMPLATE_IF_REDUCES_TO_ALINGMENT(template,alignment) {
     gt_alignment_set_map(alignment,map_end1,position);
   } GT_TEMPLATE_END_REDUCTION__RETURN;
+  gt_template_decode_mmaps(template,position+1);
   gt_mmap* mmap_ph = gt_vector_get_elm(template->mmaps,position,gt_mmap);
   mmap_ph->mmap[0] = map_end1;
   mmap_ph->mmap[1] = map_end2;
@@ -387,6 +426,7 @@ GT_INLINE void gt_template_add_mmap_ends(
   GT_TEMPLATE_IF_REDUCES_TO_ALINGMENT(template,alignment) {
     gt_alignment_add_map(alignment,map_end1);
   } GT_TEMPLATE_END_REDUCTION__RETURN;
+  GT_TEMPLATE_DECODE_MAPS(template);
   // Allocate new mmap element
   gt_vector_reserve_additional(template->mmaps,1);
   gt_vector_inc_used(template->mmaps);
@@ -411,6 +451,7 @@ GT_INLINE void gt_template_get_mmap_gtvector(
     gt_vector_insert(mmap,gt_alignment_get_map(alignment,position),gt_map*);
   } GT_TEMPLATE_END_REDUCTION__RETURN;
   // Retrieve the maps from the mmap vector
+  gt_template_decode_mmaps(template,position+1);
   gt_vector_prepare(mmap,gt_map*,2); // Reset output vector
   gt_mmap* mmap_ph = gt_vector_get_elm(template->mmaps,position,gt_mmap);
   gt_vector_insert(mmap,mmap_ph->mmap[0],gt_map*);
@@ -425,6 +466,7 @@ GT_INLINE void gt_template_add_mmap_gtvector(
   GT_TEMPLATE_IF_REDUCES_TO_ALINGMENT(template,alignment) {
     gt_alignment_add_map(alignment,*gt_vector_get_elm(mmap_vector,0,gt_map*));
   } GT_TEMPLATE_END_REDUCTION__RETURN;
+  GT_TEMPLATE_DECODE_MAPS(template);
   // Allocate new mmap element
   gt_vector_reserve_additional(template->mmaps,1);
   gt_vector_inc_used(template->mmaps);
@@ -517,6 +559,7 @@ GT_INLINE void gt_template_copy(gt_template* const template_dst,gt_template* con
   gt_template_copy_blocks(template_dst,template_src,copy_maps);
   // Copy mmaps
   if (copy_maps && copy_mmaps && gt_template_get_num_blocks(template_src)>1) {
+    GT_TEMPLATE_DECODE_MAPS(template_src);
     // Copy counters
     gt_vector_copy(template_dst->counters,template_src->counters);
     // Copy mmaps & mmaps_attributes
@@ -542,6 +585,10 @@ GT_INLINE void gt_template_swap(gt_template* const template_a,gt_template* const
   GT_SWAP(template_a->alignment_end2,template_b->alignment_end2);
   GT_SWAP(template_a->counters,template_b->counters);
   GT_SWAP(template_a->mmaps,template_b->mmaps);
+  GT_SWAP(template_a->pending_maps,template_b->pending_maps);
+  GT_SWAP(template_a->lazy_maps,template_b->lazy_maps);
+  if (template_a->lazy_maps!=NULL) template_a->lazy_maps->owner = template_a;
+  if (template_b->lazy_maps!=NULL) template_b->lazy_maps->owner = template_b;
   GT_SWAP(template_a->attributes,template_b->attributes);
 }
 /*
@@ -590,6 +637,7 @@ GT_INLINE gt_status gt_template_next_mmap(
   GT_NULL_CHECK(mmap);
   GT_TEMPLATE_IF_REDUCES_TO_ALINGMENT(template_maps_iterator->template,alignment) {
     if (gt_expect_true(template_maps_iterator->next_mmap_position < gt_alignment_get_num_maps(alignment))) {
+      gt_alignment_decode_maps(alignment,template_maps_iterator->next_mmap_position+1);
       *mmap = gt_vector_get_elm(alignment->maps,template_maps_iterator->next_mmap_position,gt_map*);
       ++template_maps_iterator->next_mmap_position;
       return GT_TEMPLATE_OK;
@@ -599,6 +647,7 @@ GT_INLINE gt_status gt_template_next_mmap(
     }
   } GT_TEMPLATE_END_REDUCTION;
   gt_template* const template = template_maps_iterator->template;
+  gt_template_decode_mmaps(template,template_maps_iterator->next_mmap_position+1);
   if (gt_expect_true(template_maps_iterator->next_mmap_position<gt_vector_get_used(template->mmaps))) {
     gt_mmap* const mmap_ph = gt_vector_get_elm(template->mmaps,template_maps_iterator->next_mmap_position,gt_mmap);
     *mmap = mmap_ph->mmap;
@@ -233,6 +233,7 @@ GT_INLINE void gt_template_reduce_mmaps(gt_template* const template,const uint64
   } GT_TEMPLATE_END_REDUCTION__RETURN;
   const uint64_t num_matches = gt_template_get_num_mmaps(template);
   if (max_num_matches < num_matches) {
+    GT_TEMPLATE_DECODE_MAPS(template); // The alignments keep all their maps
     gt_vector_set_used(template->mmaps,max_num_matches);
     gt_template_recalculate_counters(template);
   }
@@ -270,7 +271,7 @@ GT_INLINE int64_t gt_template_get_insert_size(gt_map** const mmap,gt_status* gt_
     block[1]=map_it2;
     length[1]+=gt_map_get_base_length(block[1]);
   } 
-  if(gt_string_equals(block[0]->seq_name,block[1]->seq_name)) {
+  if(block[0]->seq_name_id==block[1]->seq_name_id) {
     if(block[0]->strand!=block[1]->strand) {
       if(block[0]->strand==FORWARD) {
       		x=1+block[1]->position+length[1]-(block[0]->position+length[0]-gt_map_get_base_length(block[0]));
@@ -279,7 +280,7 @@ GT_INLINE int64_t gt_template_get_insert_size(gt_map** const mmap,gt_status* gt_
       	x=1+block[0]->position+length[0]-(block[1]->position+length[1]-gt_map_get_base_length(block[1]));
     		if(start_x) *start_x=block[1]->position;
       }
-      if(ctg) *ctg=block[0]->seq_name;
+      if(ctg) *ctg=gt_map_get_string_seq_name(block[0]);
     } else {
       *gt_error=GT_TEMPLATE_INSERT_SIZE_SAME_STRAND;
     }
@@ -407,6 +408,7 @@ GT_INLINE void gt_template_sort_by_distance__score(gt_template* const template)
     return gt_alignment_sort_by_distance__score(alignment);
   } GT_TEMPLATE_END_REDUCTION;
   // Sort
+  GT_TEMPLATE_DECODE_MAPS(template);
   const uint64_t num_mmap = gt_template_get_num_mmaps(template);
   qsort(gt_vector_get_mem(template->mmaps,gt_mmap),num_mmap,sizeof(gt_mmap),
       (int (*)(const void *,const void *))gt_mmap_cmp_distance__score);
@@ -418,6 +420,7 @@ GT_INLINE void gt_template_sort_by_distance__score_no_split(gt_template* const t
     return gt_alignment_sort_by_distance__score_no_split(alignment);
   } GT_TEMPLATE_END_REDUCTION;
   // Sort
+  GT_TEMPLATE_DECODE_MAPS(template);
   const uint64_t num_mmap = gt_template_get_num_mmaps(template);
   qsort(gt_vector_get_mem(template->mmaps,gt_mmap),num_mmap,sizeof(gt_mmap),
       (int (*)(const void *,const void *))gt_mmap_cmp_distance__score);
@@ -21,10 +21,16 @@ GT_INLINE gt_vector* gt_vector_new(size_t num_initial_elements,size_t element_si
   vector->elements_allocated=num_initial_elements;
   vector->memory=gt_malloc(num_initial_elements*element_size);
   vector->used=0;
+  vector->is_view=false;
+  vector->owned_memory=NULL;
+  vector->owned_elements_allocated=0;
   return vector;
 }
 GT_INLINE gt_status gt_vector_reserve(gt_vector* vector,size_t num_elements,bool zero_mem) {
   GT_VECTOR_CHECK(vector);
+  if (gt_expect_false(vector->is_view) && vector->elements_allocated < num_elements) {
+    gt_vector_unset_view(vector,true);
+  }
   if (vector->elements_allocated < num_elements) {
     size_t proposed=(float)vector->elements_allocated*GT_VECTOR_EXPAND_FACTOR;
     vector->elements_allocated=num_elements>proposed?num_elements:proposed;
@@ -39,6 +45,7 @@ GT_INLINE gt_status gt_vector_reserve(gt_vector* vector,size_t num_elements,bool
 }
 GT_INLINE gt_status gt_vector_resize__clear(gt_vector* vector,size_t num_elements) {
   GT_VECTOR_CHECK(vector);
+  if (gt_expect_false(vector->is_view)) gt_vector_unset_view(vector,false);
   if (vector->elements_allocated < num_elements) {
     size_t proposed=(float)vector->elements_allocated*GT_VECTOR_EXPAND_FACTOR;
     vector->elements_allocated=num_elements>proposed?num_elements:proposed;
@@ -52,13 +59,14 @@ GT_INLINE gt_status gt_vector_resize__clear(gt_vector* vector,size_t num_element
 
 GT_INLINE void gt_vector_cast__clear(gt_vector* vector,size_t element_size) {
   GT_VECTOR_CHECK(vector); GT_ZERO_CHECK(element_size);
+  if (gt_expect_false(vector->is_view)) gt_vector_unset_view(vector,false);
   vector->elements_allocated=(vector->elements_allocated*vector->element_size)/element_size;
   vector->element_size=element_size;
   vector->used=0;
 }
 GT_INLINE void gt_vector_delete(gt_vector* vector) {
   GT_VECTOR_CHECK(vector);
-  gt_free(vector->memory);
+  gt_free((vector->is_view) ? vector->owned_memory : vector->memory);
   gt_free(vector);
 }
 GT_INLINE void gt_vector_copy(gt_vector* vector_to,gt_vector* vector_from) {
@@ -81,3 +89,34 @@ GT_INLINE void* gt_vector_get_mem_element(gt_vector* vector,size_t position,size
   GT_VECTOR_RANGE_CHECK(vector,position);
   return vector->memory+(position*element_size);
 }
+
+/*
+ * Views
+ */
+GT_INLINE void gt_vector_set_view(gt_vector* vector,void* const memory,const size_t num_elements) {
+  GT_VECTOR_CHECK(vector); GT_NULL_CHECK(memory);
+  if (!vector->is_view) {
+    vector->owned_memory=vector->memory;
+    vector->owned_elements_allocated=vector->elements_allocated;
+    vector->is_view=true;
+  }
+  vector->memory=memory;
+  vector->used=num_elements;
+  vector->elements_allocated=num_elements; // Any growth goes through gt_vector_reserve()
+}
+GT_INLINE void gt_vector_unset_view(gt_vector* vector,const bool keep_content) {
+  GT_VECTOR_CHECK(vector);
+  if (!vector->is_view) return;
+  void* const view_memory=vector->memory;
+  vector->memory=vector->owned_memory;
+  vector->elements_allocated=vector->owned_elements_allocated;
+  vector->owned_memory=NULL;
+  vector->owned_elements_allocated=0;
+  vector->is_view=false;
+  if (keep_content) {
+    gt_vector_reserve(vector,vector->used,false);
+    memcpy(vector->memory,view_memory,vector->used*vector->element_size);
+  } else {
+    vector->used=0;
+  }
+}
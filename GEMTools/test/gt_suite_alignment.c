@@ -23,6 +23,95 @@ START_TEST(gt_test_alignment_accessors)
 }
 END_TEST
 
+START_TEST(gt_test_alignment_attributes)
+{
+  gt_alignment* const alignment = gt_alignment_new();
+  gt_string* const casava = gt_string_set_new("1:N:0:ATCACG");
+  char custom_id[16];
+  int64_t value, i;
+  // Well-known attributes (slots)
+  value = 2;
+  gt_attributes_add(alignment->attributes,GT_ATTR_ID_TAG_PAIR,&value,int64_t);
+  gt_attributes_add_string(alignment->attributes,GT_ATTR_ID_TAG_CASAVA,casava);
+  fail_unless(*((int64_t*)gt_attributes_get(alignment->attributes,GT_ATTR_ID_TAG_PAIR))==2,"Pair not stored");
+  fail_unless(gt_string_equals(casava,gt_attributes_get(alignment->attributes,GT_ATTR_ID_TAG_CASAVA)),"Casava not stored");
+  fail_unless(!gt_attributes_is_contained(alignment->attributes,GT_ATTR_ID_TAG_EXTRA),"Unexpected extra");
+  // Custom attributes (overflow)
+  for (i=0;i<32;++i) {
+    sprintf(custom_id,"custom_%"PRIu64,i);
+    gt_attributes_add(alignment->attributes,custom_id,&i,int64_t);
+  }
+  for (i=0;i<32;i+=2) {
+    sprintf(custom_id,"custom_%"PRIu64,i);
+    gt_attributes_remove(alignment->attributes,custom_id);
+  }
+  for (i=0;i<32;++i) {
+    sprintf(custom_id,"custom_%"PRIu64,i);
+    int64_t* const custom_value = gt_attributes_get(alignment->attributes,custom_id);
+    fail_unless((i%2==0) ? custom_value==NULL : (custom_value!=NULL && *custom_value==i),"Wrong custom attribute");
+  }
+  // Copy & clear
+  gt_alignment* const alignment_cp = gt_alignment_copy(alignment,false);
+  gt_alignment_clear(alignment);
+  fail_unless(!gt_attributes_is_contained(alignment->attributes,GT_ATTR_ID_TAG_CASAVA),"Casava not cleared");
+  fail_unless(!gt_attributes_is_contained(alignment->attributes,"custom_1"),"Custom not cleared");
+  fail_unless(gt_string_equals(casava,gt_attributes_get(alignment_cp->attributes,GT_ATTR_ID_TAG_CASAVA)),"Casava not copied");
+  fail_unless(*((int64_t*)gt_attributes_get(alignment_cp->attributes,"custom_31"))==31,"Custom not copied");
+  gt_alignment_delete(alignment_cp);
+  gt_alignment_delete(alignment);
+  gt_string_delete(casava);
+}
+END_TEST
+
+START_TEST(gt_test_alignment_recycling)
+{
+  // Fill an alignment & delete it (recycled)
+  gt_alignment* alignment = gt_alignment_new();
+  gt_string* const read = gt_string_set_new("ACGTACGTAC");
+  int64_t pair = 1;
+  alignment->alignment_id = 7;
+  gt_string_copy(alignment->read,read);
+  gt_attributes_add(alignment->attributes,GT_ATTR_ID_TAG_PAIR,&pair,int64_t);
+  gt_alignment_add_map(alignment,gt_map_new());
+  gt_alignment_delete(alignment);
+  // A new alignment must come back clear
+  alignment = gt_alignment_new();
+  fail_unless(alignment->alignment_id==UINT32_MAX,"Recycled alignment keeps its ID");
+  fail_unless(gt_string_get_length(alignment->read)==0,"Recycled alignment keeps its read");
+  fail_unless(gt_alignment_get_num_maps(alignment)==0,"Recycled alignment keeps its maps");
+  fail_unless(!gt_attributes_is_contained(alignment->attributes,GT_ATTR_ID_TAG_PAIR),"Recycled alignment keeps its attributes");
+  gt_alignment_delete(alignment);
+  gt_string_delete(read);
+}
+END_TEST
+
+START_TEST(gt_test_alignment_read_views)
+{
+  char record[] = "ACGTNNACGT\tIIIIIIIIII";
+  gt_alignment* const alignment = gt_alignment_new();
+  // The read references the record
+  gt_string_set_view(alignment->read,record,10);
+  fail_unless(gt_string_is_view(alignment->read),"Read is not a view");
+  fail_unless(gt_alignment_get_read(alignment)==record,"Read view copies the record");
+  // Trimming a view doesn't touch the record
+  gt_string_trim_left(alignment->read,2);
+  gt_string_trim_right(alignment->read,2);
+  fail_unless(gt_string_get_length(alignment->read)==6 &&
+      strncmp(gt_alignment_get_read(alignment),"GTNNAC",6)==0,"Wrong trimmed read view");
+  fail_unless(record[10]=='\t',"Trimming the read view modified the record");
+  // Modifying it copies it first
+  gt_string_append_char(alignment->read,'A');
+  fail_unless(!gt_string_is_view(alignment->read),"Modified read is still a view");
+  gt_string_append_eos(alignment->read);
+  fail_unless(strcmp(gt_alignment_get_read(alignment),"GTNNACA")==0,"Wrong read after modifying the view");
+  fail_unless(strncmp(record,"ACGTNNACGT\t",11)==0,"Modifying the read view modified the record");
+  // A view of nothing is null
+  gt_string_set_view(alignment->qualities,record+11,0);
+  fail_unless(gt_string_is_null(alignment->qualities),"Empty view is not null");
+  gt_alignment_delete(alignment);
+}
+END_TEST
+
 Suite *gt_alignment_suite(void) {
   Suite *s = suite_create("gt_alignment");
 
@@ -30,6 +119,9 @@ Suite *gt_alignment_suite(void) {
   TCase *tc_core = tcase_create("Core");
   tcase_add_checked_fixture(tc_core,gt_alignment_setup,gt_alignment_teardown);
   tcase_add_test(tc_core,gt_test_alignment_accessors);
+  tcase_add_test(tc_core,gt_test_alignment_attributes);
+  tcase_add_test(tc_core,gt_test_alignment_recycling);
+  tcase_add_test(tc_core,gt_test_alignment_read_views);
   // tcase_add_test(tc_core,...);
   suite_add_tcase(s,tc_core);
 
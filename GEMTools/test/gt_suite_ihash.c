@@ -63,6 +63,39 @@ START_TEST(gt_test_ihash_neg_key)
 }
 END_TEST
 
+START_TEST(gt_test_ihash_remove_and_iterate)
+{
+  // Insert (growing the table) & remove half of the keys
+  int64_t key;
+  for (key=1000;key>0;--key) {
+    int64_t* const value = gt_alloc(int64_t);
+    *value = 2*key;
+    gt_ihash_insert(ihash,key,value,int64_t);
+  }
+  for (key=2;key<=1000;key+=2) gt_ihash_remove(ihash,key,true);
+  fail_unless(gt_ihash_get_num_elements(ihash)==500,"Wrong number of elements after removals");
+  fail_unless(!gt_ihash_is_contained(ihash,500),"Removed key still found");
+  fail_unless(*gt_ihash_get(ihash,501,int64_t)==1002,"Key lost after removals");
+  // Iterate (insertion order) & sorted
+  int64_t last_key = INT64_MAX, num_elements = 0;
+  GT_IHASH_BEGIN_ITERATE(ihash,it_key,it_value,int64_t) {
+    fail_unless(it_key%2==1 && it_key<last_key && *it_value==2*it_key,"Wrong iteration");
+    last_key = it_key;
+    ++num_elements;
+  } GT_IHASH_END_ITERATE;
+  fail_unless(num_elements==500,"Wrong number of elements iterated");
+  gt_ihash_sort_by_key(ihash);
+  gt_ihash_iterator* const ihash_iterator = gt_ihash_iterator_new(ihash);
+  last_key = INT64_MIN;
+  while (gt_ihash_iterator_next(ihash_iterator)) {
+    fail_unless(gt_ihash_iterator_get_key(ihash_iterator)>last_key,"Keys not sorted");
+    last_key = gt_ihash_iterator_get_key(ihash_iterator);
+  }
+  gt_ihash_iterator_delete(ihash_iterator);
+  fail_unless(*gt_ihash_get(ihash,999,int64_t)==1998,"Key lost after sorting");
+}
+END_TEST
+
 Suite *gt_ihash_suite(void) {
   Suite *s = suite_create("gt_ihash");
 
@@ -71,6 +104,7 @@ Suite *gt_ihash_suite(void) {
   tcase_add_checked_fixture(tc_core,gt_ihash_setup,gt_ihash_teardown);
   tcase_add_test(tc_core,gt_test_ihash_basic_insertions);
   tcase_add_test(tc_core,gt_test_ihash_neg_key);
+  tcase_add_test(tc_core,gt_test_ihash_remove_and_iterate);
   suite_add_tcase(s,tc_core);
 
   return s;
@@ -0,0 +1,249 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_suite_input_file.c
+ * DATE: 18/10/2026
+ * DESCRIPTION: Tests for the input file layer (EOL scanning, BAM/GTB/indexed/mapped input)
+ */
+
+#include "gt_test.h"
+
+uint8_t* scan_buffer;
+
+void gt_input_file_setup(void) {
+  scan_buffer = gt_malloc(256);
+  memset(scan_buffer,'A',256);
+}
+
+void gt_input_file_teardown(void) {
+  gt_free(scan_buffer);
+}
+
+START_TEST(gt_test_input_file_scan_eols)
+{
+  uint64_t num_eols_found;
+  bool dos_eol;
+  // EOLs across word boundaries
+  scan_buffer[3] = EOL; scan_buffer[40] = EOL; scan_buffer[41] = EOL; scan_buffer[200] = EOL;
+  fail_unless(gt_input_file_scan_eols(scan_buffer,256,1,&num_eols_found,&dos_eol)==4 && num_eols_found==1,"Failed scanning 1st EOL");
+  fail_unless(gt_input_file_scan_eols(scan_buffer,256,3,&num_eols_found,&dos_eol)==42 && num_eols_found==3,"Failed scanning 3rd EOL");
+  fail_unless(gt_input_file_scan_eols(scan_buffer,256,4,&num_eols_found,&dos_eol)==201 && num_eols_found==4,"Failed scanning 4th EOL");
+  fail_unless(!dos_eol,"Failed scanning EOLs (false DOS_EOL)");
+  // Not enough EOLs (whole buffer consumed)
+  fail_unless(gt_input_file_scan_eols(scan_buffer,256,10,&num_eols_found,&dos_eol)==256 && num_eols_found==4,"Failed scanning missing EOLs");
+  // Scalar remainder
+  fail_unless(gt_input_file_scan_eols(scan_buffer+41,5,2,&num_eols_found,&dos_eol)==5 && num_eols_found==1,"Failed scanning short buffer");
+  // DOS_EOL only counts before the last EOL scanned
+  scan_buffer[150] = DOS_EOL;
+  gt_input_file_scan_eols(scan_buffer,256,3,&num_eols_found,&dos_eol);
+  fail_unless(!dos_eol,"Failed scanning EOLs (DOS_EOL beyond the last line)");
+  gt_input_file_scan_eols(scan_buffer,256,4,&num_eols_found,&dos_eol);
+  fail_unless(dos_eol,"Failed scanning EOLs (DOS_EOL not detected)");
+}
+END_TEST
+
+START_TEST(gt_test_input_file_bam)
+{
+  gt_input_file* const input_file = gt_input_file_open("testdata/counts.bam",false);
+  fail_unless(gt_input_file_detect_file_format(input_file)==BAM,"Failed detecting BAM format");
+  gt_buffered_input_file* const buffered_input = gt_buffered_input_file_new(input_file);
+  gt_generic_parser_attributes* const attributes = gt_input_generic_parser_attributes_new(true);
+  gt_template* const template = gt_template_new();
+  uint64_t num_templates = 0, num_mmaps = 0;
+  while (gt_input_generic_parser_get_template(buffered_input,template,attributes)==GT_IGP_OK) {
+    ++num_templates;
+    num_mmaps += gt_template_get_num_mmaps(template);
+    fail_unless(gt_alignment_get_read_length(gt_template_get_end2(template))==50,"Failed decoding SEQ");
+    if (num_templates==5) {
+      gt_map* const map_end2 = gt_alignment_get_map(gt_template_get_end2(template),0);
+      fail_unless(gt_map_get_num_blocks(map_end2)==2,"Failed decoding split CIGAR");
+      fail_unless(gt_map_get_global_coordinate(map_end2)==1250,"Failed decoding position");
+    }
+  }
+  fail_unless(num_templates==10 && num_mmaps==13,"Failed pairing BAM records");
+  gt_template_delete(template);
+  gt_input_generic_parser_attributes_delete(attributes);
+  gt_buffered_input_file_close(buffered_input);
+  gt_input_file_close(input_file);
+}
+END_TEST
+
+START_TEST(gt_test_input_file_gtb)
+{
+  // MAP => GTB
+  gt_input_file* const map_input = gt_input_file_open("testdata/counts.map",false);
+  gt_buffered_input_file* const buffered_map_input = gt_buffered_input_file_new(map_input);
+  gt_output_map_attributes* const map_attributes = gt_output_map_attributes_new();
+  gt_output_gtb_attributes* const gtb_attributes = gt_output_gtb_attributes_new();
+  gt_template* const template = gt_template_new();
+  gt_string* const map_text = gt_string_new(1024);
+  FILE* const gtb_file = tmpfile();
+  uint64_t num_templates = 0;
+  while (gt_input_map_parser_get_template(buffered_map_input,template,NULL)==GT_IMP_OK) {
+    gt_output_map_sprint_gem_template(map_text,template,map_attributes);
+    gt_output_gtb_fprint_template(gtb_file,template,gtb_attributes);
+    ++num_templates;
+  }
+  gt_buffered_input_file_close(buffered_map_input);
+  gt_input_file_close(map_input);
+  rewind(gtb_file);
+  // GTB => MAP
+  gt_input_file* const gtb_input = gt_input_stream_open(gtb_file);
+  fail_unless(gt_input_file_detect_file_format(gtb_input)==GTB,"Failed detecting GTB format");
+  gt_buffered_input_file* const buffered_gtb_input = gt_buffered_input_file_new(gtb_input);
+  gt_string* const gtb_text = gt_string_new(1024);
+  while (gt_input_gtb_parser_get_template(buffered_gtb_input,template,NULL)==GT_IGTB_OK) {
+    gt_output_map_sprint_gem_template(gtb_text,template,map_attributes);
+    --num_templates;
+  }
+  fail_unless(num_templates==0,"Failed reading GTB templates");
+  fail_unless(gt_string_equals(map_text,gtb_text),"Failed GTB round trip");
+  gt_string_delete(gtb_text);
+  gt_string_delete(map_text);
+  gt_template_delete(template);
+  gt_output_gtb_attributes_delete(gtb_attributes);
+  gt_output_map_attributes_delete(map_attributes);
+  gt_buffered_input_file_close(buffered_gtb_input);
+  gt_input_file_close(gtb_input);
+  fclose(gtb_file);
+}
+END_TEST
+
+void gt_input_file_copy(const char* const source_file_name,const char* const file_name) {
+  FILE* const source_file = fopen(source_file_name,"r");
+  FILE* const file = fopen(file_name,"w");
+  fail_unless(source_file!=NULL && file!=NULL,"Failed copying the input file");
+  char buffer[4096];
+  size_t bytes_read;
+  while ((bytes_read=fread(buffer,1,sizeof(buffer),source_file))>0) fwrite(buffer,1,bytes_read,file);
+  fclose(source_file);
+  fclose(file);
+}
+
+START_TEST(gt_test_input_file_index)
+{
+  // Index a copy in a temporary folder (the index is saved next to its source file)
+  char* const tmp_folder = gt_calloc(strlen(gt_mm_get_tmp_folder())+24,char,true);
+  sprintf(tmp_folder,"%sgt_utest_index_XXXXXX",gt_mm_get_tmp_folder());
+  fail_unless(mkdtemp(tmp_folder)!=NULL,"Failed creating a temporary folder");
+  char* const file_name = gt_calloc(strlen(tmp_folder)+16,char,true);
+  sprintf(file_name,"%s/counts.map",tmp_folder);
+  gt_input_file_copy("testdata/counts.map",file_name);
+  gt_input_file* const input_file = gt_input_file_open(file_name,false);
+  gt_input_file_index* const index = gt_input_file_index_build(input_file,3);
+  fail_unless(index->num_records==10 && gt_vector_get_used(index->samples)==4,"Failed building the index");
+  // Save & Load
+  gt_input_file_index_save(index,file_name);
+  fail_unless(gt_input_file_load_index(input_file),"Failed loading the index");
+  char* const index_file_name = gt_input_file_index_get_file_name(file_name);
+  unlink(index_file_name);
+  gt_free(index_file_name);
+  fail_unless(input_file->index->num_records==10 &&
+      input_file->index->source_size==input_file->file_size,"Failed loading the index");
+  gt_input_file_index_delete(index);
+  // Seek by number
+  gt_template* const template = gt_template_new();
+  fail_unless(gt_input_file_seek_template(input_file,7),"Failed seeking template");
+  gt_buffered_input_file* buffered_input = gt_buffered_input_file_new(input_file);
+  fail_unless(gt_input_map_parser_get_template(buffered_input,template,NULL)==GT_IMP_OK,"Failed reading template");
+  fail_unless(gt_streq(gt_template_get_tag(template),"8"),"Failed seeking template (wrong record)");
+  gt_buffered_input_file_close(buffered_input);
+  fail_unless(!gt_input_file_seek_template(input_file,10),"Failed seeking beyond the last template");
+  // Seek by tag
+  uint64_t template_num;
+  fail_unless(gt_input_file_seek_tag(input_file,"5",1,&template_num) && template_num==4,"Failed seeking tag");
+  buffered_input = gt_buffered_input_file_new(input_file);
+  fail_unless(gt_input_map_parser_get_template(buffered_input,template,NULL)==GT_IMP_OK,"Failed reading template");
+  fail_unless(gt_streq(gt_template_get_tag(template),"5"),"Failed seeking tag (wrong record)");
+  gt_buffered_input_file_close(buffered_input);
+  fail_unless(!gt_input_file_seek_tag(input_file,"11",2,NULL),"Failed seeking a missing tag");
+  gt_template_delete(template);
+  gt_input_file_close(input_file);
+  unlink(file_name);
+  rmdir(tmp_folder);
+  gt_free(file_name);
+  gt_free(tmp_folder);
+}
+END_TEST
+
+START_TEST(gt_test_input_file_mmap)
+{
+  // Mapped files are read-only (PROT_READ), so parsing must never write into the block text
+  gt_template* const template = gt_template_new();
+  gt_dna_read* const dna_read = gt_dna_read_new();
+  uint64_t num_records;
+  // MAP
+  gt_input_file* input_file = gt_input_file_open("testdata/counts.map",true);
+  fail_unless(input_file->file_type==MAPPED_FILE,"Failed mapping MAP file");
+  gt_buffered_input_file* buffered_input = gt_buffered_input_file_new(input_file);
+  num_records = 0;
+  while (gt_input_map_parser_get_template(buffered_input,template,NULL)==GT_IMP_OK) {
+    fail_unless(gt_vector_is_view(buffered_input->block_buffer),"Failed reading MAP block (not a view)");
+    if (num_records++==0) gt_input_map_parser_next_record(buffered_input); // Skip a record
+  }
+  fail_unless(num_records==9,"Failed parsing mapped MAP file");
+  gt_buffered_input_file_close(buffered_input);
+  gt_input_file_close(input_file);
+  // SAM
+  gt_sam_parser_attributes sam_attributes = GT_SAM_PARSER_ATTR_DEFAULT;
+  input_file = gt_input_file_open("testdata/counts.sam",true);
+  fail_unless(input_file->file_type==MAPPED_FILE,"Failed mapping SAM file");
+  buffered_input = gt_buffered_input_file_new(input_file);
+  num_records = 0;
+  while (gt_input_sam_parser_get_template(buffered_input,template,&sam_attributes)==GT_ISP_OK) {
+    fail_unless(gt_vector_is_view(buffered_input->block_buffer),"Failed reading SAM block (not a view)");
+    if (num_records++==0) { // Skip the next template (both ends)
+      gt_input_sam_parser_next_record(buffered_input);
+      gt_input_sam_parser_next_record(buffered_input);
+    }
+  }
+  fail_unless(num_records==9,"Failed parsing mapped SAM file");
+  gt_buffered_input_file_close(buffered_input);
+  gt_input_file_close(input_file);
+  // FASTQ
+  input_file = gt_input_file_open("testdata/counts.fastq",true);
+  fail_unless(input_file->file_type==MAPPED_FILE,"Failed mapping FASTQ file");
+  buffered_input = gt_buffered_input_file_new(input_file);
+  num_records = 0;
+  while (gt_input_fasta_parser_get_read(buffered_input,dna_read)==GT_IFP_OK) {
+    fail_unless(gt_vector_is_view(buffered_input->block_buffer),"Failed reading FASTQ block (not a view)");
+    ++num_records;
+  }
+  fail_unless(num_records==20,"Failed parsing mapped FASTQ file");
+  gt_buffered_input_file_close(buffered_input);
+  gt_input_file_close(input_file);
+  gt_dna_read_delete(dna_read);
+  gt_template_delete(template);
+}
+END_TEST
+
+Suite *gt_input_file_suite(void) {
+  Suite *s = suite_create("gt_input_file");
+
+  /* Line scanning test case */
+  TCase *tc_scan = tcase_create("Input file. Line scanning");
+  tcase_add_checked_fixture(tc_scan,gt_input_file_setup,gt_input_file_teardown);
+  tcase_add_test(tc_scan,gt_test_input_file_scan_eols);
+  suite_add_tcase(s,tc_scan);
+
+  /* BAM input test case */
+  TCase *tc_bam = tcase_create("Input file. BAM");
+  tcase_add_test(tc_bam,gt_test_input_file_bam);
+  suite_add_tcase(s,tc_bam);
+
+  /* GTB input test case */
+  TCase *tc_gtb = tcase_create("Input file. GTB");
+  tcase_add_test(tc_gtb,gt_test_input_file_gtb);
+  suite_add_tcase(s,tc_gtb);
+
+  /* Random-access index test case */
+  TCase *tc_index = tcase_create("Input file. Index");
+  tcase_add_test(tc_index,gt_test_input_file_index);
+  suite_add_tcase(s,tc_index);
+
+  /* Memory-mapped input test case */
+  TCase *tc_mmap = tcase_create("Input file. Memory-mapped (read-only)");
+  tcase_add_test(tc_mmap,gt_test_input_file_mmap);
+  suite_add_tcase(s,tc_mmap);
+
+  return s;
+}
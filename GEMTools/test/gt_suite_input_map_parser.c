@@ -140,6 +140,101 @@ START_TEST(gt_test_imp_string_map) // TODO
 }
 END_TEST
 
+START_TEST(gt_test_imp_map_table)
+{
+  gt_map_table* const map_table = gt_map_table_new();
+  fail_unless(gt_input_map_parse_template(
+      "A/1 A/2\t"
+      "ACGTACGTAC ACGTACGTAC\t"
+      "0:2:1\t"
+      "chr1:+:100:10::chr1:-:300:2T7,"
+      "chr2:-:500:1A8::,"
+      "chr1:+:120:5T4::chr1:-:300:2T7",template)==0);
+  gt_map_table_add_template(map_table,template);
+  // Maps (each end once, in order)
+  fail_unless(gt_map_table_get_num_maps(map_table)==gt_alignment_get_num_maps(gt_template_get_end1(template))+
+      gt_alignment_get_num_maps(gt_template_get_end2(template)),"Failed loading the maps");
+  fail_unless(gt_map_table_get_num_blocks(map_table)==gt_map_table_get_num_maps(map_table),"Failed loading the blocks");
+  fail_unless(gt_map_table_get_positions(map_table)[0]==100,"Failed loading positions");
+  fail_unless(gt_map_table_get_strands(map_table)[1]==REVERSE,"Failed loading strands");
+  fail_unless(gt_map_table_get_seq_name_ids(map_table)[0]==gt_map_table_get_seq_name_ids(map_table)[2],"Failed loading seq-names");
+  fail_unless(gt_map_table_get_seq_name_ids(map_table)[0]!=gt_map_table_get_seq_name_ids(map_table)[1],"Failed loading seq-names");
+  fail_unless(gt_map_table_get_distances(map_table)[1]==1,"Failed loading distances");
+  fail_unless(gt_map_table_get_block_num_misms(map_table,2)==1 &&
+      gt_misms_get_base(gt_map_table_get_block_misms(map_table,2))=='T',"Failed loading mismatches");
+  // MMaps
+  fail_unless(gt_map_table_get_num_mmaps(map_table)==3,"Failed loading mmaps");
+  const uint64_t* const mmap_end1 = gt_map_table_get_mmap_end1(map_table);
+  const uint64_t* const mmap_end2 = gt_map_table_get_mmap_end2(map_table);
+  fail_unless(gt_map_table_get_end_positions(map_table)[mmap_end2[0]]==1,"Failed pairing mmaps");
+  fail_unless(mmap_end2[1]==GT_MAP_TABLE_NO_MAP,"Failed pairing unpaired mmaps");
+  fail_unless(gt_map_table_get_positions(map_table)[mmap_end1[2]]==120,"Failed pairing mmaps");
+  fail_unless(gt_map_table_get_positions(map_table)[mmap_end2[2]]==300,"Failed pairing mmaps");
+  // Clear
+  gt_map_table_clear(map_table);
+  fail_unless(gt_map_table_get_num_maps(map_table)==0 && gt_map_table_get_num_misms(map_table)==0,"Failed clearing");
+  gt_map_table_delete(map_table);
+}
+END_TEST
+
+START_TEST(gt_test_imp_lazy_maps)
+{
+  gt_input_file* const input_eager = gt_input_file_open("testdata/lazy_maps.map",false);
+  gt_input_file* const input_lazy = gt_input_file_open("testdata/lazy_maps.map",false);
+  gt_buffered_input_file* const buffered_eager = gt_buffered_input_file_new(input_eager);
+  gt_buffered_input_file* const buffered_lazy = gt_buffered_input_file_new(input_lazy);
+  gt_map_parser_attributes* const attr_eager = gt_input_map_parser_attributes_new(false);
+  gt_map_parser_attributes* const attr_lazy = gt_input_map_parser_attributes_new(false);
+  gt_input_map_parser_attributes_set_lazy_maps(attr_lazy,true);
+  gt_template* const template_lazy = gt_template_new();
+  gt_string* const string_eager = gt_string_new(100);
+  gt_string* const string_lazy = gt_string_new(100);
+  // PE (Counted, decoded as accessed)
+  fail_unless(gt_input_map_parser_get_template(buffered_eager,template,attr_eager)==GT_IMP_OK,"Failed parsing");
+  fail_unless(gt_input_map_parser_get_template(buffered_lazy,template_lazy,attr_lazy)==GT_IMP_OK,"Failed parsing");
+  fail_unless(gt_template_get_num_mmaps(template_lazy)==3,"Failed counting lazy mmaps");
+  fail_unless(gt_vector_get_used(template_lazy->mmaps)==0,"Failed deferring the decoding of mmaps");
+  fail_unless(gt_map_get_position(gt_template_get_mmap(template_lazy,1)->mmap[0])==500,"Failed decoding lazy mmaps");
+  fail_unless(gt_vector_get_used(template_lazy->mmaps)==2,"Failed decoding just the mmaps needed");
+  fail_unless(gt_alignment_get_num_maps(gt_template_get_end2(template_lazy))==2,"Failed decoding the maps of the ends");
+  gt_output_map_sprint_template(string_eager,template,output_attributes);
+  gt_output_map_sprint_template(string_lazy,template_lazy,output_attributes);
+  fail_unless(gt_string_equals(string_eager,string_lazy),"Failed decoding lazy mmaps");
+  // SE
+  fail_unless(gt_input_map_parser_get_template(buffered_eager,template,attr_eager)==GT_IMP_OK,"Failed parsing");
+  fail_unless(gt_input_map_parser_get_template(buffered_lazy,template_lazy,attr_lazy)==GT_IMP_OK,"Failed parsing");
+  gt_alignment* const alignment_lazy = gt_template_get_block(template_lazy,0);
+  fail_unless(gt_template_get_num_mmaps(template_lazy)==4,"Failed counting lazy maps");
+  fail_unless(gt_map_get_position(gt_alignment_get_map(alignment_lazy,0))==100,"Failed decoding lazy maps");
+  fail_unless(gt_vector_get_used(alignment_lazy->maps)==1,"Failed decoding just the maps needed");
+  gt_output_map_sprint_template(string_eager,template,output_attributes);
+  gt_output_map_sprint_template(string_lazy,template_lazy,output_attributes);
+  fail_unless(gt_string_equals(string_eager,string_lazy),"Failed decoding lazy maps");
+  // Unmapped
+  fail_unless(gt_input_map_parser_get_template(buffered_lazy,template_lazy,attr_lazy)==GT_IMP_OK,"Failed parsing");
+  fail_unless(gt_template_get_num_mmaps(template_lazy)==0,"Failed parsing unmapped");
+  // Malformed map (reported when decoded, the maps before it are kept)
+  fail_unless(gt_input_map_parser_get_template(buffered_lazy,template_lazy,attr_lazy)==GT_IMP_OK,"Failed parsing");
+  gt_alignment* const alignment_malformed = gt_template_get_block(template_lazy,0);
+  fail_unless(gt_alignment_get_num_maps(alignment_malformed)==3,"Failed counting lazy maps");
+  uint64_t num_maps = 0;
+  GT_ALIGNMENT_ITERATE(alignment_malformed,map) ++num_maps;
+  fail_unless(num_maps==2,"Failed decoding the maps before the malformed one");
+  fail_unless(alignment_malformed->lazy_maps->error_code==GT_IMP_PE_MAP_BAD_CHARACTER,"Failed reporting the malformed map");
+  fail_unless(gt_alignment_get_num_maps(alignment_malformed)==2,"Failed dropping the malformed map");
+  // Free
+  gt_string_delete(string_eager);
+  gt_string_delete(string_lazy);
+  gt_template_delete(template_lazy);
+  gt_input_map_parser_attributes_delete(attr_eager);
+  gt_input_map_parser_attributes_delete(attr_lazy);
+  gt_buffered_input_file_close(buffered_eager);
+  gt_buffered_input_file_close(buffered_lazy);
+  gt_input_file_close(input_eager);
+  gt_input_file_close(input_lazy);
+}
+END_TEST
+
 Suite *gt_input_map_parser_suite(void) {
   Suite *s = suite_create("gt_input_map_parser");
 
@@ -147,6 +242,8 @@ Suite *gt_input_map_parser_suite(void) {
   TCase *tc_map_string_parser = tcase_create("MAP parser. String parsers");
   tcase_add_checked_fixture(tc_map_string_parser,gt_input_map_parser_setup,gt_input_map_parser_teardown);
   tcase_add_test(tc_map_string_parser,gt_test_imp_string_map);
+  tcase_add_test(tc_map_string_parser,gt_test_imp_map_table);
+  tcase_add_test(tc_map_string_parser,gt_test_imp_lazy_maps);
   suite_add_tcase(s,tc_map_string_parser);
 
   return s;
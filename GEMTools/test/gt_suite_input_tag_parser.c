@@ -135,7 +135,7 @@ START_TEST(gt_test_casava_tag_parsing_extended)
 
 	fail_unless(gt_input_parse_tag((const char** const)input, tag, attributes) == GT_STATUS_OK, "Basic tag not parsed");
 	fail_unless(gt_string_cmp(tag, expected) == 0, "Tag not parsed correctly");
-	fail_unless(*gt_shash_get(attributes, GT_ATTR_ID_TAG_PAIR, int64_t) == 1, "Pair information not parsed, should be 1");
+	fail_unless(*((int64_t*)gt_attributes_get(attributes, GT_ATTR_ID_TAG_PAIR)) == 1, "Pair information not parsed, should be 1");
 	
 	gt_string_clear(tag);
 	gt_string_clear(expected_casava);
@@ -150,7 +150,7 @@ START_TEST(gt_test_casava_tag_parsing_extended)
 
 	fail_unless(gt_input_parse_tag((const char** const)input, tag, attributes) == GT_STATUS_OK, "Basic tag not parsed");
 	fail_unless(gt_string_cmp(tag, expected) == 0, "Tag not parsed correctly");
-	fail_unless(*gt_shash_get(attributes, GT_ATTR_ID_TAG_PAIR, int64_t) == 1, "Pair information not parsed, should be 1");
+	fail_unless(*((int64_t*)gt_attributes_get(attributes, GT_ATTR_ID_TAG_PAIR)) == 1, "Pair information not parsed, should be 1");
 	
 	
 	
@@ -353,6 +353,32 @@ END_TEST
 
 
 
+START_TEST(gt_test_field_index)
+{
+	// Fields of a SAM-like line
+	char line[] = "r1\t16\tchr17\t1234567890\t37\t76M\t=\t42\t0\tACGT\tIIII\tNM:i:0\n";
+	gt_field_index field_index;
+	fail_unless(gt_input_field_index_build(&field_index,line,TAB,16)==12,"Wrong number of fields");
+	fail_unless(gt_field_index_get_length(&field_index,2)==5 &&
+	    strncmp(gt_field_index_get_begin(&field_index,2),"chr17",5)==0,"Wrong field boundaries");
+	fail_unless(*gt_field_index_get_end(&field_index,11)==EOL,"Wrong last field");
+	fail_unless(gt_input_field_index_build(&field_index,line,TAB,3)==3 &&
+	    *gt_field_index_get_end(&field_index,2)==TAB,"Wrong bounded index");
+	// Sub-fields (stop at the end of the field)
+	char xa[] = "chr1,+1044,76M,0;chrX\tNM";
+	gt_field_index xa_index;
+	fail_unless(gt_input_field_index_build(&xa_index,xa,COMA,8)==4,"Wrong number of sub-fields");
+	// Numbers
+	uint64_t number;
+	fail_unless(gt_input_parse_field_number(gt_field_index_get_begin(&field_index,1),2,&number) && number==16,"Wrong number");
+	fail_unless(gt_input_parse_field_number("1234567890",10,&number) && number==1234567890ull,"Wrong long number");
+	fail_unless(gt_input_parse_field_number("00000000000000000007",20,&number) && number==7,"Wrong very long number");
+	fail_unless(!gt_input_parse_field_number("12a4",4,&number),"Non-digits accepted");
+	fail_unless(!gt_input_parse_field_number("123456789:",10,&number),"Non-digits accepted");
+	fail_unless(!gt_input_parse_field_number("",0,&number),"Empty field accepted");
+}
+END_TEST
+
 Suite *gt_input_tag_parser_suite(void) {
   Suite *s = suite_create("gt_input_parser");
 
@@ -371,6 +397,8 @@ Suite *gt_input_tag_parser_suite(void) {
   tcase_add_test(tc_tag_string_parser,gt_test_tag_parsing_generic_parser_single_paired_map_output_casava_additional_no_casava_no_extra_fastq);
   tcase_add_test(tc_tag_string_parser,gt_test_tag_parsing_generic_parser_single_paired_map_output_casava_additional_fasta);
 
+  tcase_add_test(tc_tag_string_parser,gt_test_field_index);
+
   suite_add_tcase(s,tc_tag_string_parser);
 
   return s;
@@ -0,0 +1,130 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt_suite_mm.c
+ * DATE: 18/10/2026
+ * DESCRIPTION: Tests for the memory manager (slab allocator, pools and accounting)
+ */
+
+#include "gt_test.h"
+
+#define GT_TEST_MM_NUM_ELEMENTS 10000
+
+gt_mm_slab* slab;
+
+void gt_mm_setup(void) {
+  slab = gt_mm_slab_new_(40,0);
+}
+
+void gt_mm_teardown(void) {
+  gt_mm_slab_delete(slab);
+}
+
+void* gt_test_mm_remote_free(void* const elements) {
+  uint64_t i;
+  for (i=0;i<GT_TEST_MM_NUM_ELEMENTS;++i) gt_mm_slab_free(slab,((void**)elements)[i]);
+  return NULL;
+}
+
+START_TEST(gt_test_mm_slab_malloc)
+{
+  void** const elements = gt_calloc(GT_TEST_MM_NUM_ELEMENTS,void*,false);
+  uint64_t i;
+  for (i=0;i<GT_TEST_MM_NUM_ELEMENTS;++i) {
+    elements[i] = gt_mm_slab_malloc(slab);
+    memset(elements[i],(int)i,40);
+    fail_unless(gt_mm_slab_get_slab(elements[i])==slab,"Failed getting the slab of an element");
+  }
+  for (i=0;i<GT_TEST_MM_NUM_ELEMENTS;++i) {
+    fail_unless(((uint8_t*)elements[i])[39]==(uint8_t)i,"Failed allocating disjoint elements");
+  }
+  const uint64_t num_units = slab->num_units;
+  // Free half & reallocate (reuses the units)
+  for (i=0;i<GT_TEST_MM_NUM_ELEMENTS;i+=2) gt_mm_slab_free(slab,elements[i]);
+  for (i=0;i<GT_TEST_MM_NUM_ELEMENTS;i+=2) elements[i] = gt_mm_slab_malloc(slab);
+  fail_unless(slab->num_units==num_units,"Failed reusing freed elements");
+  // Free all (only a few empty units are kept)
+  for (i=0;i<GT_TEST_MM_NUM_ELEMENTS;++i) gt_mm_slab_free(slab,elements[i]);
+  fail_unless(slab->num_units==slab->num_empty_units,"Failed freeing all elements");
+  fail_unless(slab->num_units<=GT_MM_SLAB_MAX_EMPTY_UNITS,"Failed releasing empty units");
+  gt_free(elements);
+}
+END_TEST
+
+START_TEST(gt_test_mm_slab_mmalloc)
+{
+  uint8_t* const single = gt_mm_slab_malloc(slab);
+  uint8_t* const run = gt_mm_slab_mmalloc(slab,100);
+  fail_unless(gt_mm_slab_get_unit(run)==gt_mm_slab_get_unit(run+99*slab->element_size),"Failed allocating a run in one unit");
+  fail_unless(run+100*slab->element_size<=single || single<run,"Failed allocating a run of free elements");
+  gt_mm_slab_mfree(slab,run,100);
+  gt_mm_slab_free(slab,single);
+  fail_unless(slab->num_units==slab->num_empty_units,"Failed freeing a run");
+}
+END_TEST
+
+START_TEST(gt_test_mm_slab_remote_free)
+{
+  void** const elements = gt_calloc(GT_TEST_MM_NUM_ELEMENTS,void*,false);
+  uint64_t i;
+  for (i=0;i<GT_TEST_MM_NUM_ELEMENTS;++i) elements[i] = gt_mm_slab_malloc(slab);
+  pthread_t thread;
+  pthread_create(&thread,NULL,gt_test_mm_remote_free,elements);
+  pthread_join(thread,NULL);
+  fail_unless(slab->remote_frees!=NULL,"Failed queuing remote frees");
+  gt_mm_slab_reap_empty(slab); // Processes the remote frees
+  fail_unless(slab->num_units==0,"Failed processing remote frees");
+  gt_free(elements);
+}
+END_TEST
+
+START_TEST(gt_test_mm_pool)
+{
+  gt_string* const string = gt_string_set_new("ACGT");
+  fail_unless(gt_mm_slab_get_slab(string)==gt_mm_pool_get_thread_instance()->slabs[(sizeof(gt_string)-1)/GT_MM_POOL_SIZE_CLASS],
+      "Failed allocating from the thread pool");
+  fail_unless(gt_mm_pool_get_thread_instance()==gt_mm_pool_get_thread_instance(),"Failed getting the thread pool");
+  gt_string_delete(string);
+  void* const big_chunk = gt_mm_pool_malloc(GT_MM_POOL_MAX_ELEMENT_SIZE+1);
+  gt_mm_pool_free(big_chunk,GT_MM_POOL_MAX_ELEMENT_SIZE+1);
+}
+END_TEST
+
+START_TEST(gt_test_mm_accounting)
+{
+  const uint64_t current = gt_mm_acc_get_current(GT_MM_ACC_STATS);
+  const uint64_t total = gt_mm_acc_get_total_current();
+  uint64_t accounted = 0;
+  gt_mm_acc_update(GT_MM_ACC_STATS,&accounted,1000);
+  gt_mm_acc_update(GT_MM_ACC_STATS,&accounted,300);
+  fail_unless(gt_mm_acc_get_current(GT_MM_ACC_STATS)==current+300,"Failed accounting a resize");
+  fail_unless(gt_mm_acc_get_peak(GT_MM_ACC_STATS)>=current+1000,"Failed keeping the peak");
+  fail_unless(gt_mm_acc_get_total_current()==total+300,"Failed accounting the total");
+  gt_mm_acc_update(GT_MM_ACC_STATS,&accounted,0);
+  fail_unless(gt_mm_acc_get_current(GT_MM_ACC_STATS)==current,"Failed releasing");
+  // Budget
+  fail_unless(!gt_mm_acc_is_over_budget() && gt_mm_acc_fits_budget(UINT64_MAX/2),"Failed unbounded budget");
+  gt_mm_acc_set_budget(1);
+  fail_unless(!gt_mm_acc_fits_budget(GT_BUFFER_SIZE_16M),"Failed bounded budget");
+  gt_mm_acc_set_budget(0);
+}
+END_TEST
+
+Suite *gt_mm_suite(void) {
+  Suite *s = suite_create("gt_mm");
+
+  /* Slab test case */
+  TCase *tc_slab = tcase_create("Memory manager. Slab & Pool");
+  tcase_add_checked_fixture(tc_slab,gt_mm_setup,gt_mm_teardown);
+  tcase_add_test(tc_slab,gt_test_mm_slab_malloc);
+  tcase_add_test(tc_slab,gt_test_mm_slab_mmalloc);
+  tcase_add_test(tc_slab,gt_test_mm_slab_remote_free);
+  tcase_add_test(tc_slab,gt_test_mm_pool);
+  suite_add_tcase(s,tc_slab);
+
+  /* Accounting test case */
+  TCase *tc_accounting = tcase_create("Memory manager. Accounting & Budget");
+  tcase_add_test(tc_accounting,gt_test_mm_accounting);
+  suite_add_tcase(s,tc_accounting);
+
+  return s;
+}
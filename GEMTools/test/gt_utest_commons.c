@@ -9,11 +9,13 @@
 
 // Include Suites
 #include "gt_suite_ihash.c"
+#include "gt_suite_mm.c"
 //#include "gt_suite_shash.c"
 
 int main(void) {
   SRunner *sr = srunner_create(gt_ihash_suite());
   //srunner_add_suite(sr,gt_ihash_suite());
+  srunner_add_suite(sr,gt_mm_suite());
   
   // add logging to xml
   srunner_set_xml(sr, "reports/check-test-commons.xml");
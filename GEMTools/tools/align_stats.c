@@ -44,6 +44,8 @@ static void usage(FILE *f)
 	fprintf(f,"  -F|--fastq     select fastq quality coding         %s\n",DEFAULT_QUAL_OFFSET==QUAL_FASTQ?"(default)":"");
 	fprintf(f,"  -S|--solexa    select ilumina quality coding       %s\n",DEFAULT_QUAL_OFFSET==QUAL_SOLEXA?"(default)":"");
 	fprintf(f,"  -q|--qual_off  select quality value offset         (default=%d)\n",DEFAULT_QUAL_OFFSET);
+	fputs("  -B|--max_memory <memory budget in MB> (smaller input blocks beyond it)\n",f);
+	fputs("  -v|--verbose   print memory usage\n",f);
 	fputs("  -h|help|usage                                      (print this file\n\n",f);
 }
 
@@ -337,6 +339,7 @@ static void insert_loc(as_stats *stats,uint64_t x,int64_t ins_size,uint32_t tile
 		lb->size=INIT_LB_SIZE;
 		lb->x=k;
 		lb->elem=as_malloc(lb->size*sizeof(loc_elem));
+		gt_mm_acc_add(GT_MM_ACC_STATS,lb->size*sizeof(loc_elem));
 		pthread_mutex_init(&lb->mutex,NULL);
 		pthread_rwlock_wrlock(&lh->rwlock);
 		HASH_ADD_INT(lh->lblock,x,lb);
@@ -344,8 +347,10 @@ static void insert_loc(as_stats *stats,uint64_t x,int64_t ins_size,uint32_t tile
 	}
 	pthread_mutex_lock(&lb->mutex);
 	if(lb->n_elem==lb->size) {
+		const uint64_t old_size=lb->size;
 		lb->size*=1.5;
 		lb->elem=as_realloc(lb->elem,lb->size*sizeof(loc_elem));
+		gt_mm_acc_resize(GT_MM_ACC_STATS,old_size*sizeof(loc_elem),lb->size*sizeof(loc_elem));
 	}
 	loc_elem* le=lb->elem+(lb->n_elem++);
 	pthread_mutex_unlock(&lb->mutex);
@@ -601,7 +606,7 @@ static void as_collect_stats(gt_template* template,as_stats* stats,as_param *par
 	} else {
 		/* We can still track duplicates for single end reads, although we will find too many */
 		gt_map* tmap=gt_alignment_get_map(al[0],0);
-		insert_loc(stats,tmap->position,0,idt->tile,tmap->seq_name);
+		insert_loc(stats,tmap->position,0,idt->tile,gt_map_get_string_seq_name(tmap));
 	}
 }
 
@@ -1250,6 +1255,8 @@ int main(int argc,char *argv[])
 			{"output",required_argument,0,'o'},
 			{"read_length",required_argument,0,'l'},
 			{"max_read_length",required_argument,0,'L'},
+			{"max_memory",required_argument,0,'B'},
+			{"verbose",no_argument,0,'v'},
 			{"help",no_argument,0,'h'},
 			{"usage",no_argument,0,'h'},
 			{0,0,0,0}
@@ -1272,9 +1279,10 @@ int main(int argc,char *argv[])
 			.max_read_length=MAX_READ_LENGTH,
 			.num_threads=1,
 			.qual_offset=DEFAULT_QUAL_OFFSET,
+			.verbose=false,
 	};
 
-	while(!err && (c=getopt_long(argc,argv,"d:t:r:o:q:m:M:l:L:x:P:X:FSVzjZwpi?",longopts,0))!=-1) {
+	while(!err && (c=getopt_long(argc,argv,"d:t:r:o:q:m:M:l:L:x:P:X:B:FSVzjZwpiv?",longopts,0))!=-1) {
 		switch(c) {
 		case 'd':
 			set_opt("insert_dist",&param.dist_file,optarg);
@@ -1340,6 +1348,12 @@ int main(int argc,char *argv[])
 		case 'i':
 			param.ignore_id=true;
 			break;
+		case 'B':
+			gt_mm_acc_set_budget((uint64_t)strtoul(optarg,&p,10)*1024*1024);
+			break;
+		case 'v':
+			param.verbose=true;
+			break;
 		case 't':
 #ifdef HAVE_OPENMP
 			param.num_threads=atoi(optarg);
@@ -1518,6 +1532,7 @@ int main(int argc,char *argv[])
 	pthread_join(calc_dup,NULL);
 	pthread_join(stats_merge,NULL);
 	as_print_stats(&param);
+	if(param.verbose) gt_mm_acc_print(stderr);
 	as_stats_free(stats[0]);
 	free(stats);
 	return err;
@@ -133,6 +133,7 @@ typedef struct {
   uint64_t max_insert;
   int num_threads;
   int qual_offset; // quality offset (33 for FASTQ, 64 for Illumina)
+  bool verbose;
   as_stats **stats;
 } as_param;
 
@@ -29,11 +29,18 @@ typedef struct {
   /* I/O */
   char* name_input_file;
   char* name_output_file;
+  gt_output_file_compression output_compression;
   char* name_reference_file;
   char* name_gem_index_file;
   char* annotation;
   gt_gtf* gtf;
   bool mmap_input;
+  bool direct_input;
+  bool shard_input;
+  gt_bmi_block_sizing_mode block_sizing;
+  uint64_t readahead_buffers;
+  uint64_t input_range_size;
+  uint64_t index_sampling_rate; // Index the output (0 if disabled)
   bool paired_end;
   bool no_output;
   gt_file_format output_format;
@@ -140,11 +147,18 @@ gt_filter_args parameters = {
     /* I/O */
     .name_input_file=NULL,
     .name_output_file=NULL,
+    .output_compression=NONE,
     .name_reference_file=NULL,
     .name_gem_index_file=NULL,
     .annotation = NULL,
     .gtf = NULL,
     .mmap_input=false,
+    .direct_input=false,
+    .shard_input=false,
+    .block_sizing=GT_BMI_BLOCK_FIXED,
+    .readahead_buffers=0,
+    .input_range_size=0,
+    .index_sampling_rate=0,
     .paired_end=false,
     .no_output=false,
     .output_format=FILE_FORMAT_UNKNOWN,
@@ -546,7 +560,7 @@ void gt_alignment_dna_filter(gt_alignment* const alignment_dst,gt_alignment* con
   GT_ALIGNMENT_ITERATE(alignment_src,map) {
     // Check sequence name
     if (parameters.map_ids!=NULL) {
-      if (!gt_filter_is_sequence_name_allowed(map->seq_name)) continue;
+      if (!gt_filter_is_sequence_name_allowed(gt_map_get_string_seq_name(map))) continue;
     }
     // Filter strata beyond first mapping
     const int64_t current_stratum = parameters.no_penalty_for_splitmaps ? gt_map_get_no_split_distance(map) : gt_map_get_global_distance(map);
@@ -579,7 +593,7 @@ void gt_alignment_dna_filter(gt_alignment* const alignment_dst,gt_alignment* con
     }
     // Filter quality scores
     if (parameters.quality_score_ranges!=NULL) {
-      if (!gt_filter_is_quality_value_allowed((file_format==SAM) ? map->phred_score : map->gt_score)) continue;
+      if (!gt_filter_is_quality_value_allowed((file_format==SAM || file_format==BAM) ? map->phred_score : map->gt_score)) continue;
     }
     /*
      * (3) Reduction of all maps
@@ -680,8 +694,8 @@ void gt_template_dna_filter(gt_template* const template_dst,gt_template* const t
             (current_stratum-first_matching_distance) > gt_template_get_read_proportion(template_src,parameters.max_strata_after_map)) break;
         // Check sequence name
         if (parameters.map_ids!=NULL) {
-          if (!gt_filter_is_sequence_name_allowed(mmap[0]->seq_name)) continue;
-          if (!gt_filter_is_sequence_name_allowed(mmap[1]->seq_name)) continue;
+          if (!gt_filter_is_sequence_name_allowed(gt_map_get_string_seq_name(mmap[0]))) continue;
+          if (!gt_filter_is_sequence_name_allowed(gt_map_get_string_seq_name(mmap[1]))) continue;
         }
         // Check strata
         if (parameters.min_event_distance != GT_FILTER_FLOAT_NO_VALUE || parameters.max_event_distance != GT_FILTER_FLOAT_NO_VALUE) {
@@ -724,7 +738,7 @@ void gt_template_dna_filter(gt_template* const template_dst,gt_template* const t
         }
         // Filter quality scores
         if (parameters.quality_score_ranges!=NULL) {
-          if (!gt_filter_is_quality_value_allowed((file_format==SAM) ? mmap_attributes->phred_score : mmap_attributes->gt_score)) continue;
+          if (!gt_filter_is_quality_value_allowed((file_format==SAM || file_format==BAM) ? mmap_attributes->phred_score : mmap_attributes->gt_score)) continue;
         }
         /*
          * (3) Reduction of all maps
@@ -759,7 +773,7 @@ void gt_alignment_rna_filter(gt_alignment* const alignment_dst,gt_alignment* con
   GT_ALIGNMENT_ITERATE(alignment_src,map) {
     // Check sequence name
     if (parameters.map_ids!=NULL) {
-      if (!gt_filter_is_sequence_name_allowed(map->seq_name)) continue;
+      if (!gt_filter_is_sequence_name_allowed(gt_map_get_string_seq_name(map))) continue;
     }
     // Check SM contained
     const uint64_t num_blocks = gt_map_get_num_blocks(map);
@@ -1132,12 +1146,32 @@ GT_INLINE void gt_filter_sample_read_print_fasta(
   gt_bofprintf(buffered_output,"\n"PRIgts"\n",
       PRIgts_trimmed_content(read,left_trim,right_trim));
 }
+GT_INLINE gt_input_file* gt_filter_open_input_file() {
+  gt_input_file* const input_file = (parameters.name_input_file==NULL) ? gt_input_stream_open(stdin) :
+      (parameters.direct_input) ? gt_input_file_open_direct(parameters.name_input_file) :
+          gt_input_file_open(parameters.name_input_file,parameters.mmap_input);
+  if (parameters.readahead_buffers > 0) gt_input_file_enable_readahead(input_file,parameters.readahead_buffers);
+  if (parameters.input_range_size > 0) gt_input_file_enable_ranges(input_file,parameters.input_range_size);
+  return input_file;
+}
+GT_INLINE void gt_filter_index_output_file(gt_output_file* const output_file) {
+  // Lines per record of the output (the index delimits records counting lines)
+  uint64_t lines_per_record = 0;
+  switch (parameters.output_format) {
+    case MAP: lines_per_record = GT_INPUT_FILE_INDEX_LINES_MAP; break;
+    case FASTA: lines_per_record = GT_INPUT_FILE_INDEX_LINES_FASTQ; break; // Always printed as FASTQ
+    default:
+      gt_fatal_error_msg("Output cannot be indexed (only 'MAP' and 'FASTA' outputs)");
+      break;
+  }
+  gt_output_file_enable_index(output_file,lines_per_record,parameters.index_sampling_rate);
+}
 GT_INLINE void gt_filter_group_reads() {
   // Open file IN/OUT
-  gt_input_file* input_file = (parameters.name_input_file==NULL) ?
-      gt_input_stream_open(stdin) : gt_input_file_open(parameters.name_input_file,parameters.mmap_input);
+  gt_input_file* input_file = gt_filter_open_input_file();
   gt_output_file* output_file = (parameters.name_output_file==NULL) ?
-            gt_output_stream_new(stdout,SORTED_FILE) : gt_output_file_new(parameters.name_output_file,SORTED_FILE);
+            gt_output_stream_new_compress(stdout,SORTED_FILE,parameters.output_compression) :
+            gt_output_file_new_compress(parameters.name_output_file,SORTED_FILE,parameters.output_compression);
   // Prepare out-printers
   if (parameters.output_format==FILE_FORMAT_UNKNOWN) parameters.output_format = input_file->file_format; // Select output format
   gt_generic_printer_attributes* const generic_printer_attributes = gt_generic_printer_attributes_new(parameters.output_format);
@@ -1200,10 +1234,10 @@ GT_INLINE void gt_filter_group_reads() {
 }
 GT_INLINE void gt_filter_sample_read() {
   // Open file IN/OUT
-  gt_input_file* input_file = (parameters.name_input_file==NULL) ?
-      gt_input_stream_open(stdin) : gt_input_file_open(parameters.name_input_file,parameters.mmap_input);
+  gt_input_file* input_file = gt_filter_open_input_file();
   gt_output_file* output_file = (parameters.name_output_file==NULL) ?
-            gt_output_stream_new(stdout,SORTED_FILE) : gt_output_file_new(parameters.name_output_file,SORTED_FILE);
+            gt_output_stream_new_compress(stdout,SORTED_FILE,parameters.output_compression) :
+            gt_output_file_new_compress(parameters.name_output_file,SORTED_FILE,parameters.output_compression);
   // Parallel I/O
 #ifdef HAVE_OPENMP
   #pragma omp parallel num_threads(parameters.num_threads)
@@ -1272,10 +1306,10 @@ GT_INLINE void gt_filter_sample_read() {
 }
 GT_INLINE void gt_filter_print_insert_size_distribution() {
   // Open file IN/OUT
-  gt_input_file* input_file = (parameters.name_input_file==NULL) ?
-      gt_input_stream_open(stdin) : gt_input_file_open(parameters.name_input_file,parameters.mmap_input);
+  gt_input_file* input_file = gt_filter_open_input_file();
   gt_output_file* output_file = (parameters.name_output_file==NULL) ?
-            gt_output_stream_new(stdout,SORTED_FILE) : gt_output_file_new(parameters.name_output_file,SORTED_FILE);
+            gt_output_stream_new_compress(stdout,SORTED_FILE,parameters.output_compression) :
+            gt_output_file_new_compress(parameters.name_output_file,SORTED_FILE,parameters.output_compression);
   // Parallel I/O
 #ifdef HAVE_OPENMP
   #pragma omp parallel num_threads(parameters.num_threads)
@@ -1297,10 +1331,10 @@ GT_INLINE void gt_filter_print_insert_size_distribution() {
 }
 GT_INLINE void gt_filter_print_error_distribution() {
   // Open file IN/OUT
-  gt_input_file* input_file = (parameters.name_input_file==NULL) ?
-      gt_input_stream_open(stdin) : gt_input_file_open(parameters.name_input_file,parameters.mmap_input);
+  gt_input_file* input_file = gt_filter_open_input_file();
   gt_output_file* output_file = (parameters.name_output_file==NULL) ?
-            gt_output_stream_new(stdout,SORTED_FILE) : gt_output_file_new(parameters.name_output_file,SORTED_FILE);
+            gt_output_stream_new_compress(stdout,SORTED_FILE,parameters.output_compression) :
+            gt_output_file_new_compress(parameters.name_output_file,SORTED_FILE,parameters.output_compression);
   // Parallel I/O
 #ifdef HAVE_OPENMP
   #pragma omp parallel num_threads(parameters.num_threads)
@@ -1367,15 +1401,26 @@ GT_INLINE void gt_filter_display_sequence_list(){
     continue; \
   }
 void gt_filter_read__write() {
-  // Open file IN/OUT
-  gt_input_file* input_file = (parameters.name_input_file==NULL) ?
-      gt_input_stream_open(stdin) : gt_input_file_open(parameters.name_input_file,parameters.mmap_input);
+  // Open file IN/OUT (a list/pattern of files is read as a single input)
+  gt_input_file_set* input_file_set = NULL;
+  gt_input_file* input_file;
+  if (parameters.name_input_file!=NULL && gt_input_file_set_is_pattern(parameters.name_input_file)) {
+    input_file_set = gt_input_file_set_open_glob(parameters.name_input_file,parameters.mmap_input,parameters.shard_input);
+    input_file = gt_input_file_set_get_file(input_file_set);
+  } else {
+    input_file = gt_filter_open_input_file();
+  }
   gt_output_file* output_file, *dicarded_output_file;
 
   // Open out file
   if (!parameters.no_output) {
     output_file = (parameters.name_output_file==NULL) ?
-          gt_output_stream_new(stdout,SORTED_FILE) : gt_output_file_new(parameters.name_output_file,SORTED_FILE);
+          gt_output_stream_new_compress(stdout,SORTED_FILE,parameters.output_compression) :
+            gt_output_file_new_compress(parameters.name_output_file,SORTED_FILE,parameters.output_compression);
+    if (parameters.index_sampling_rate > 0) {
+      if (parameters.output_format==FILE_FORMAT_UNKNOWN) parameters.output_format = input_file->file_format; // Select output format
+      gt_filter_index_output_file(output_file);
+    }
     if (parameters.discarded_output) {
       if (gt_streq(parameters.name_discarded_output_file,"stdout")) {
         dicarded_output_file = gt_output_stream_new(stdout,SORTED_FILE);
@@ -1406,7 +1451,9 @@ void gt_filter_read__write() {
   {
     // Prepare IN/OUT buffers & printers
     gt_status error_code;
-    gt_buffered_input_file* buffered_input = gt_buffered_input_file_new(input_file);
+    gt_buffered_input_file* buffered_input = (input_file_set!=NULL) ?
+        gt_buffered_input_file_new_from_set(input_file_set) : gt_buffered_input_file_new(input_file);
+    gt_buffered_input_file_set_block_sizing(buffered_input,parameters.block_sizing);
     gt_buffered_output_file *buffered_output = NULL, *buffered_discarded_output = NULL;
     if (!parameters.no_output) {
       buffered_output = gt_buffered_output_file_new(output_file);
@@ -1430,6 +1477,7 @@ void gt_filter_read__write() {
      */
     uint64_t record_num = 0;
     gt_template* template = gt_template_new();
+    gt_map_arena* const map_arena = gt_map_arena_new();
     if (parameters.check_format && parameters.check_file_format==FASTA) {
       /*
        * FASTA I/O loop
@@ -1446,6 +1494,7 @@ void gt_filter_read__write() {
        * MAP I/O loop
        */
       gt_map_parser_attributes* const attr = gt_input_map_parser_attributes_new(parameters.paired_end);
+      gt_input_map_parser_attributes_set_map_arena(attr,map_arena);
       while ((error_code=gt_input_map_parser_get_template(buffered_input,template,attr))) {
         GT_FILTER_CHECK_PARSING_ERROR("MAP ");
         // Apply all filters and print
@@ -1473,6 +1522,10 @@ void gt_filter_read__write() {
        */
       gt_generic_parser_attributes* generic_parser_attributes = gt_input_generic_parser_attributes_new(parameters.paired_end);
       gt_input_map_parser_attributes_set_max_parsed_maps(generic_parser_attributes->map_parser_attributes,parameters.max_input_matches); // Limit max-matches
+      gt_input_map_parser_attributes_set_map_arena(generic_parser_attributes->map_parser_attributes,map_arena);
+      // Reductions to the first/unique maps don't need to decode all of them
+      const bool lazy_maps = parameters.first_map || parameters.reduce_to_unique_strata>=0 || parameters.reduce_to_unique!=UINT64_MAX;
+      gt_input_map_parser_attributes_set_lazy_maps(generic_parser_attributes->map_parser_attributes,lazy_maps);
       while ((error_code=gt_input_generic_parser_get_template(buffered_input,template,generic_parser_attributes))) {
         GT_FILTER_CHECK_PARSING_ERROR("");
         // Apply all filters and print
@@ -1484,6 +1537,7 @@ void gt_filter_read__write() {
     }
     // Clean
     gt_template_delete(template);
+    gt_map_arena_delete(map_arena);
     gt_buffered_input_file_close(buffered_input);
     gt_generic_printer_attributes_delete(generic_printer_attributes);
     if (!parameters.no_output) {
@@ -1503,7 +1557,11 @@ void gt_filter_read__write() {
   if (sequence_archive) gt_sequence_archive_delete(sequence_archive);
   gt_filter_delete_map_ids(parameters.map_ids);
   if (parameters.quality_score_ranges!=NULL) gt_vector_delete(parameters.quality_score_ranges);
-  gt_input_file_close(input_file);
+  if (input_file_set!=NULL) {
+    gt_input_file_set_close(input_file_set);
+  } else {
+    gt_input_file_close(input_file);
+  }
   if (!parameters.no_output) {
     gt_output_file_close(output_file);
     if (parameters.discarded_output)  gt_output_file_close(dicarded_output_file);
@@ -1556,6 +1614,8 @@ void gt_filter_get_discarded_output_arguments(char* const optarg) {
       parameters.discarded_output_format = MAP;
     } else if (gt_streq(opt,"SAM")) {
       parameters.discarded_output_format = SAM;
+    } else if (gt_streq(opt,"GTB")) {
+      parameters.discarded_output_format = GTB;
     } else {
       gt_fatal_error_msg("Output format '%s' not recognized",opt);
     }
@@ -1639,6 +1699,36 @@ void parse_arguments(int argc,char** argv) {
     case 201:
       parameters.mmap_input = true;
       break;
+    case 206: // readahead
+      parameters.readahead_buffers = (optarg) ? atoll(optarg) : GT_INPUT_FILE_READAHEAD_MAX_BUFFERS;
+      break;
+    case 207: // input-ranges
+      parameters.input_range_size = (optarg) ? atoll(optarg)*1024*1024 : GT_INPUT_FILE_RANGE_SIZE;
+      break;
+    case 208: // direct-input
+      parameters.direct_input = true;
+      break;
+    case 209: // shard-input
+      parameters.shard_input = true;
+      break;
+    case 210: // block-sizing
+      if (gt_streq(optarg,"fixed")) {
+        parameters.block_sizing = GT_BMI_BLOCK_FIXED;
+      } else if (gt_streq(optarg,"throughput")) {
+        parameters.block_sizing = GT_BMI_BLOCK_THROUGHPUT;
+      } else if (gt_streq(optarg,"latency")) {
+        parameters.block_sizing = GT_BMI_BLOCK_LATENCY;
+      } else {
+        gt_fatal_error_msg("Block sizing '%s' not recognized ['fixed'|'throughput'|'latency']",optarg);
+      }
+      break;
+    case 211: // gzip-output
+      parameters.output_compression = GZIP;
+      break;
+    case 212: // index-output
+      parameters.index_sampling_rate = (optarg) ? atoll(optarg) : GT_INPUT_FILE_INDEX_SAMPLING_RATE;
+      gt_cond_fatal_error(parameters.index_sampling_rate==0,FILE_INDEX_SAMPLING_RATE);
+      break;
     case 'p':
       parameters.paired_end = true;
       break;
@@ -1649,6 +1739,8 @@ void parse_arguments(int argc,char** argv) {
         parameters.output_format = MAP;
       } else if (gt_streq(optarg,"SAM")) {
         parameters.output_format = SAM;
+      } else if (gt_streq(optarg,"GTB")) {
+        parameters.output_format = GTB;
       } else {
         gt_fatal_error_msg("Output format '%s' not recognized",optarg);
       }
@@ -1927,6 +2019,9 @@ void parse_arguments(int argc,char** argv) {
     case 'v': // verbose
       parameters.verbose = true;
       break;
+    case 1100: // max-memory
+      gt_mm_acc_set_budget(atoll(optarg)*1024*1024);
+      break;
     case 'h': // help
       fprintf(stderr, "USE: ./gt.filter [ARGS]...\n");
       gt_options_fprint_menu(stderr,gt_filter_options,gt_filter_groups,false,false);
@@ -1983,6 +2078,7 @@ int main(int argc,char** argv) {
   } else {
     gt_filter_read__write(); // Filter !!
   }
+  if (parameters.verbose) gt_mm_acc_print(stderr);
 
   return 0;
 }
@@ -502,6 +502,9 @@ void parse_arguments(int argc,char** argv) {
     case 'c':
       parameters.coverage_profiles = true;
       break;
+    case 501:
+      gt_mm_acc_set_budget(atoll(optarg)*1024*1024);
+      break;
     case 'v':
       parameters.verbose = true;
       break;
@@ -918,6 +921,10 @@ int main(int argc,char** argv) {
     fclose(output);
   }
 
+  if(parameters.verbose){
+    gt_mm_acc_print(stderr);
+  }
+
   gt_gtfcount_count_stats_delete(counting_stats);
   gt_shash_delete(gene_counts, true);
   gt_shash_delete(type_counts, true);
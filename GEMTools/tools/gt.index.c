@@ -0,0 +1,162 @@
+/*
+ * PROJECT: GEM-Tools library
+ * FILE: gt.index.c
+ * DATE: 18/10/2026
+ * AUTHOR(S): agent <agent@local>
+ * DESCRIPTION: Builds the random-access index of a MAP/FASTA/FASTQ file (<file>.gti)
+ *   and retrieves records through it (by number or by tag)
+ */
+
+#include <getopt.h>
+
+#include "gem_tools.h"
+
+typedef struct {
+  /* I/O */
+  char* name_input_file;
+  char* name_output_file;
+  /* Index */
+  uint64_t sampling_rate;
+  bool retrieve_template;
+  uint64_t template_num;
+  char* tag;
+  /* Misc */
+  bool verbose;
+} gt_index_args;
+
+gt_index_args parameters = {
+  /* I/O */
+  .name_input_file=NULL,
+  .name_output_file=NULL,
+  /* Index */
+  .sampling_rate=GT_INPUT_FILE_INDEX_SAMPLING_RATE,
+  .retrieve_template=false,
+  .template_num=0,
+  .tag=NULL,
+  /* Misc */
+  .verbose=false,
+};
+
+void gt_index_build() {
+  gt_input_file* const input_file = gt_input_file_open(parameters.name_input_file,false);
+  gt_input_file_index* const index = gt_input_file_index_build(input_file,parameters.sampling_rate);
+  gt_input_file_index_save(index,parameters.name_input_file);
+  if (parameters.verbose) {
+    fprintf(stderr,"[GT.Index] Indexed %"PRIu64" records (%"PRIu64" samples) into '%s"GT_INPUT_FILE_INDEX_EXTENSION"'\n",
+        index->num_records,gt_vector_get_used(index->samples),parameters.name_input_file);
+  }
+  // Free
+  gt_input_file_index_delete(index);
+  gt_input_file_close(input_file);
+}
+void gt_index_retrieve() {
+  gt_input_file* const input_file = gt_input_file_open(parameters.name_input_file,false);
+  gt_cond_fatal_error(!gt_input_file_load_index(input_file),FILE_INDEX_NOT_LOADED,parameters.name_input_file);
+  // Seek
+  bool found;
+  if (parameters.tag!=NULL) {
+    found = gt_input_file_seek_tag(input_file,parameters.tag,strlen(parameters.tag),&parameters.template_num);
+  } else {
+    found = gt_input_file_seek_template(input_file,parameters.template_num);
+  }
+  if (!found) {
+    if (parameters.tag!=NULL) {
+      gt_error_msg("Record with tag '%s' not found",parameters.tag);
+    } else {
+      gt_error_msg("Record %"PRIu64" not found (%"PRIu64" records indexed)",
+          parameters.template_num,input_file->index->num_records);
+    }
+    gt_input_file_close(input_file);
+    exit(1);
+  }
+  if (parameters.verbose) {
+    fprintf(stderr,"[GT.Index] Record %"PRIu64" (line %"PRIu64")\n",
+        parameters.template_num,input_file->processed_lines+1);
+  }
+  // Print the record
+  gt_output_file* const output_file = (parameters.name_output_file==NULL) ?
+      gt_output_stream_new(stdout,UNSORTED_FILE) : gt_output_file_new(parameters.name_output_file,UNSORTED_FILE);
+  gt_vector* const record = gt_vector_new(GT_BUFFER_SIZE_1K,sizeof(char));
+  gt_input_file_get_lines(input_file,record,input_file->index->lines_per_record);
+  gt_ofwrite(output_file,gt_vector_get_mem(record,char),gt_vector_get_used(record));
+  // Free
+  gt_vector_delete(record);
+  gt_output_file_close(output_file);
+  gt_input_file_close(input_file);
+}
+
+void usage(const bool print_inactive) {
+  fprintf(stderr, "USE: ./gt.index [ARGS]...\n");
+  gt_options_fprint_menu(stderr,gt_index_options,gt_index_groups,false,print_inactive);
+}
+
+void parse_arguments(int argc,char** argv) {
+  struct option* gt_index_getopt = gt_options_adaptor_getopt(gt_index_options);
+  gt_string* const gt_index_short_getopt = gt_options_adaptor_getopt_short(gt_index_options);
+  int option, option_index;
+  while (true) {
+    // Get option & Select case
+    if ((option=getopt_long(argc,argv,
+        gt_string_get_string(gt_index_short_getopt),gt_index_getopt,&option_index))==-1) break;
+    switch (option) {
+    /* I/O */
+    case 'i':
+      parameters.name_input_file = optarg;
+      break;
+    case 'o':
+      parameters.name_output_file = optarg;
+      break;
+    /* Index */
+    case 's':
+      parameters.sampling_rate = atoll(optarg);
+      gt_cond_fatal_error(parameters.sampling_rate==0,FILE_INDEX_SAMPLING_RATE);
+      break;
+    case 200: // template
+      parameters.retrieve_template = true;
+      parameters.template_num = atoll(optarg);
+      break;
+    case 201: // tag
+      parameters.tag = optarg;
+      break;
+    /* Misc */
+    case 'v':
+      parameters.verbose = true;
+      break;
+    case 'h':
+      usage(false);
+      exit(1);
+    case 'H':
+      usage(true);
+      exit(1);
+    case '?':
+    default:
+      gt_fatal_error_msg("Option not recognized");
+    }
+  }
+  // Check parameters
+  if (parameters.name_input_file==NULL) {
+    gt_fatal_error_msg("Input file required (the index is stored next to it)");
+  }
+  if (parameters.retrieve_template && parameters.tag!=NULL) {
+    gt_fatal_error_msg("Options '--template' and '--tag' are mutually exclusive");
+  }
+  // Free
+  gt_string_delete(gt_index_short_getopt);
+}
+
+int main(int argc,char** argv) {
+  // GT error handler
+  gt_handle_error_signals();
+
+  // Parsing command-line options
+  parse_arguments(argc,argv);
+
+  // Build the index or retrieve through it
+  if (parameters.retrieve_template || parameters.tag!=NULL) {
+    gt_index_retrieve();
+  } else {
+    gt_index_build();
+  }
+
+  return 0;
+}
@@ -12,6 +12,7 @@
 #endif
 
 #include "gem_tools.h"
+#include "uthash.h"
 
 typedef struct {
   /* I/O */
@@ -114,14 +115,14 @@ void gt_map2sam_calc_phred(gt_template *template)
 			// Build up list of single end alignments (need this so we can scale the MAPQ score)
 			// Use hash to avoid counting a single end alignment twice if it occurs in two paired alignments
 			for(rd=0;rd<2;rd++) if(maps[rd]) {
-				size_t ssize=gt_string_get_length(maps[rd]->seq_name);
+				size_t ssize=gt_map_get_seq_name_length(maps[rd]);
 				size_t key_size=ssize+sizeof(maps[rd]->position);
 				if(key_size>buf_len) {
 					buf_len=key_size*2;
 					buf=realloc(buf,buf_len);
 					gt_cond_fatal_error(!buf,MEM_HANDLER);
 				}
-				memcpy(buf,gt_string_get_string(maps[rd]->seq_name),ssize);
+				memcpy(buf,gt_map_get_seq_name(maps[rd]),ssize);
 				memcpy(buf+ssize,&maps[rd]->position,sizeof(maps[rd]->position));
 				HASH_FIND(hh,mhash[rd],buf,key_size,mp_hash);
 				if(!mp_hash) {
@@ -137,16 +138,16 @@ void gt_map2sam_calc_phred(gt_template *template)
 			}
 			if(maps[0] && maps[1]) { // True paired alignments.  Shouldn't need to check for duplicates, but we will anyway
 				// seq_name should be the same for the two ends in a paired alignment, but we're not taking any chances
-				size_t ssize1=gt_string_get_length(maps[0]->seq_name);
-				size_t ssize2=gt_string_get_length(maps[1]->seq_name);
+				size_t ssize1=gt_map_get_seq_name_length(maps[0]);
+				size_t ssize2=gt_map_get_seq_name_length(maps[1]);
 				size_t key_size=ssize1+ssize2+2*sizeof(maps[0]->position);
 				if(key_size>buf_len) {
 					buf_len=key_size*2;
 					buf=realloc(buf,buf_len);
 					gt_cond_fatal_error(!buf,MEM_HANDLER);
 				}
-				memcpy(buf,gt_string_get_string(maps[0]->seq_name),ssize1);
-				memcpy(buf+ssize1,gt_string_get_string(maps[1]->seq_name),ssize2);
+				memcpy(buf,gt_map_get_seq_name(maps[0]),ssize1);
+				memcpy(buf+ssize1,gt_map_get_seq_name(maps[1]),ssize2);
 				memcpy(buf+ssize1+ssize2,&maps[0]->position,sizeof(maps[0]->position));
 				memcpy(buf+ssize1+ssize2+sizeof(maps[0]->position),&maps[1]->position,sizeof(maps[0]->position));
 				HASH_FIND(hh,mhash[2],buf,key_size,mp_hash);
@@ -185,9 +186,9 @@ void gt_map2sam_calc_phred(gt_template *template)
 	{
 		GT_TEMPLATE_ITERATE_MMAP__ATTR_(template,maps,maps_attr) {
 			for(rd=0;rd<2;rd++) if(maps[rd]) {
-				size_t ssize=gt_string_get_length(maps[rd]->seq_name);
+				size_t ssize=gt_map_get_seq_name_length(maps[rd]);
 				size_t key_size=ssize+sizeof(maps[rd]->position);
-				memcpy(buf,gt_string_get_string(maps[rd]->seq_name),ssize);
+				memcpy(buf,gt_map_get_seq_name(maps[rd]),ssize);
 				memcpy(buf+ssize,&maps[rd]->position,sizeof(maps[rd]->position));
 				HASH_FIND(hh,mhash[rd],buf,key_size,mp_hash);
 				assert(mp_hash);
@@ -195,11 +196,11 @@ void gt_map2sam_calc_phred(gt_template *template)
 			}
 			if(maps[0] && maps[1]) { // True paired alignments.  Shouldn't need to check for duplicates, but we will anyway
 				// seq_name should be the same for the two ends in a paired alignment, but we're not taking any chances
-				size_t ssize1=gt_string_get_length(maps[0]->seq_name);
-				size_t ssize2=gt_string_get_length(maps[1]->seq_name);
+				size_t ssize1=gt_map_get_seq_name_length(maps[0]);
+				size_t ssize2=gt_map_get_seq_name_length(maps[1]);
 				size_t key_size=ssize1+ssize2+2*sizeof(maps[0]->position);
-				memcpy(buf,gt_string_get_string(maps[0]->seq_name),ssize1);
-				memcpy(buf+ssize1,gt_string_get_string(maps[1]->seq_name),ssize2);
+				memcpy(buf,gt_map_get_seq_name(maps[0]),ssize1);
+				memcpy(buf+ssize1,gt_map_get_seq_name(maps[1]),ssize2);
 				memcpy(buf+ssize1+ssize2,&maps[0]->position,sizeof(maps[0]->position));
 				memcpy(buf+ssize1+ssize2+sizeof(maps[0]->position),&maps[1]->position,sizeof(maps[0]->position));
 				HASH_FIND(hh,mhash[2],buf,key_size,mp_hash);
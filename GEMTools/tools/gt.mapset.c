@@ -334,9 +334,9 @@ void gt_mapset_display_compact_map() {
         uint64_t printed = 0;
         GT_ALIGNMENT_ITERATE(alignment,map) {
           if (printed>0) {
-            gt_bofprintf(buffered_output,","PRIgts,PRIgts_content(map->seq_name));
+            gt_bofprintf(buffered_output,","PRIgts,PRIgts_content(gt_map_get_string_seq_name(map)));
           } else {
-            gt_bofprintf(buffered_output,PRIgts,PRIgts_content(map->seq_name));
+            gt_bofprintf(buffered_output,PRIgts,PRIgts_content(gt_map_get_string_seq_name(map)));
           }
           ++printed;
         }
@@ -23,6 +23,7 @@ typedef struct {
   FILE* output_file;
   FILE* output_file_json;
   bool mmap_input;
+  bool direct_input;
   bool paired_end;
   uint64_t num_reads;
   /* [Tests] */
@@ -50,6 +51,7 @@ gt_stats_args parameters = {
     .name_reference_file=NULL,
     .name_output_file=NULL,
     .mmap_input=false,
+    .direct_input=false,
     .paired_end=false,
     .num_reads=0,
     .output_file=NULL,
@@ -439,8 +441,9 @@ void gt_stats_parallel_generate_stats() {
   stats_analysis.use_map_counters = !parameters.use_only_decoded_maps;
 
   // Open file
-  gt_input_file* input_file = (parameters.name_input_file==NULL) ?
-      gt_input_stream_open(stdin) : gt_input_file_open(parameters.name_input_file,parameters.mmap_input);
+  gt_input_file* input_file = (parameters.name_input_file==NULL) ? gt_input_stream_open(stdin) :
+      (parameters.direct_input) ? gt_input_file_open_direct(parameters.name_input_file) :
+          gt_input_file_open(parameters.name_input_file,parameters.mmap_input);
 
   gt_sequence_archive* sequence_archive = NULL;
   if (stats_analysis.indel_profile) {
@@ -470,6 +473,10 @@ void gt_stats_parallel_generate_stats() {
     gt_template *template = gt_template_new();
     stats[tid] = gt_stats_new();
     gt_generic_parser_attributes* generic_parser_attribute = gt_input_generic_parser_attributes_new(parameters.paired_end);
+    gt_map_arena* const map_arena = gt_map_arena_new();
+    gt_input_map_parser_attributes_set_map_arena(generic_parser_attribute->map_parser_attributes,map_arena);
+    gt_input_map_parser_attributes_set_read_views(generic_parser_attribute->map_parser_attributes,true); // Stats just read them
+    gt_input_map_parser_attributes_set_lazy_maps(generic_parser_attribute->map_parser_attributes,parameters.first_map); // Only the first map is profiled
     while ((error_code=gt_input_generic_parser_get_template(buffered_input,template,generic_parser_attribute))) {
       if (error_code!=GT_IMP_OK) {
         gt_error_msg("Fatal error parsing file '%s'\n",parameters.name_input_file);
@@ -481,6 +488,7 @@ void gt_stats_parallel_generate_stats() {
 
     // Clean
     gt_template_delete(template);
+    gt_map_arena_delete(map_arena);
     gt_buffered_input_file_close(buffered_input);
   }
 
@@ -528,6 +536,9 @@ void parse_arguments(int argc,char** argv) {
       parameters.mmap_input = true;
       gt_fatal_error(NOT_IMPLEMENTED);
       break;
+    case 201: // direct-input
+      parameters.direct_input = true;
+      break;
     case 'r': // reference
       parameters.name_reference_file = optarg;
       gt_fatal_error(NOT_IMPLEMENTED);
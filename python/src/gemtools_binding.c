@@ -35,7 +35,41 @@ void gt_write_stream(gt_output_file* output, gt_input_file** inputs, uint64_t nu
   gt_generic_parser_attributes* parser_attributes = gt_input_generic_parser_attributes_new(false); // do not force pairs
   pthread_mutex_t input_mutex = PTHREAD_MUTEX_INITIALIZER;
 
-  if(interleave){
+  if(interleave && num_inputs == 2 && inputs[0]->file_format == FASTA && inputs[1]->file_format == FASTA &&
+      !gt_input_fasta_is_multifasta(inputs[0]) && !gt_input_fasta_is_multifasta(inputs[1])){
+    // main loop, interleave paired FASTA/FASTQ files (each file read on its own I/O thread)
+    gt_input_fasta_paired_reader* paired_reader = gt_input_fasta_paired_reader_new(inputs[0], inputs[1]);
+    #pragma omp parallel num_threads(threads)
+    {
+      register uint64_t i = 0;
+      gt_buffered_output_file* buffered_output = gt_buffered_output_file_new(output);
+      gt_buffered_input_file* buffered_input[2];
+      for(i=0; i<2; i++){
+        buffered_input[i] = gt_buffered_input_file_new(inputs[i]);
+      }
+      // attache first input to output
+      gt_buffered_input_file_attach_buffered_output(buffered_input[0], buffered_output);
+
+      gt_template* template = gt_template_new();
+      while( gt_input_fasta_paired_reader_synch_blocks(paired_reader, buffered_input[0], buffered_input[1]) == GT_STATUS_OK ){
+        for(i=0; i<2; i++){
+          if( gt_input_generic_parser_get_template(buffered_input[i], template, parser_attributes) == GT_STATUS_OK){
+            if(write_map){
+              gt_output_map_bofprint_template(buffered_output, template, map_attributes);
+            }else{
+              gt_output_fasta_bofprint_template(buffered_output, template, attributes);
+            }
+          }
+        }
+      }
+      gt_buffered_output_file_close(buffered_output);
+      for(i=0; i<2; i++){
+        gt_buffered_input_file_close(buffered_input[i]);
+      }
+      gt_template_delete(template);
+    }
+    gt_input_fasta_paired_reader_delete(paired_reader);
+  }else if(interleave){
     // main loop, interleave
     #pragma omp parallel num_threads(threads)
     {
@@ -73,46 +107,31 @@ void gt_write_stream(gt_output_file* output, gt_input_file** inputs, uint64_t nu
       free(buffered_input);
     }
   }else{
-    // main loop, cat
+    // main loop, cat (the set hands out the inputs in order and keeps the block IDs global)
+    gt_input_file_set* input_set = gt_input_file_set_new(inputs, num_inputs, false);
     #pragma omp parallel num_threads(threads)
     {
-      register uint64_t i = 0;
       register uint64_t c = 0;
-      register uint64_t last_id = 0;
       gt_buffered_output_file* buffered_output = gt_buffered_output_file_new(output);
-      gt_buffered_input_file** buffered_input = malloc(1 * sizeof(gt_buffered_input_file*));
-      gt_buffered_input_file* current_input = 0;
+      gt_buffered_input_file* current_input = gt_buffered_input_file_new_from_set(input_set);
       gt_template* template = gt_template_new();
-      gt_status status = 0;
-      for(i=0; i<num_inputs;i++){
-        // create input buffer
-        if(i>0){
-          gt_buffered_input_file_close(current_input);
-          inputs[i]->processed_id = last_id;
-        }
-        current_input = gt_buffered_input_file_new(inputs[i]);
-        buffered_input[0] = current_input;
-        // attache the buffer
-        gt_buffered_input_file_attach_buffered_output(current_input, buffered_output);
+      // attache the buffer
+      gt_buffered_input_file_attach_buffered_output(current_input, buffered_output);
 
-        // read
-        while( gt_input_generic_parser_synch_blocks_a(&input_mutex, buffered_input, 1, parser_attributes) == GT_STATUS_OK ){
-          if( (status = gt_input_generic_parser_get_template(current_input, template, parser_attributes)) == GT_STATUS_OK){
-            if(write_map){
-              gt_output_map_bofprint_template(buffered_output, template, map_attributes);
-            }else{
-              gt_output_fasta_bofprint_template(buffered_output, template, attributes);
-            }
-            c++;
-          }
+      // read
+      while( gt_input_generic_parser_get_template(current_input, template, parser_attributes) == GT_STATUS_OK ){
+        if(write_map){
+          gt_output_map_bofprint_template(buffered_output, template, map_attributes);
+        }else{
+          gt_output_fasta_bofprint_template(buffered_output, template, attributes);
         }
-        last_id = inputs[i]->processed_id;
+        c++;
       }
       gt_buffered_input_file_close(current_input);
       gt_buffered_output_file_close(buffered_output);
       gt_template_delete(template);
-      free(buffered_input);
     }
+    gt_input_file_set_close(input_set);
 
   }
   if(attributes != NULL) gt_output_fasta_attributes_delete(attributes);